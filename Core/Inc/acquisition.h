@@ -0,0 +1,95 @@
+#ifndef INC_ACQUISITION_H_ // 防止头文件重复包含
+#define INC_ACQUISITION_H_
+
+#include <stdint.h>
+#include "fft.h" // FFT_N
+
+#define ACQ_BLOCK_SIZE FFT_N           // 每个乒乓块最多容纳的码值个数 (单通道时为一帧分析数据)
+#define ACQ_MAX_CHANNELS 4             // 扫描模式最多通道数 (PA0 ~ PA3)
+#define ACQ_ADC_FULL_SCALE 4095.0f     // 12 位 ADC 满量程码值
+#define ACQ_ADC_VREF 3.3f              // ADC 参考电压 (V)
+#define ACQ_ADC_MAX_CONVERSION_RATE 750000.0f // ADC 总转换速率上限 (ADCCLK 21 MHz / (15 + 12) 周期约 778 kSPS，留出余量)
+
+// 采样数据来源
+typedef enum
+{
+    ACQ_SOURCE_SYNTHETIC = 0, // 软件信号发生器 (siggen)
+    ACQ_SOURCE_ADC            // ADC1 + 定时器触发 + 循环 DMA
+} acq_source_t;
+
+// 乒乓采集状态: DMA 在前 2 * block_len 个码值上循环，半传输/传输完成中断分别交出前/后一半
+// 多通道扫描时每个块内按采样时刻交织: ch0, ch1, ..., ch(channels-1), ch0, ...
+typedef struct
+{
+    uint16_t dma_buffer[2 * ACQ_BLOCK_SIZE]; // 循环 DMA 目标缓冲区
+    uint32_t channels;                       // 扫描通道数 (1 ~ ACQ_MAX_CHANNELS)
+    uint32_t frame_len;                      // 每个块内每通道的采样数 (2 的幂，供 FFT 使用)
+    uint32_t block_len;                      // 每个块的码值个数 (channels * frame_len)
+    volatile int32_t ready_half;             // 最近完成且尚未取走的一半 (0/1)，-1 表示没有
+    volatile uint32_t blocks_completed;      // DMA 已写完的块数
+    uint32_t blocks_taken;                   // 分析流水线已取走的块数
+    uint32_t last_taken;                     // 上一次取走的块的序号 (blocks_completed 计数)
+} acquisition_t;
+
+/**
+ * @brief 清空状态并设置通道布局 (启动 DMA 之前调用)。
+ * @param acq: 指向采集状态的指针。
+ * @param channels: 扫描通道数 (1 ~ ACQ_MAX_CHANNELS)。
+ * @note frame_len 取满足 channels * frame_len <= ACQ_BLOCK_SIZE 的最大 2 的幂 (1/2/3/4 通道: 1024/512/256/256)，
+ *       DMA 传输长度应为 2 * block_len。
+ */
+void acquisition_reset(acquisition_t *acq, uint32_t channels);
+
+/**
+ * @brief DMA 写完一半时调用 (中断上下文)。
+ * @param acq: 指向采集状态的指针。
+ * @param half: 0: 前一半 (半传输中断); 1: 后一半 (传输完成中断)。
+ * @note 上一块尚未被取走时直接被新块取代，丢块数 = blocks_completed - blocks_taken。
+ */
+void acquisition_block_complete(acquisition_t *acq, uint32_t half);
+
+/**
+ * @brief 丢弃过期的块: 待取的块不是上一次取走的块的下一块时 (中间已有块被覆盖)，等待新写完的块。
+ * @note 过期块所在的一半可能正被 DMA 改写；紧接上一块的块则保证连续，处理速度跟得上时不丢块。
+ */
+void acquisition_drop_stale(acquisition_t *acq);
+
+/**
+ * @brief 取走最近完成的块。
+ * @param acq: 指向采集状态的指针。
+ * @return 指向 dma_buffer 中该块的指针 (不复制)，没有新块时返回 NULL。
+ *         调用者须在 DMA 写回这一半之前 (一个块周期内) 用完数据。
+ */
+const uint16_t *acquisition_take_block(acquisition_t *acq);
+
+/**
+ * @brief 把 ADC 码值转换为电压 (V)，供浮点分析流水线使用。
+ * @param block: ADC 码值 (acquisition_take_block 返回的指针)。
+ * @param output: 输出电压 (长度为 len)。
+ * @param len: 采样点数 (<= ACQ_BLOCK_SIZE)。
+ */
+void acquisition_convert(const uint16_t *block, float *output, uint32_t len);
+
+/**
+ * @brief 从交织块中取出一个通道并转换为电压 (V)。
+ * @param acq: 指向采集状态的指针 (提供通道布局)。
+ * @param block: ADC 码值 (acquisition_take_block 返回的指针)。
+ * @param channel: 通道序号 (0 ~ channels - 1)。
+ * @param output: 输出电压 (长度为 frame_len)。
+ */
+void acquisition_convert_channel(const acquisition_t *acq, const uint16_t *block, uint32_t channel, float *output);
+
+/**
+ * @brief 计算采样定时器的分频: 更新频率 = timer_clock / ((prescaler + 1) * (period + 1))。
+ * @param timer_clock: 定时器计数时钟 (Hz)。
+ * @param rate: 请求的采样频率 (Hz，> 0)。
+ * @param period_max: 自动重装载寄存器的最大值 (16 位定时器 0xFFFF，32 位定时器 0xFFFFFFFF)。
+ * @param prescaler: 输出预分频值 (PSC，<= 0xFFFF)。
+ * @param period: 输出自动重装载值 (ARR，>= 1)。
+ * @return 实际采样频率 (Hz)。
+ * @note 优先用预分频 0 保留最细的频率步进，ARR 放不下时才增大预分频；ARR 取四舍五入，得到最接近的可实现频率。
+ */
+float acquisition_timer_divider(uint32_t timer_clock, float rate, uint32_t period_max,
+                                uint32_t *prescaler, uint32_t *period);
+
+#endif /* INC_ACQUISITION_H_ */
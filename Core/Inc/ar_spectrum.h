@@ -0,0 +1,51 @@
+#ifndef INC_AR_SPECTRUM_H_ // 防止头文件重复包含
+#define INC_AR_SPECTRUM_H_
+
+#include <stdint.h>
+#include "fft.h" // complex_t
+
+#define AR_MAX_ORDER 32 // 支持的最大 AR 阶数
+
+// AR (自回归) 模型: x[t] = -a1 x[t-1] - ... - ap x[t-p] + e[t]
+typedef struct
+{
+    uint32_t order;                 // 模型阶数 p
+    float coeffs[AR_MAX_ORDER + 1]; // 预测误差滤波器 A(z) 的系数，coeffs[0] = 1
+    float error_power;              // 预测误差功率 sigma^2 (每个采样点)
+} ar_model_t;
+
+/**
+ * @brief Levinson-Durbin 递推，由自相关序列求 p 阶 AR 模型。
+ * @param r: 自相关序列 r[0] ~ r[order]。
+ * @param order: 模型阶数 (1 ~ AR_MAX_ORDER)。
+ * @param model: 输出模型。
+ * @return 1: 成功; 0: 参数无效或递推不稳定 (误差功率非正)。
+ */
+uint8_t ar_levinson_durbin(const float *r, uint32_t order, ar_model_t *model);
+
+/**
+ * @brief 由时域采样估计 AR 模型: Hann 加窗 + 基于 FFT 的自相关 + Levinson-Durbin。
+ * @param x: 输入采样数据 (长度为 len，典型值 128 ~ 256)。
+ * @param len: 采样点数 (2 * len <= n)。
+ * @param order: 模型阶数 (< len)。
+ * @param work: FFT 工作缓冲区 (大小为 n)。
+ * @param n: 自相关 FFT 的大小 (2 的幂)。
+ * @param model: 输出模型。
+ * @return 1: 成功; 0: 失败。
+ * @note r[0] 上叠加很小的白噪声修正，避免纯正弦输入时自相关矩阵奇异。
+ */
+uint8_t ar_estimate(const float *x, uint32_t len, uint32_t order,
+                    complex_t *work, uint32_t n, ar_model_t *model);
+
+/**
+ * @brief 在 n 点密集频率网格上计算 AR 谱 P(f) = sigma^2 / |A(f)|^2。
+ *        A(f) 由系数序列零填充到 n 点后的一次 FFT 得到，网格与样本长度无关。
+ * @param model: AR 模型。
+ * @param work: FFT 工作缓冲区 (大小为 n)。
+ * @param n: 频率网格点数 (2 的幂，> order)。
+ * @param magnitudes: 输出幅度谱 (大小为 n / 2)，为 sqrt(P(f) / n)，
+ *                    与 fft_calculate_magnitudes 的输出在白噪声下期望一致。
+ */
+void ar_spectrum(const ar_model_t *model, complex_t *work, uint32_t n, float *magnitudes);
+
+#endif /* INC_AR_SPECTRUM_H_ */
@@ -0,0 +1,51 @@
+#ifndef INC_AUTOCORR_H_ // 防止头文件重复包含
+#define INC_AUTOCORR_H_
+
+#include <stdint.h>
+#include "fft.h" // complex_t, fft_radix2, fft_inverse_radix2
+
+// 基音/周期检测结果
+typedef struct
+{
+    float period_samples; // 子样本精度的周期 (采样点)，0 表示未检测到
+    float frequency;      // 基频 (Hz)，0 表示未检测到
+    float clarity;        // 周期清晰度 (0 ~ 1)，1 - CMNDF 最小值
+} pitch_result_t;
+
+/**
+ * @brief 基于 FFT 计算线性 (非循环) 自相关: 零填充 -> FFT -> |X|^2 -> IFFT。
+ * @param x: 输入采样数据 (长度为 len)。
+ * @param len: 采样点数，必须满足 2 * len <= n 才不会发生循环回绕。
+ * @param work: 工作缓冲区 (大小为 n)。
+ *              返回后 work[m].real 为滞后 m 的自相关 r[m] (m = 0 ~ len-1)。
+ * @param n: FFT 的大小 (必须为 2 的幂)。
+ */
+void autocorr_compute(const float *x, uint32_t len, complex_t *work, uint32_t n);
+
+/**
+ * @brief 与 autocorr_compute 相同，但输入已由调用者装入 work (例如已加窗的数据)。
+ * @param work: 工作缓冲区 (大小为 n)，调用前 work[i].real (i < len) 为输入，其余内容任意。
+ * @param len: 输入采样点数 (2 * len <= n)。
+ * @param n: FFT 的大小 (必须为 2 的幂)。
+ */
+void autocorr_compute_in_place(complex_t *work, uint32_t len, uint32_t n);
+
+/**
+ * @brief YIN 风格的基音/周期检测 (累积均值归一化差分函数 + 绝对阈值)。
+ * @param x: 输入采样数据 (长度为 len)。
+ * @param len: 采样点数 (2 * len <= n)。
+ * @param work: 工作缓冲区 (大小为 n)，实部保存自相关，虚部保存 CMNDF。
+ * @param n: FFT 的大小 (必须为 2 的幂)。
+ * @param sample_rate: 采样频率 (Hz)。
+ * @param min_freq: 搜索的最低基频 (Hz)，决定最大周期。
+ * @param max_freq: 搜索的最高基频 (Hz)，决定最小周期。
+ * @param threshold: CMNDF 绝对阈值 (典型值 0.1 ~ 0.2)。
+ * @param result: 指向结果结构体的指针。
+ * @note 差分函数由自相关和能量前缀和得到，d(t) = E_head + E_tail - 2 r(t)，
+ *       整体复杂度为 O(n log n)，谐波强于基频时也能锁定真实周期。
+ */
+void pitch_detect_yin(const float *x, uint32_t len, complex_t *work, uint32_t n,
+                      float sample_rate, float min_freq, float max_freq,
+                      float threshold, pitch_result_t *result);
+
+#endif /* INC_AUTOCORR_H_ */
@@ -0,0 +1,79 @@
+#ifndef INC_BASELINE_H_ // 防止头文件重复包含
+#define INC_BASELINE_H_
+
+#include <stdint.h>
+#include "fft.h" // complex_t, FFT_N
+
+#define BASELINE_BINS (FFT_N / 2)  // 统计的频点数
+#define BASELINE_MAGIC 0x32534142u // "BAS2"，Flash 中基线数据的标识 (加入采样频率字段后由 "BASL" 改为 "BAS2")
+#define BASELINE_MIN_STD_DB 1.0f   // 标准差下限 (dB)，防止稳态信号方差接近 0 时误报
+
+// 逐频点基线 (对数幅度的均值和方差，Welford 在线更新)，可整体写入 Flash
+typedef struct
+{
+    uint32_t magic;              // BASELINE_MAGIC
+    uint32_t bins;               // 频点数 (BASELINE_BINS)
+    uint32_t count;              // 已学习的帧数
+    float sample_rate;           // 学习时的采样频率 (Hz)，频点与频率的对应关系由它决定
+    float mean[BASELINE_BINS];   // 各频点对数幅度的均值 (dB)
+    float m2[BASELINE_BINS];     // 各频点与均值之差的平方和
+    uint32_t checksum;           // 以上所有字的累加和
+} spectral_baseline_t;
+
+// 单帧异常评分 (不含直流频点)
+typedef struct
+{
+    float max_z;      // 最大 |z| 分数
+    uint32_t max_bin; // 最大 |z| 所在频点
+    float rms_z;      // 对角协方差下的简化马氏距离: sqrt(mean(z^2))
+} anomaly_score_t;
+
+/**
+ * @brief 清空基线，重新开始学习。
+ * @param baseline: 指向基线的指针。
+ * @param sample_rate: 学习时的采样频率 (Hz)，随基线一起保存。
+ */
+void baseline_reset(spectral_baseline_t *baseline, float sample_rate);
+
+/**
+ * @brief 由 FFT 结果计算幅度 (与 fft_calculate_magnitudes 相同) 并在同一次遍历中更新各频点的均值和方差。
+ * @param baseline: 指向基线的指针。
+ * @param spectrum: FFT_N 点 FFT 的输出。
+ * @param magnitudes: 输出幅度 (大小为 BASELINE_BINS)。
+ */
+void baseline_learn_spectrum(spectral_baseline_t *baseline, const complex_t *spectrum, float *magnitudes);
+
+/**
+ * @brief 由 FFT 结果计算幅度并在同一次遍历中对照基线评分。
+ * @param baseline: 指向基线的指针 (count >= 2)。
+ * @param spectrum: FFT_N 点 FFT 的输出。
+ * @param magnitudes: 输出幅度 (大小为 BASELINE_BINS)。
+ * @param score: 输出评分。
+ */
+void baseline_score_spectrum(const spectral_baseline_t *baseline, const complex_t *spectrum,
+                             float *magnitudes, anomaly_score_t *score);
+
+/**
+ * @brief 用已经算好的幅度谱更新基线 (用于多窗等其他频谱估计方法)。
+ */
+void baseline_learn(spectral_baseline_t *baseline, const float *magnitudes);
+
+/**
+ * @brief 用已经算好的幅度谱对照基线评分 (用于多窗等其他频谱估计方法)。
+ */
+void baseline_score(const spectral_baseline_t *baseline, const float *magnitudes, anomaly_score_t *score);
+
+/**
+ * @brief 填写标识和校验和，准备写入 Flash。
+ * @param baseline: 指向基线的指针。
+ */
+void baseline_seal(spectral_baseline_t *baseline);
+
+/**
+ * @brief 检查基线 (例如从 Flash 读出的数据) 是否有效。
+ * @param baseline: 指向基线的指针。
+ * @return 1: 标识、频点数和校验和均正确且至少学习了 2 帧; 0: 无效。
+ */
+uint8_t baseline_is_valid(const spectral_baseline_t *baseline);
+
+#endif /* INC_BASELINE_H_ */
@@ -0,0 +1,39 @@
+#ifndef INC_CHANNELIZER_H_ // 防止头文件重复包含
+#define INC_CHANNELIZER_H_
+
+#include <stdint.h>
+#include "fft.h" // complex_t, fft_radix2
+
+// 原型滤波器参数 (需与 gen_channelizer_prototype.py 生成 channelizer_prototype.c 时使用的参数一致)
+#define CHANNELIZER_CHANNELS 128          // 信道数 N (2 的幂，即每次 FFT 的点数和抽取因子)
+#define CHANNELIZER_TAPS_PER_BRANCH 8     // 每个多相支路的抽头数 M
+#define CHANNELIZER_TAPS (CHANNELIZER_CHANNELS * CHANNELIZER_TAPS_PER_BRANCH)
+
+// 存放于 Flash 的原型低通 FIR (channelizer_prototype.c)
+extern const float channelizer_prototype[CHANNELIZER_TAPS];
+
+// 信道化器状态: 最近 M * N 个输入采样的环形缓冲区
+typedef struct
+{
+    float history[CHANNELIZER_TAPS];
+    uint32_t write_index; // 下一个写入位置 (始终为 N 的整数倍)
+} channelizer_t;
+
+/**
+ * @brief 初始化信道化器 (清空输入历史)。
+ * @param channelizer: 指向信道化器状态的指针。
+ */
+void channelizer_init(channelizer_t *channelizer);
+
+/**
+ * @brief 加权重叠相加 (WOLA) 多相滤波器组: 输入 N 个新采样，输出 N 个信道的一组复数样本。
+ *        最近 M * N 个采样乘以原型 FIR，按 N 点折叠 (每个支路 M 个抽头求和)，再做一次 N 点 FFT。
+ * @param channelizer: 指向信道化器状态的指针。
+ * @param block: N 个新输入采样。
+ * @param out: 输出缓冲区 (大小为 N)，out[k] 为第 k 个信道 (中心频率 k * fs / N) 在抽取后速率上的复数样本。
+ * @note 每组输出的代价为 M * N 次乘加加一次 N 点 FFT，相邻信道抑制由原型 FIR 决定，远优于单纯加窗。
+ *       临界抽样 (抽取因子等于 N)，信道复数样本无需额外的相位旋转。
+ */
+void channelizer_process(channelizer_t *channelizer, const float *block, complex_t *out);
+
+#endif /* INC_CHANNELIZER_H_ */
@@ -0,0 +1,40 @@
+#ifndef INC_CQT_H_ // 防止头文件重复包含
+#define INC_CQT_H_
+
+#include <stdint.h>
+#include "fft.h" // complex_t, FFT_N
+
+// 频域核参数 (需与 gen_cqt_kernel.py 生成 cqt_kernel.c 时使用的参数一致)
+#define CQT_N FFT_N                 // 帧长 (等于 FFT 点数)
+#define CQT_SAMPLE_RATE 48000.0f    // 生成核时使用的采样率 (Hz)
+#define CQT_FMIN 880.0f             // 最低中心频率 (Hz)
+#define CQT_BINS_PER_OCTAVE 12      // 每倍频程频点数
+#define CQT_NUM_OCTAVES 4           // 倍频程数
+#define CQT_NUM_BINS (CQT_BINS_PER_OCTAVE * CQT_NUM_OCTAVES)
+
+// 稀疏核的一行: 第 k 个 CQ 频点在 FFT 频点 [start_bin, start_bin + length) 上的系数
+typedef struct
+{
+    uint16_t start_bin; // 第一个非零 FFT 频点
+    uint16_t length;    // 连续非零系数个数
+    uint32_t offset;    // 在 cqt_kernel_values 中的起始下标
+    float scale;        // Q15 系数还原为浮点的缩放系数
+} cqt_kernel_row_t;
+
+// 存放于 Flash 的稀疏频域核 (cqt_kernel.c)
+extern const float cqt_center_freqs[CQT_NUM_BINS];        // 各 CQ 频点的中心频率 (Hz)
+extern const cqt_kernel_row_t cqt_kernel_rows[CQT_NUM_BINS]; // 每个 CQ 频点的核区间
+extern const int16_t cqt_kernel_values[][2];              // 共轭后的核系数 (实部, 虚部)，Q15
+
+/**
+ * @brief 常数 Q 变换 (Brown-Puckette): 由一帧 FFT 结果与稀疏频域核相乘得到 CQ 频点幅度。
+ * @param spectrum: 一帧 CQT_N 点 FFT 的输出 (矩形窗，只读取前 CQT_N / 2 个频点)。
+ * @param first_bin: 起始 CQ 频点。
+ * @param num_bins: 计算的 CQ 频点个数 (first_bin + num_bins <= CQT_NUM_BINS)。
+ * @param magnitudes: 输出幅度 (大小为 num_bins)，幅度为 A 的正弦位于中心频率时输出约 A / 2，
+ *                    与 fft_calculate_magnitudes 的刻度一致。
+ * @note 每个 CQ 频点只需与几个到几十个非零核系数相乘，远少于逐频点直接求和的 N_k 次复数乘法。
+ */
+void cqt_compute(const complex_t *spectrum, uint32_t first_bin, uint32_t num_bins, float *magnitudes);
+
+#endif /* INC_CQT_H_ */
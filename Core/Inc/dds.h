@@ -0,0 +1,62 @@
+#ifndef INC_DDS_H_ // 防止头文件重复包含
+#define INC_DDS_H_
+
+#include <stdint.h>
+
+// 正弦表参数 (需与 gen_dds_table.py 生成 dds_table.c 时使用的参数一致)
+#define DDS_QUARTER_BITS 9                     // 四分之一周期的表项数 = 2^DDS_QUARTER_BITS
+#define DDS_QUARTER_SIZE (1u << DDS_QUARTER_BITS)
+
+// 存放于 Flash 的四分之一周期正弦表 (dds_table.c)，共 DDS_QUARTER_SIZE + 1 项
+extern const float dds_quarter_sine[DDS_QUARTER_SIZE + 1];
+
+// 直接数字频率合成振荡器: 32 位相位累加器，2^32 对应一个周期
+typedef struct
+{
+    uint32_t phase;      // 下一个采样的相位
+    uint32_t phase_step; // 每个采样的相位增量
+    float amplitude;
+    float offset;
+} dds_oscillator_t;
+
+/**
+ * @brief 由频率计算相位增量。
+ * @param freq: 频率 (Hz，0 ~ sample_rate / 2)。
+ * @param sample_rate: 采样频率 (Hz)。
+ * @return 相位增量 (频率分辨率 sample_rate / 2^32)；超出 0 ~ sample_rate 的频率按混叠后的频率计算。
+ */
+uint32_t dds_phase_step(float freq, float sample_rate);
+
+/**
+ * @brief 查表求正弦: 高 2 位为象限，其后 DDS_QUARTER_BITS 位为表下标，其余位用于线性插值。
+ * @param phase: 相位 (2^32 对应一个周期)。
+ * @return sin(2 pi phase / 2^32)，最大误差约 1.2e-6。
+ */
+float dds_sin(uint32_t phase);
+
+/**
+ * @brief 初始化振荡器 (相位清零)。
+ * @param osc: 指向振荡器的指针。
+ * @param freq: 频率 (Hz)。
+ * @param sample_rate: 采样频率 (Hz)。
+ * @param amplitude: 幅度。
+ * @param offset: 直流偏移。
+ */
+void dds_init(dds_oscillator_t *osc, float freq, float sample_rate, float amplitude, float offset);
+
+/**
+ * @brief 修改频率、幅度和偏移，保持当前相位 (频率切换处波形连续)。
+ */
+void dds_set(dds_oscillator_t *osc, float freq, float sample_rate, float amplitude, float offset);
+
+/**
+ * @brief 生成 len 个采样并推进相位，连续调用时各帧之间相位连续。
+ * @param osc: 指向振荡器的指针。
+ * @param buffer: 输出缓冲区 (长度为 len)。
+ * @param len: 采样点数。
+ * @note 每个采样只需一次整数加法、一次查表和一次插值，无 libm 调用；
+ *       相位为整数，不会像 sinf(2 pi f i / fs) 那样随 i 增大而损失精度。
+ */
+void dds_generate(dds_oscillator_t *osc, float *buffer, uint32_t len);
+
+#endif /* INC_DDS_H_ */
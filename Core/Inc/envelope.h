@@ -0,0 +1,20 @@
+#ifndef INC_ENVELOPE_H_ // 防止头文件重复包含
+#define INC_ENVELOPE_H_
+
+#include <stdint.h>
+#include "fft.h" // complex_t, fft_radix2, fft_inverse_radix2
+
+/**
+ * @brief 基于希尔伯特变换的包络谱分析 (轴承故障检测)，全部在 work 缓冲区内原地完成。
+ *        正 FFT -> 负频率置零 (正频率加倍) -> 逆 FFT 得到解析信号 -> 取模得到包络
+ *        -> 去直流 -> 按 decimation 抽取 (块平均抗混叠) -> 对包络做第二次 FFT -> 幅度。
+ * @param work: 输入/工作缓冲区 (大小为 n)，调用前实部为时域采样、虚部为 0。
+ * @param n: 第一次 FFT 的大小 (必须为 2 的幂)。
+ * @param decimation: 包络抽取因子 (2 的幂，1 表示不抽取)，包络采样率为 fs / decimation。
+ * @param magnitudes: 输出包络谱幅度 (大小至少为 n / decimation / 2)。
+ * @return 包络谱的频点数 (n / decimation / 2)，参数无效时返回 0。
+ * @note 包络谱第 k 个频点对应频率 k * fs / n，与抽取因子无关。
+ */
+uint32_t envelope_spectrum(complex_t *work, uint32_t n, uint32_t decimation, float *magnitudes);
+
+#endif /* INC_ENVELOPE_H_ */
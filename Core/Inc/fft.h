@@ -27,6 +27,24 @@ typedef struct
  */
 void fft_radix2(complex_t *input_output, uint32_t n);
 
+/**
+ * @brief 批量基-2 FFT: 对连续存放的 count 组 n 点数据分别做 FFT (原地计算)。
+ * @param input_output: 指向复数数组的指针 (大小为 n * count)，第 c 组位于 [c * n, (c + 1) * n)。
+ * @param n: 每组的 FFT 点数 (必须为 2 的幂)。
+ * @param count: 组数 (如多通道采集的通道数)。
+ * @note 每个旋转因子只计算一次并依次作用于所有组，循环和旋转因子递推的开销由各组分摊。
+ */
+void fft_radix2_batch(complex_t *input_output, uint32_t n, uint32_t count);
+
+/**
+ * @brief 执行基-2 快速傅里叶逆变换 (IFFT)。
+ * @param input_output: 指向复数频谱数组的指针 (大小为 n)。
+ *                      输出的时域序列将覆盖此数组 (原地计算)，并已除以 n。
+ * @param n: IFFT 的大小 (必须为 2 的幂)。
+ * @note 通过 "共轭 - 正变换 - 共轭" 复用 fft_radix2，不需要额外的旋转因子表。
+ */
+void fft_inverse_radix2(complex_t *input_output, uint32_t n);
+
 /**
  * @brief 计算复数 FFT 输出的幅度。
  * @param complex_output: 指向复数 FFT 输出数组的指针 (大小为 FFT_N)。
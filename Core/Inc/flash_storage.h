@@ -0,0 +1,25 @@
+#ifndef INC_FLASH_STORAGE_H_ // 防止头文件重复包含
+#define INC_FLASH_STORAGE_H_
+
+#include <stdint.h>
+
+// 参数存储区: STM32F401RC 的扇区 1 (16 KB)，链接脚本中 FLASH 区域在它两侧分开 (扇区 0 只放向量表)
+#define FLASH_STORAGE_ADDRESS 0x08004000u
+#define FLASH_STORAGE_SIZE (16u * 1024u)
+#define FLASH_STORAGE_SECTOR FLASH_SECTOR_1
+
+/**
+ * @brief 擦除存储扇区并写入一块数据 (按字编程)。
+ * @param data: 要写入的数据 (4 字节对齐)。
+ * @param len: 数据字节数 (<= FLASH_STORAGE_SIZE，不足一个字的尾部按整字写入)。
+ * @return 1: 成功; 0: 长度无效、擦除或编程失败。
+ * @note 擦除 16 KB 扇区需要数百毫秒，期间 CPU 停顿在 Flash 访问上，只应在主循环中调用。
+ */
+uint8_t flash_storage_write(const void *data, uint32_t len);
+
+/**
+ * @brief 返回存储区的只读指针 (Flash 可直接按内存映射读取)。
+ */
+const void *flash_storage_read(void);
+
+#endif /* INC_FLASH_STORAGE_H_ */
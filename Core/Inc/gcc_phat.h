@@ -0,0 +1,30 @@
+#ifndef INC_GCC_PHAT_H_ // 防止头文件重复包含
+#define INC_GCC_PHAT_H_
+
+#include <stdint.h>
+#include "fft.h" // complex_t, fft_radix2, fft_inverse_radix2
+
+// GCC-PHAT 时延估计结果
+typedef struct
+{
+    float lag_samples; // 子样本精度的时延 (采样点)，正值表示 y 滞后于 x
+    float confidence;  // 归一化互相关峰值 (0 ~ 1)，越接近 1 越可信
+} gcc_phat_result_t;
+
+/**
+ * @brief 使用 GCC-PHAT (相位变换加权的广义互相关) 估计两路信号之间的时延。
+ * @param x: 参考通道采样数据 (长度为 len)。
+ * @param y: 待测通道采样数据 (长度为 len)。
+ * @param len: 每个通道的采样点数 (len <= n，其余部分零填充)。
+ *             建议 len <= n / 2，以避免循环相关的回绕。
+ * @param work: 工作缓冲区 (大小为 n)，计算结束后保存互相关序列 (实部)。
+ * @param n: FFT 的大小 (必须为 2 的幂)。
+ * @param max_lag: 搜索的最大时延 (采样点)，0 表示搜索 ±n/2。
+ * @param result: 指向结果结构体的指针。
+ * @note 两路实信号打包为一路复信号 x + j*y，只需一次正变换即可得到两路频谱。
+ */
+void gcc_phat_estimate(const float *x, const float *y, uint32_t len,
+                       complex_t *work, uint32_t n, uint32_t max_lag,
+                       gcc_phat_result_t *result);
+
+#endif /* INC_GCC_PHAT_H_ */
@@ -0,0 +1,57 @@
+#ifndef INC_IR_MEASURE_H_ // 防止头文件重复包含
+#define INC_IR_MEASURE_H_
+
+#include <stdint.h>
+#include "fft.h" // complex_t, fft_radix2, fft_inverse_radix2
+
+// MLS 参数 (需与 gen_mls_tables.py 生成 mls_tables.c 时使用的参数一致)
+#define MLS_ORDER 10                            // LFSR 位数 m
+#define MLS_LENGTH ((1u << MLS_ORDER) - 1)      // 序列周期 N = 2^m - 1
+#define MLS_HADAMARD_SIZE (1u << MLS_ORDER)     // 快速 Hadamard 变换点数
+#define MLS_TAP_MASK 0x009u                     // 反馈抽头: a[n+m] = a[n] ^ a[n+3]
+#define MLS_SEED 1u                             // LFSR 初始状态 (测量帧必须从该状态开始)
+
+// 存放于 Flash 的置换表 (mls_tables.c)
+extern const uint16_t mls_input_perm[MLS_LENGTH];  // 采样 n -> Hadamard 下标
+extern const uint16_t mls_output_perm[MLS_LENGTH]; // 时延 k -> Hadamard 下标
+
+/**
+ * @brief 生成双极性 MLS 激励 (比特 0 输出 +amplitude，比特 1 输出 -amplitude)。
+ * @param state: LFSR 状态 (初值 MLS_SEED)，跨调用保持，连续调用得到周期序列。
+ * @param buffer: 输出缓冲区 (长度为 len)。
+ * @param len: 采样点数。
+ * @param amplitude: 激励幅度。
+ */
+void ir_mls_generate(uint32_t *state, float *buffer, uint32_t len, float amplitude);
+
+/**
+ * @brief 原地快速 Walsh-Hadamard 变换 (自然序，不归一化)，只有加减法。
+ * @param data: 数据 (长度为 len)。
+ * @param len: 点数 (2 的幂)。
+ */
+void ir_fwht(float *data, uint32_t len);
+
+/**
+ * @brief MLS 反卷积: 由一个稳态周期的响应求系统冲激响应 (循环相关)。
+ * @param response: 响应采样 (MLS_LENGTH 个，第一个采样对应 LFSR 状态为 MLS_SEED 时的激励)。
+ * @param work: 工作缓冲区 (MLS_HADAMARD_SIZE 个 float)。
+ * @param impulse: 输出冲激响应 (MLS_LENGTH 个，可与 response 相同)。
+ * @param amplitude: 激励幅度，用于归一化。
+ * @note 按置换表散布 -> FWHT -> 按置换表收集，O(N log N) 次加法，不需要 FFT 和乘法。
+ *       冲激响应长于 MLS_LENGTH 时会循环混叠。
+ */
+void ir_mls_deconvolve(const float *response, float *work, float *impulse, float amplitude);
+
+/**
+ * @brief 指数扫频反卷积: 由激励和响应求系统冲激响应 (频域正则化逆滤波)。
+ * @param buffer: 输入: 实部为激励，虚部为响应 (均零填充到 n)；输出: 实部为冲激响应。
+ * @param n: FFT 点数 (2 的幂)。
+ * @param f_low: 扫频起始频率 (Hz)。
+ * @param f_high: 扫频终止频率 (Hz)。
+ * @param sample_rate: 采样频率 (Hz)。
+ * @note 激励和响应打包进一次复数 FFT，按 k 与 n-k 成对分离后求 H = Y X* / (|X|^2 + eps)，
+ *       扫频范围之外的频点置零，再做一次逆 FFT。谐波失真产物落在冲激响应的末尾 (负时延)。
+ */
+void ir_sweep_deconvolve(complex_t *buffer, uint32_t n, float f_low, float f_high, float sample_rate);
+
+#endif /* INC_IR_MEASURE_H_ */
@@ -0,0 +1,68 @@
+#ifndef INC_LEVEL_METER_H_ // 防止头文件重复包含
+#define INC_LEVEL_METER_H_
+
+#include <stdint.h>
+
+// IEC 61672 时间计权常数 (秒)
+#define LEVEL_METER_TAU_FAST 0.125f         // Fast
+#define LEVEL_METER_TAU_SLOW 1.0f           // Slow
+#define LEVEL_METER_TAU_IMPULSE_RISE 0.035f // Impulse 上升
+#define LEVEL_METER_TAU_IMPULSE_FALL 1.5f   // Impulse 衰减
+
+// 声级计状态 (时间计权的均方值是连续的，统计量按上报间隔清零)
+typedef struct
+{
+    // 一阶指数平均系数 alpha = 1 - exp(-1 / (fs * tau))
+    float alpha_fast;
+    float alpha_slow;
+    float alpha_impulse_rise;
+    float alpha_impulse_fall;
+
+    // 时间计权的均方值
+    float ms_fast;
+    float ms_slow;
+    float ms_impulse;
+
+    // 上报间隔内的统计量
+    double energy_sum;     // 平方和 (用于 Leq)
+    uint32_t sample_count; // 采样点数
+    float ms_max;          // Fast 计权均方值的最大值 (Lmax)
+    float ms_min;          // Fast 计权均方值的最小值 (Lmin)
+
+    uint32_t settle_samples; // 启动后忽略 Lmax/Lmin 的采样点数 (等待 Fast 计权稳定)
+} level_meter_t;
+
+// 声级计读数 (dB，相对 1.0 RMS)
+typedef struct
+{
+    float leq;     // 等效连续声级
+    float lmax;    // Fast 计权最大声级
+    float lmin;    // Fast 计权最小声级
+    float fast;    // 当前 Fast 计权声级
+    float slow;    // 当前 Slow 计权声级
+    float impulse; // 当前 Impulse 计权声级
+} level_meter_result_t;
+
+/**
+ * @brief 初始化声级计。
+ * @param meter: 指向声级计状态的指针。
+ * @param sample_rate: 采样频率 (Hz)。
+ */
+void level_meter_init(level_meter_t *meter, float sample_rate);
+
+/**
+ * @brief 用一段时域采样更新声级计 (直接读取输入缓冲区，不做额外缓存)。
+ * @param meter: 指向声级计状态的指针。
+ * @param samples: 时域采样数据。
+ * @param len: 采样点数。
+ */
+void level_meter_process(level_meter_t *meter, const float *samples, uint32_t len);
+
+/**
+ * @brief 读取当前声级，并清零上报间隔内的 Leq/Lmax/Lmin 统计量。
+ * @param meter: 指向声级计状态的指针。
+ * @param result: 输出声级读数。
+ */
+void level_meter_read_and_reset(level_meter_t *meter, level_meter_result_t *result);
+
+#endif /* INC_LEVEL_METER_H_ */
@@ -54,8 +54,41 @@ void Error_Handler(void);
 
 /* USER CODE BEGIN EFP */
 // 公开函数声明，供其他文件调用
-void Update_Signal_Parameters(float freq, float amp, float offset);
+uint8_t Update_Signal_Parameters(float freq, float amp, float offset);
 void Trigger_FFT_Recalculation(void);
+uint8_t Request_GCC_PHAT(float delay_samples);
+void Request_Pitch_Detection(float min_freq, float max_freq);
+uint8_t Set_Octave_Mode(uint32_t fraction, char weighting);
+void Set_Level_Meter_Interval(uint32_t interval_ms);
+uint8_t Set_MFCC_Mode(uint32_t num_coeffs, uint32_t num_filters, float f_low, float f_high);
+uint8_t Set_Descriptor_Mode(float rolloff_fraction);
+uint8_t Request_Envelope_Spectrum(float mod_freq, uint32_t decimation);
+uint8_t Set_Spectrum_Estimator(uint32_t estimator);
+uint8_t Set_AR_Estimator(uint32_t order, uint32_t frame_len);
+uint8_t Set_Wavelet_Engine(uint32_t levels, char wavelet, float threshold);
+uint8_t Set_CQT_Mode(float f_low, float f_high);
+uint8_t Set_Sparse_FFT_Mode(uint32_t n_eff, uint32_t max_peaks);
+uint8_t Set_Channelizer_Mode(char mode, uint32_t channel);
+uint8_t Set_Anomaly_Learning(uint32_t frames);
+uint8_t Set_Anomaly_Monitor(float threshold, char metric);
+uint8_t Request_Baseline_Storage(char operation);
+uint8_t Set_Occupancy_Survey(uint8_t enable, float threshold_db);
+uint8_t Request_Occupancy_Report(float min_duty_percent);
+void Request_DDS_Benchmark(void);
+uint8_t Set_Signal_Generator(char waveform, const float *params, uint32_t count);
+void Set_Spectrum_Cache(uint8_t enable);
+uint8_t Request_Frequency_Sweep(float start_freq, float stop_freq, uint32_t points, uint8_t logarithmic,
+                                uint32_t dwell_ms);
+uint8_t Request_Impulse_Response(char method, uint32_t taps, float f_low, float f_high);
+void Set_Acquisition_Source(uint8_t use_adc);
+uint8_t Set_Sample_Rate(float rate);
+uint8_t Set_Scan_Mode(uint32_t channels, char output);
+uint8_t Set_Trigger_Mode(char type, float level, float pre_percent, char mode);
+uint8_t Set_Mask_Segment(float f_start, float f_end, float db_start, float db_end);
+uint8_t Set_Mask_Codes(uint32_t first_bin, const uint8_t *codes, uint32_t count);
+void Clear_Mask(void);
+uint8_t Set_Mask_Monitor(char mode);
+void Request_Mask_Status(void);
 /* USER CODE END EFP */
 
 /* Private defines -----------------------------------------------------------*/
@@ -0,0 +1,54 @@
+#ifndef INC_MFCC_H_ // 防止头文件重复包含
+#define INC_MFCC_H_
+
+#include <stdint.h>
+#include "fft.h" // FFT_N
+
+#define MFCC_MAX_FILTERS 40 // 最大梅尔滤波器个数
+#define MFCC_MAX_COEFFS 20  // 最大 MFCC 系数个数
+
+// 梅尔滤波器组 + DCT-II 计划
+// 相邻三角滤波器首尾相接，每个频点只落在 "段 p" 上:
+//   对滤波器 p-1 贡献下降沿权重 (1 - t)，对滤波器 p 贡献上升沿权重 t，
+// 因此每个频点只需保存一个段号和一个权重，即为稀疏的滤波器组。
+typedef struct
+{
+    uint32_t n;                                      // FFT 点数
+    float sample_rate;                               // 采样频率 (Hz)
+    uint32_t num_filters;                            // 梅尔滤波器个数 M
+    uint32_t num_coeffs;                             // 输出 MFCC 系数个数
+    float f_low;                                     // 滤波器组下限频率 (Hz)
+    float f_high;                                    // 滤波器组上限频率 (Hz)
+    uint16_t first_bin;                              // 第一个参与计算的频点
+    uint16_t last_bin;                               // 最后一个参与计算的频点 (不含)
+    uint8_t bin_segment[FFT_N / 2];                  // 每个频点所在的段号 p (0 ~ M)
+    float bin_weight[FFT_N / 2];                     // 每个频点在段内的位置 t (0 ~ 1)
+    float dct[MFCC_MAX_COEFFS * MFCC_MAX_FILTERS];   // 正交归一化 DCT-II 系数表
+} mfcc_plan_t;
+
+/**
+ * @brief 构建梅尔滤波器组和 DCT-II 系数表。
+ * @param plan: 指向计划结构体的指针。
+ * @param n: FFT 的大小 (<= FFT_N)。
+ * @param sample_rate: 采样频率 (Hz)。
+ * @param num_filters: 梅尔滤波器个数 (2 ~ MFCC_MAX_FILTERS)。
+ * @param num_coeffs: MFCC 系数个数 (1 ~ num_filters，且 <= MFCC_MAX_COEFFS)。
+ * @param f_low: 下限频率 (Hz)。
+ * @param f_high: 上限频率 (Hz)，不超过采样率的一半。
+ * @return 1: 成功; 0: 参数无效。
+ */
+uint8_t mfcc_plan_init(mfcc_plan_t *plan, uint32_t n, float sample_rate,
+                       uint32_t num_filters, uint32_t num_coeffs,
+                       float f_low, float f_high);
+
+/**
+ * @brief 由 FFT 幅度计算 MFCC: 梅尔滤波器组 -> 对数压缩 -> DCT-II。
+ * @param plan: 已构建的计划。
+ * @param magnitudes: fft_calculate_magnitudes 的输出 (大小为 n / 2)。
+ * @param mel_energies: 工作缓冲区，保存各滤波器的对数能量 (大小为 num_filters)。
+ * @param coeffs: 输出 MFCC 系数 (大小为 num_coeffs)。
+ */
+void mfcc_compute(const mfcc_plan_t *plan, const float *magnitudes,
+                  float *mel_energies, float *coeffs);
+
+#endif /* INC_MFCC_H_ */
@@ -0,0 +1,39 @@
+#ifndef INC_MULTITAPER_H_ // 防止头文件重复包含
+#define INC_MULTITAPER_H_
+
+#include <stdint.h>
+#include "fft.h" // complex_t, FFT_N
+
+// DPSS 窗函数表参数 (需与 gen_dpss_tables.py 生成 dpss_tables.c 时使用的参数一致)
+#define MULTITAPER_N FFT_N // 窗长 (等于 FFT 点数)
+#define MULTITAPER_NW 2.5f // 时间-带宽积，分辨带宽为 2 * NW * fs / N
+#define MULTITAPER_K 4     // 窗函数个数 (必须为偶数，两个窗打包进一次复数 FFT)
+
+// 前 K-2 个特征谱的暂存区大小 (complex_t 个数，每个元素存放一对窗的特征谱)
+#define MULTITAPER_EIGEN_STORE_SIZE ((MULTITAPER_K / 2 - 1) * (MULTITAPER_N / 2))
+
+// 存放于 Flash 的 DPSS 表 (dpss_tables.c)
+extern const float dpss_eigenvalues[MULTITAPER_K];                    // 能量集中度 lambda_k
+extern const float dpss_half_tapers[MULTITAPER_K][MULTITAPER_N / 2]; // 窗函数前半部分 (单位能量)
+
+// 特征谱的合成方式
+typedef enum
+{
+    MULTITAPER_WEIGHTS_EQUAL = 0, // 等权平均
+    MULTITAPER_WEIGHTS_ADAPTIVE   // Thomson 自适应加权
+} multitaper_weighting_t;
+
+/**
+ * @brief Thomson 多窗谱估计。
+ * @param x: 输入采样数据 (长度为 MULTITAPER_N)。
+ * @param work: FFT 工作缓冲区 (大小为 MULTITAPER_N)。
+ * @param eigen_store: 特征谱暂存区 (大小为 MULTITAPER_EIGEN_STORE_SIZE)。
+ * @param weighting: 特征谱合成方式。
+ * @param magnitudes: 输出幅度谱 (大小为 MULTITAPER_N / 2)，为 sqrt(S(f) / N)，
+ *                    与 fft_calculate_magnitudes 的输出在白噪声下期望一致。
+ * @note 每次复数 FFT 同时计算两个实数加窗序列的频谱，K 个窗只需 K/2 次 FFT。
+ */
+void multitaper_estimate(const float *x, complex_t *work, complex_t *eigen_store,
+                         multitaper_weighting_t weighting, float *magnitudes);
+
+#endif /* INC_MULTITAPER_H_ */
@@ -0,0 +1,44 @@
+#ifndef INC_OCCUPANCY_H_ // 防止头文件重复包含
+#define INC_OCCUPANCY_H_
+
+#include <stdint.h>
+#include "fft.h" // FFT_N
+
+#define OCCUPANCY_BINS (FFT_N / 2) // 统计的频点数
+
+// 逐频点占用度统计 (长时间干扰普查，只累计计数和最大值，不保存频谱)
+typedef struct
+{
+    uint32_t frames;                       // 已累计的帧数
+    float threshold;                       // 占用判定门限 (线性幅度，与 fft_magnitudes 同单位)
+    uint32_t above_count[OCCUPANCY_BINS];  // 各频点超过门限的帧数
+    float max_level[OCCUPANCY_BINS];       // 各频点出现过的最大幅度 (线性)
+} occupancy_t;
+
+/**
+ * @brief 清空统计并设置门限。
+ * @param occupancy: 指向统计结构的指针。
+ * @param threshold_db: 门限 (dB，0 dB 对应幅度 1.0 的频点)。
+ */
+void occupancy_reset(occupancy_t *occupancy, float threshold_db);
+
+/**
+ * @brief 用一帧幅度谱更新各频点计数和最大值。
+ * @param occupancy: 指向统计结构的指针。
+ * @param magnitudes: 线性幅度谱 (大小为 OCCUPANCY_BINS)。
+ * @note 门限比较在线性域进行，每帧不做对数运算。
+ */
+void occupancy_update(occupancy_t *occupancy, const float *magnitudes);
+
+/**
+ * @brief 频点的占空比 (超过门限的帧数 / 总帧数)。
+ * @return 0.0 ~ 1.0，尚未累计任何帧时返回 0。
+ */
+float occupancy_duty_cycle(const occupancy_t *occupancy, uint32_t bin);
+
+/**
+ * @brief 频点的最大电平 (dB)。
+ */
+float occupancy_max_db(const occupancy_t *occupancy, uint32_t bin);
+
+#endif /* INC_OCCUPANCY_H_ */
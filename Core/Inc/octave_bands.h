@@ -0,0 +1,54 @@
+#ifndef INC_OCTAVE_BANDS_H_ // 防止头文件重复包含
+#define INC_OCTAVE_BANDS_H_
+
+#include <stdint.h>
+#include "fft.h" // FFT_N
+
+// 单个计划支持的最大频带数 (1/6 倍频程覆盖 20Hz ~ 20kHz 约 60 个)
+#define OCTAVE_MAX_BANDS 64
+
+// 频率计权类型 (IEC 61672)
+typedef enum
+{
+    FREQ_WEIGHTING_Z = 0, // 不计权 (平坦)
+    FREQ_WEIGHTING_A,     // A 计权
+    FREQ_WEIGHTING_C      // C 计权
+} freq_weighting_t;
+
+// 分数倍频程频带计划: 频点 -> 频带索引表 + 每个频点的计权系数
+// 计划只依赖 (n, 采样率, 分数, 计权)，参数变化时重建即可
+typedef struct
+{
+    uint32_t n;                                // FFT 点数
+    float sample_rate;                         // 采样频率 (Hz)
+    uint32_t fraction;                         // 倍频程分数: 1, 3 或 6
+    freq_weighting_t weighting;                // 频率计权
+    uint32_t num_bands;                        // 有效频带数
+    uint16_t band_start[OCTAVE_MAX_BANDS + 1]; // 第 i 个频带包含频点 [band_start[i], band_start[i+1])
+    float center_freq[OCTAVE_MAX_BANDS];       // 频带中心频率 (Hz)
+    float bin_weight[FFT_N / 2];               // 每个频点的功率计权系数 (线性)
+} octave_plan_t;
+
+/**
+ * @brief 构建分数倍频程频带计划 (频点 -> 频带索引表和计权系数表)。
+ * @param plan: 指向计划结构体的指针。
+ * @param n: FFT 的大小 (<= FFT_N)。
+ * @param sample_rate: 采样频率 (Hz)。
+ * @param fraction: 倍频程分数，1 (倍频程)、3 (1/3 倍频程) 或 6 (1/6 倍频程)。
+ * @param weighting: 频率计权类型。
+ * @return 有效频带数，参数无效时返回 0。
+ * @note 中心频率按 IEC 61260 以 10 为底的序列生成 (1 kHz 为基准)，
+ *       宽度小于一个频点间隔的低频频带会被跳过，保证每个频带至少包含一个频点。
+ */
+uint32_t octave_plan_init(octave_plan_t *plan, uint32_t n, float sample_rate,
+                          uint32_t fraction, freq_weighting_t weighting);
+
+/**
+ * @brief 将 FFT 幅度聚合为分数倍频程频带声级，计权在同一次遍历中完成。
+ * @param plan: 已构建的频带计划。
+ * @param magnitudes: fft_calculate_magnitudes 的输出 (大小为 n / 2，已除以 n)。
+ * @param band_levels_db: 输出各频带的有效值声级 (dB，相对 1.0 RMS)，大小为 plan->num_bands。
+ */
+void octave_bands_compute(const octave_plan_t *plan, const float *magnitudes, float *band_levels_db);
+
+#endif /* INC_OCTAVE_BANDS_H_ */
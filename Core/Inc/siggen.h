@@ -0,0 +1,111 @@
+#ifndef INC_SIGGEN_H_ // 防止头文件重复包含
+#define INC_SIGGEN_H_
+
+#include <stdint.h>
+#include "dds.h" // dds_oscillator_t, dds_sin
+
+#define SIGGEN_MAX_TONES 8          // 多音信号最多的正弦分量数
+#define SIGGEN_ZIGGURAT_LAYERS 128  // Ziggurat 层数 (需与 gen_ziggurat_tables.py 一致)
+
+// 存放于 Flash 的 Ziggurat 表 (ziggurat_tables.c)
+extern const uint32_t siggen_ziggurat_k[SIGGEN_ZIGGURAT_LAYERS];
+extern const float siggen_ziggurat_w[SIGGEN_ZIGGURAT_LAYERS];
+extern const float siggen_ziggurat_f[SIGGEN_ZIGGURAT_LAYERS];
+
+// 波形类型
+typedef enum
+{
+    SIGGEN_SINE = 0,       // 正弦 (freq)
+    SIGGEN_SQUARE,         // 方波 (freq，PolyBLEP 限带)
+    SIGGEN_TRIANGLE,       // 三角波 (freq，PolyBLAMP 限带)
+    SIGGEN_SAW,            // 锯齿波 (freq，PolyBLEP 限带)
+    SIGGEN_MULTITONE,      // 多音叠加 (tone_freqs / tone_amps)
+    SIGGEN_CHIRP_LINEAR,   // 线性扫频 freq -> freq2，时长 sweep_time，循环
+    SIGGEN_CHIRP_LOG,      // 对数 (指数) 扫频 freq -> freq2，时长 sweep_time，循环
+    SIGGEN_AM,             // 调幅: 载波 freq，调制频率 freq2，调制深度 depth (0 ~ 1)
+    SIGGEN_FM,             // 调频: 载波 freq，调制频率 freq2，频偏 depth (Hz)
+    SIGGEN_NOISE_WHITE,    // 均匀分布白噪声 (峰值 amplitude)
+    SIGGEN_NOISE_PINK,     // 粉红噪声 (-3 dB/倍频程，RMS 约为 amplitude)
+    SIGGEN_NOISE_GAUSSIAN  // 高斯白噪声 (标准差 amplitude)
+} siggen_waveform_t;
+
+// 发生器配置
+typedef struct
+{
+    siggen_waveform_t waveform;
+    float freq;        // 基频、载波频率或扫频起点 (Hz)
+    float freq2;       // 扫频终点或调制频率 (Hz)
+    float depth;       // AM 调制深度或 FM 频偏 (Hz)
+    float sweep_time;  // 扫频时长 (s)
+    float amplitude;   // 幅度 (多音时为各分量幅度的公共缩放)
+    float offset;      // 直流偏移
+    uint32_t num_tones;
+    float tone_freqs[SIGGEN_MAX_TONES];
+    float tone_amps[SIGGEN_MAX_TONES];
+} siggen_config_t;
+
+// 发生器状态 (所有相位和噪声状态跨帧保持，连续调用 siggen_generate 得到连续的信号)
+typedef struct
+{
+    siggen_waveform_t waveform;
+    float amplitude;
+    float offset;
+    float depth;                          // AM 调制深度
+    dds_oscillator_t carrier;             // 主振荡器 (正弦、限带波形、载波、扫频)
+    dds_oscillator_t modulator;           // 调制振荡器 (AM/FM)
+    int32_t fm_deviation_step;            // FM 频偏对应的相位增量
+    float chirp_step;                     // 扫频当前的相位增量 (浮点，便于线性/指数更新)
+    float chirp_start_step;               // 扫频起点的相位增量
+    float chirp_increment;                // 线性扫频每个采样的增量变化
+    float chirp_ratio;                    // 对数扫频每个采样的增量比
+    uint32_t sweep_position;              // 当前扫频周期内的采样位置
+    uint32_t sweep_length;                // 扫频周期 (采样数)
+    uint32_t num_tones;
+    uint32_t tone_phase[SIGGEN_MAX_TONES];
+    uint32_t tone_step[SIGGEN_MAX_TONES];
+    float tone_amp[SIGGEN_MAX_TONES];
+    float tone_cos[SIGGEN_MAX_TONES];     // 多音递推的每采样旋转系数
+    float tone_sin[SIGGEN_MAX_TONES];
+    uint32_t rng_state;                   // xorshift32 状态 (非零)
+    float pink_state[7];                  // 粉红噪声滤波器状态
+} siggen_t;
+
+/**
+ * @brief 初始化发生器 (正弦波，相位清零)。
+ * @param gen: 指向发生器的指针。
+ * @param seed: 噪声随机数种子 (0 时使用默认种子)。
+ */
+void siggen_init(siggen_t *gen, uint32_t seed);
+
+/**
+ * @brief 应用配置，保持各振荡器相位 (参数变化处波形连续)；波形类型改变时扫频从起点开始。
+ * @param gen: 指向发生器的指针。
+ * @param config: 配置。
+ * @param sample_rate: 采样频率 (Hz)。
+ * @return 1: 配置有效; 0: 频率超出 (0, sample_rate / 2)、扫频参数或分量数无效 (发生器保持原配置)。
+ */
+uint8_t siggen_configure(siggen_t *gen, const siggen_config_t *config, float sample_rate);
+
+/**
+ * @brief 生成 len 个采样。
+ * @param gen: 指向发生器的指针。
+ * @param buffer: 输出缓冲区 (长度为 len)。
+ * @param len: 采样点数。
+ * @note 按波形类型选择一个紧凑的块循环 (循环内不再按类型分支)，状态保存在局部变量中，
+ *       每个采样只需整数相位累加和查表，不调用 libm (对数扫频每块只调用一次 powf)。
+ */
+void siggen_generate(siggen_t *gen, float *buffer, uint32_t len);
+
+/**
+ * @brief xorshift32 伪随机数 (周期 2^32 - 1)。
+ * @param state: 随机数状态 (非零)。
+ */
+uint32_t siggen_xorshift32(uint32_t *state);
+
+/**
+ * @brief 标准正态分布采样 (Ziggurat，约 99% 的情况只需一次随机数、一次比较和一次乘法)。
+ * @param state: xorshift32 状态。
+ */
+float siggen_gaussian(uint32_t *state);
+
+#endif /* INC_SIGGEN_H_ */
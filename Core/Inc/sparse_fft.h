@@ -0,0 +1,41 @@
+#ifndef INC_SPARSE_FFT_H_ // 防止头文件重复包含
+#define INC_SPARSE_FFT_H_
+
+#include <stdint.h>
+#include "fft.h" // complex_t, fft_radix2
+
+#define SPARSE_FFT_MAX_PEAKS 8       // 最多恢复的峰值个数
+#define SPARSE_FFT_MAX_CANDIDATES 16 // 每轮最多检验的候选桶数
+#define SPARSE_FFT_MAX_ROUNDS 4      // 最多哈希轮数 (每轮更换抽取间隔并剥离已恢复的分量)
+
+// 按下标取一个时域采样 (n 可达 n_eff 左右)，由调用者提供，无需 n_eff 大小的缓冲区
+typedef float (*sparse_fft_sample_fn)(uint32_t n, void *context);
+
+// 恢复出的单个频率分量
+typedef struct
+{
+    float frequency; // 归一化频率 (周期/采样，0 ~ 0.5)
+    float amplitude; // 实正弦幅度
+    float phase;     // 采样 0 处的相位 (rad，余弦相位)
+} sparse_fft_peak_t;
+
+/**
+ * @brief 稀疏 FFT: 以 n_eff 点 FFT 的分辨率恢复少数几个主要频率分量，只读取 O(B log(n_eff / B)) 个采样。
+ *        每轮以间隔 L 抽取 B 个采样 (频率按 L*f mod 1 哈希到 B 个桶)，在若干 2 的幂延迟上重复抽取，
+ *        由各延迟间的相位差逐级解出桶内唯一分量的频率，并由幅度一致性检验桶内是否只有一个分量。
+ *        已恢复的分量在后续轮次中从采样中剥离，更换 L 后重新哈希以分开此前碰撞的分量。
+ * @param sample: 采样函数。
+ * @param context: 传给采样函数的用户数据。
+ * @param n_eff: 等效 FFT 点数 (2 的幂，>= 4 * buckets)，决定频率分辨率。
+ * @param buckets: 桶数 B (2 的幂，<= 512)。
+ * @param work: 工作缓冲区 (大小为 2 * buckets)。
+ * @param max_peaks: 最多返回的峰值个数 (<= SPARSE_FFT_MAX_PEAKS)。
+ * @param peaks: 输出峰值列表，按幅度降序排列 (不含直流)。
+ * @return 恢复出的峰值个数，参数无效时返回 0。
+ * @note 两个实延迟序列打包进一次复数 FFT，每个延迟对只需一次 B 点 FFT。
+ */
+uint32_t sparse_fft_find_peaks(sparse_fft_sample_fn sample, void *context, uint32_t n_eff,
+                               uint32_t buckets, complex_t *work, uint32_t max_peaks,
+                               sparse_fft_peak_t *peaks);
+
+#endif /* INC_SPARSE_FFT_H_ */
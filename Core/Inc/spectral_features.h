@@ -0,0 +1,57 @@
+#ifndef INC_SPECTRAL_FEATURES_H_ // 防止头文件重复包含
+#define INC_SPECTRAL_FEATURES_H_
+
+#include <stdint.h>
+#include "fft.h" // FFT_N
+
+#define SPECTRAL_NUM_BANDS 4       // 频带能量比的频带个数
+#define SPECTRAL_ROLLOFF_BLOCKS 32 // 滚降点粗定位使用的频点块数
+
+// 每帧的标量频谱描述符 (作为二进制记录直接发送，只包含 float)
+typedef struct
+{
+    float centroid;                       // 谱质心 (Hz)
+    float spread;                         // 谱展宽 (标准差，Hz)
+    float skewness;                       // 谱偏度
+    float rolloff;                        // 滚降频率 (Hz)
+    float flatness;                       // 谱平坦度 (几何均值 / 算术均值，0 ~ 1)
+    float crest;                          // 谱峰值因子 (最大值 / 均值)
+    float flux;                           // 与上一帧幅度谱的欧氏距离
+    float energy;                         // 总能量 (功率和)
+    float band_ratio[SPECTRAL_NUM_BANDS]; // 各频带能量占总能量的比例
+} spectral_descriptors_t;
+
+// 描述符引擎状态 (保存上一帧幅度谱用于计算谱通量)
+typedef struct
+{
+    uint32_t n;                                 // FFT 点数
+    float sample_rate;                          // 采样频率 (Hz)
+    float rolloff_fraction;                     // 滚降点能量比例 (典型值 0.85)
+    uint16_t band_edges[SPECTRAL_NUM_BANDS + 1]; // 频带边界 (频点)
+    uint8_t has_previous;                       // 是否已有上一帧
+    float previous[FFT_N / 2];                  // 上一帧幅度谱
+} spectral_state_t;
+
+/**
+ * @brief 初始化描述符引擎。
+ * @param state: 指向状态结构体的指针。
+ * @param n: FFT 的大小 (<= FFT_N)。
+ * @param sample_rate: 采样频率 (Hz)。
+ * @param rolloff_fraction: 滚降点能量比例 (0 ~ 1)。
+ * @param band_edges_hz: 频带能量比的内部分界频率 (SPECTRAL_NUM_BANDS - 1 个，升序)。
+ */
+void spectral_descriptors_init(spectral_state_t *state, uint32_t n, float sample_rate,
+                               float rolloff_fraction, const float *band_edges_hz);
+
+/**
+ * @brief 在一次遍历中计算全部描述符，并用当前帧更新上一帧幅度谱。
+ * @param state: 描述符引擎状态。
+ * @param magnitudes: fft_calculate_magnitudes 的输出 (大小为 n / 2)。
+ * @param out: 输出描述符。
+ * @note 滚降点先在遍历中累计每个频点块的能量，遍历结束后只在命中的块内细化，
+ *       因此不需要第二次完整遍历。
+ */
+void spectral_descriptors_compute(spectral_state_t *state, const float *magnitudes,
+                                  spectral_descriptors_t *out);
+
+#endif /* INC_SPECTRAL_FEATURES_H_ */
@@ -0,0 +1,80 @@
+#ifndef INC_SPECTRAL_MASK_H_ // 防止头文件重复包含
+#define INC_SPECTRAL_MASK_H_
+
+#include <stdint.h>
+#include "fft.h" // complex_t, FFT_N
+
+#define MASK_BINS (FFT_N / 2)  // 限值线的频点数
+#define MASK_DB_FLOOR -120.0f  // 编码 0 对应的限值 (dB，0 dB 对应幅度 1.0 的频点)
+#define MASK_DB_STEP 0.5f      // 编码步长 (dB)，可表示 -120 ~ +7 dB
+#define MASK_CODE_MAX 0xFEu    // 最大有效编码
+#define MASK_CODE_NONE 0xFFu   // 不检查该频点
+
+// 频率模板 (限值线): 每频点 1 字节对数编码，比较时由两张 16 项的表相乘还原线性限值，不做对数运算
+typedef struct
+{
+    uint8_t codes[MASK_BINS]; // 各频点限值编码 (MASK_CODE_NONE 表示不检查)
+    float coarse[16];         // 编码高 4 位对应的线性幅度 (8 dB 步进)
+    float fine[16];           // 编码低 4 位对应的线性倍数 (0.5 dB 步进)
+} spectral_mask_t;
+
+// 单帧模板比较结果
+typedef struct
+{
+    uint32_t violations; // 超过限值的频点数
+    uint32_t worst_bin;  // 超限最多的频点
+    float worst_ratio;   // 该频点幅度与限值之比 (线性，> 1 表示超限)
+} mask_result_t;
+
+/**
+ * @brief 建立还原表并清空限值线 (所有频点不检查)。
+ * @param mask: 指向频率模板的指针。
+ */
+void spectral_mask_init(spectral_mask_t *mask);
+
+/**
+ * @brief dB 值编码为限值编码 (四舍五入并限幅到 0 ~ MASK_CODE_MAX)。
+ */
+uint8_t spectral_mask_encode(float db);
+
+/**
+ * @brief 在频点区间 [first, last] 上按 dB 线性插值写入限值。
+ * @param mask: 指向频率模板的指针。
+ * @param first: 起始频点。
+ * @param last: 终止频点 (>= first，超出 MASK_BINS - 1 时截断)。
+ * @param db_first: 起始频点的限值 (dB)。
+ * @param db_last: 终止频点的限值 (dB)。
+ */
+void spectral_mask_set_segment(spectral_mask_t *mask, uint32_t first, uint32_t last, float db_first, float db_last);
+
+/**
+ * @brief 直接写入一段限值编码 (主机逐频点上传)。
+ * @param mask: 指向频率模板的指针。
+ * @param first: 起始频点。
+ * @param codes: 编码 (MASK_CODE_NONE 表示不检查)。
+ * @param count: 编码个数 (超出 MASK_BINS 的部分丢弃)。
+ */
+void spectral_mask_set_codes(spectral_mask_t *mask, uint32_t first, const uint8_t *codes, uint32_t count);
+
+/**
+ * @brief 频点的限值 (dB)。
+ * @return 限值 (dB)；该频点不检查时返回 0 并把 *enabled 置 0。
+ */
+float spectral_mask_limit_db(const spectral_mask_t *mask, uint32_t bin, uint8_t *enabled);
+
+/**
+ * @brief 由 FFT 结果计算幅度 (与 fft_calculate_magnitudes 相同) 并在同一次遍历中与限值线比较。
+ * @param mask: 指向频率模板的指针。
+ * @param spectrum: FFT_N 点 FFT 的输出。
+ * @param magnitudes: 输出幅度 (大小为 MASK_BINS)。
+ * @param result: 输出比较结果。
+ */
+void spectral_mask_check_spectrum(const spectral_mask_t *mask, const complex_t *spectrum, float *magnitudes,
+                                  mask_result_t *result);
+
+/**
+ * @brief 用已经算好的幅度谱与限值线比较 (用于多窗等其他频谱估计方法)。
+ */
+void spectral_mask_check(const spectral_mask_t *mask, const float *magnitudes, mask_result_t *result);
+
+#endif /* INC_SPECTRAL_MASK_H_ */
@@ -0,0 +1,69 @@
+#ifndef INC_SPECTRUM_CACHE_H_ // 防止头文件重复包含
+#define INC_SPECTRUM_CACHE_H_
+
+#include <stdint.h>
+#include "fft.h" // FFT_N
+
+#define SPECTRUM_CACHE_ENTRIES 2            // 缓存条目数 (每条约 1 KB，RAM 已接近用满)
+#define SPECTRUM_CACHE_BINS (FFT_N / 2)     // 每条目保存的频点数
+#define SPECTRUM_CACHE_DB_STEP 0.005f       // 幅度编码步长 (dB)，相对误差约 0.03%
+#define SPECTRUM_CACHE_DB_FLOOR -200.0f     // 编码下限 (dB)，可表示 -200 ~ +127 dB
+
+// 缓存键: 决定频谱结果的全部参数
+typedef struct
+{
+    float freq;            // 信号频率 (Hz)
+    float amplitude;       // 信号幅度
+    float offset;          // 直流偏移
+    float sample_rate;     // 采样频率 (Hz)
+    uint32_t waveform;     // 波形类型
+    uint32_t config_hash;  // 其余发生器参数 (调制、多音等) 的散列
+    uint32_t estimator;    // 频谱估计方法 (同时决定窗函数) 及其参数
+} spectrum_cache_key_t;
+
+// 缓存条目: 幅度谱以 uint16 对数编码保存 (每条目 1 KB，是 float 的一半)
+typedef struct
+{
+    spectrum_cache_key_t key;
+    uint32_t last_used;                              // 最近一次使用的序号 (LRU)
+    uint8_t valid;
+    uint16_t magnitudes[SPECTRUM_CACHE_BINS];
+} spectrum_cache_entry_t;
+
+typedef struct
+{
+    spectrum_cache_entry_t entries[SPECTRUM_CACHE_ENTRIES];
+    uint32_t clock;  // 使用序号计数器
+    uint32_t hits;
+    uint32_t misses;
+} spectrum_cache_t;
+
+/**
+ * @brief 清空缓存和命中统计。
+ * @param cache: 指向缓存的指针。
+ */
+void spectrum_cache_clear(spectrum_cache_t *cache);
+
+/**
+ * @brief 查找缓存，命中时解码幅度谱并更新 LRU 顺序。
+ * @param cache: 指向缓存的指针。
+ * @param key: 缓存键。
+ * @param magnitudes: 命中时输出线性幅度谱 (大小为 SPECTRUM_CACHE_BINS)。
+ * @return 1: 命中; 0: 未命中 (magnitudes 不变)。
+ */
+uint8_t spectrum_cache_lookup(spectrum_cache_t *cache, const spectrum_cache_key_t *key, float *magnitudes);
+
+/**
+ * @brief 保存一条结果，缓存已满时替换最久未使用的条目。
+ * @param cache: 指向缓存的指针。
+ * @param key: 缓存键。
+ * @param magnitudes: 线性幅度谱 (大小为 SPECTRUM_CACHE_BINS)。
+ */
+void spectrum_cache_store(spectrum_cache_t *cache, const spectrum_cache_key_t *key, const float *magnitudes);
+
+/**
+ * @brief 计算一块数据的 FNV-1a 散列 (用于把结构体参数压缩进缓存键)。
+ */
+uint32_t spectrum_cache_hash(const void *data, uint32_t len);
+
+#endif /* INC_SPECTRUM_CACHE_H_ */
@@ -0,0 +1,40 @@
+#ifndef INC_SWEEP_H_ // 防止头文件重复包含
+#define INC_SWEEP_H_
+
+#include <stdint.h>
+
+#define SWEEP_MAX_POINTS 256       // 一次扫频最多的频点数
+#define SWEEP_MIN_BINS_PER_FRAME 2 // 单帧测量要求的最低频率 (以 FFT 频点间隔计)，低于此值镜像泄漏明显
+
+// 扫频测量的单个频点结果
+typedef struct
+{
+    float freq;         // 激励频率 (Hz)
+    float magnitude_db; // 响应幅度相对激励幅度 (dB)
+    float phase_deg;    // 响应相位相对激励相位 (度，-180 ~ 180)
+} sweep_point_t;
+
+/**
+ * @brief 第 index 个扫频点的频率。
+ * @param start: 起始频率 (Hz)。
+ * @param stop: 终止频率 (Hz)。
+ * @param points: 频点数 (1 时只有起始频率)。
+ * @param index: 频点序号 (0 ~ points - 1)。
+ * @param logarithmic: 1: 对数 (等比) 间隔; 0: 线性间隔。
+ */
+float sweep_frequency(float start, float stop, uint32_t points, uint32_t index, uint8_t logarithmic);
+
+/**
+ * @brief 测量一帧信号中指定频率分量的幅度和相位 (加 Hann 窗的正交相关，即单频点 DFT)。
+ * @param samples: 时域采样。
+ * @param len: 采样点数。
+ * @param freq: 被测频率 (Hz)，不必落在 FFT 频点上。
+ * @param sample_rate: 采样频率 (Hz)。
+ * @param amplitude: 输出正弦幅度。
+ * @param phase: 输出第 0 个采样处的余弦相位 (rad)。
+ * @note 参考正弦和窗函数都由 DDS 查表生成，不调用 sinf/cosf；相关前先减去均值。
+ */
+void sweep_measure_tone(const float *samples, uint32_t len, float freq, float sample_rate,
+                        float *amplitude, float *phase);
+
+#endif /* INC_SWEEP_H_ */
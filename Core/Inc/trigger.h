@@ -0,0 +1,70 @@
+#ifndef INC_TRIGGER_H_ // 防止头文件重复包含
+#define INC_TRIGGER_H_
+
+#include <stdint.h>
+
+// 触发条件
+typedef enum
+{
+    TRIGGER_EDGE_RISING = 0, // 电平上升沿: 前一采样 < level <= 当前采样
+    TRIGGER_EDGE_FALLING,    // 电平下降沿: 前一采样 > level >= 当前采样
+    TRIGGER_SLOPE_RISING,    // 正斜率: 相邻采样差值从 < level 变为 >= level (level 单位 V/采样，> 0)
+    TRIGGER_SLOPE_FALLING    // 负斜率: 相邻采样差值从 > -level 变为 <= -level
+} trigger_type_t;
+
+// 触发检测状态 (跨块保持，块边界上的跳变不会漏检)
+typedef struct
+{
+    trigger_type_t type;    // 触发条件
+    float level;            // 触发电平 (V) 或斜率门限 (V/采样)
+    uint32_t pre_samples;   // 预触发采样数: 触发点之前至少要有这么多历史才允许触发
+    uint32_t history;       // 布防以来连续检查过的采样数
+    float last_sample;      // 上一块最后一个采样
+    float last_slope;       // 上一块最后一个差值
+} trigger_t;
+
+/**
+ * @brief 布防: 设置触发条件并清空历史。
+ * @param trig: 指向触发状态的指针。
+ * @param type: 触发条件。
+ * @param level: 触发电平 (V) 或斜率门限 (V/采样)。
+ * @param pre_samples: 预触发采样数 (< 捕获长度)。
+ */
+void trigger_arm(trigger_t *trig, trigger_type_t type, float level, uint32_t pre_samples);
+
+/**
+ * @brief 历史不连续时 (丢块或缓冲区被其他功能占用) 重新开始积累预触发历史，触发条件不变。
+ */
+void trigger_restart(trigger_t *trig);
+
+/**
+ * @brief 在新到达的一块采样上检查触发条件。
+ * @param trig: 指向触发状态的指针。
+ * @param block: 采样块 (紧接上一次检查的块)。
+ * @param len: 采样点数。
+ * @return 块内第一个触发点的下标；没有触发 (或预触发历史不足) 时返回 -1。
+ * @note 每个采样只做一次比较，布防期间的开销只有这一遍扫描。
+ */
+int32_t trigger_scan(trigger_t *trig, const float *block, uint32_t len);
+
+/**
+ * @brief 从两块环形缓冲区中取出以触发点为基准的捕获窗口。
+ * @param ring: 环形缓冲区 (2 * block_len 个采样，第 b 块位于 [(b & 1) * block_len, ...))。
+ * @param block_len: 每块采样数。
+ * @param trigger_block: 触发点所在块的序号。
+ * @param trigger_index: 触发点在块内的下标。
+ * @param pre_samples: 触发点之前的采样数。
+ * @param output: 输出窗口 (长度为 block_len，触发点位于 output[pre_samples])。
+ * @note 触发点之后不足 block_len - pre_samples 个采样时须等下一块写入环形缓冲区后再调用
+ *       (见 trigger_needs_next_block)；窗口只跨越相邻两块，两块环形缓冲区足够。
+ */
+void trigger_extract(const float *ring, uint32_t block_len, uint32_t trigger_block, uint32_t trigger_index,
+                     uint32_t pre_samples, float *output);
+
+/**
+ * @brief 捕获窗口是否延伸到触发块的下一块。
+ * @return 1: 需要等下一块; 0: 触发块和前一块已足够。
+ */
+uint8_t trigger_needs_next_block(uint32_t trigger_index, uint32_t pre_samples);
+
+#endif /* INC_TRIGGER_H_ */
@@ -0,0 +1,51 @@
+#ifndef INC_WAVELET_H_ // 防止头文件重复包含
+#define INC_WAVELET_H_
+
+#include <stdint.h>
+
+#define WAVELET_MAX_LEVELS 10 // 支持的最大分解层数
+
+// 小波类型 (均以提升格式实现)
+typedef enum
+{
+    WAVELET_HAAR = 0, // Haar，正交，2 个采样即可分解
+    WAVELET_DB4,      // Daubechies-4 (4 抽头)，正交，周期延拓
+    WAVELET_CDF97     // CDF 9/7 (JPEG2000)，双正交，对称延拓
+} wavelet_type_t;
+
+// 单层系数统计
+typedef struct
+{
+    float energy;           // 该层系数平方和
+    float peak;             // 该层系数绝对值的最大值
+    uint32_t peak_position; // 峰值系数对应的输入采样位置
+    uint32_t crossings;     // |系数| 由阈值以下越过阈值的次数 (瞬态事件数)
+} wavelet_level_stats_t;
+
+/**
+ * @brief 多层正向离散小波变换，提升格式，原地完成，无额外缓冲区。
+ *        系数保持交错存放: 第 j 层 (1 起) 细节系数位于 x[2^(j-1) + k * 2^j]，
+ *        最后一层的近似系数位于 x[k * 2^levels]。
+ * @param x: 输入/输出数据 (长度为 n)。
+ * @param n: 数据长度 (2 的幂)。
+ * @param type: 小波类型。
+ * @param levels: 请求的分解层数。
+ * @return 实际分解层数 (受 WAVELET_MAX_LEVELS 和 n 限制，每层至少保留 2 (Haar) 或 4 个近似系数)，
+ *         参数无效时返回 0。
+ * @note 每层代价为 O(当前长度)，总代价 O(n)。Haar 和 Daubechies-4 为正交变换，各层能量之和等于输入能量。
+ */
+uint32_t wavelet_forward(float *x, uint32_t n, wavelet_type_t type, uint32_t levels);
+
+/**
+ * @brief 一次遍历交错存放的系数，统计各层能量、峰值和阈值越过次数。
+ * @param x: wavelet_forward 的输出 (长度为 n)。
+ * @param n: 数据长度。
+ * @param levels: wavelet_forward 返回的实际层数。
+ * @param threshold: 细节系数的绝对阈值 (正交小波下与输入采样同单位)。
+ * @param stats: 输出统计 (大小为 levels + 1)，stats[j-1] 为第 j 层细节，stats[levels] 为近似系数
+ *               (近似系数不统计越过次数)。
+ */
+void wavelet_analyze(const float *x, uint32_t n, uint32_t levels, float threshold,
+                     wavelet_level_stats_t *stats);
+
+#endif /* INC_WAVELET_H_ */
@@ -26,6 +26,7 @@
 #include <stdio.h>  // 用于 sprintf, sscanf
 #include <string.h> // 用于 strncmp, strlen
 #include <stdlib.h> // 用于 atof (如果使用)
+#include <ctype.h>  // 用于 isxdigit
 /* USER CODE END INCLUDE */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -383,8 +384,7 @@ static void Process_CDC_Data(uint8_t *Buf, uint32_t Len)
     if (parsed_count == 3) // 确保成功解析了 3 个参数
     {
       // 调用 main.c 中的函数更新参数 - 添加有效性检查
-      if (freq > 0.0f && amp > 0.0f) {
-        Update_Signal_Parameters(freq, amp, offset);
+      if (freq > 0.0f && amp > 0.0f && Update_Signal_Parameters(freq, amp, offset)) {
         
         // 发送确认参数更新消息
         sprintf(cdc_if_tx_buffer, "UPDATED:F=%0.2f,A=%0.2f,O=%0.2f\r\n", freq, amp, offset);
@@ -412,6 +412,467 @@ static void Process_CDC_Data(uint8_t *Buf, uint32_t Len)
       CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
     }
   }
+  // "GCC:<时延>" 执行一次双通道 GCC-PHAT 时延估计
+  else if (strncmp((char *)Buf, "GCC:", 4) == 0)
+  {
+    float delay = 0.0f;
+    if (sscanf((char *)Buf + 4, "%f", &delay) == 1 && Request_GCC_PHAT(delay))
+    {
+      sprintf(cdc_if_tx_buffer, "ACK_GCC:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid GCC format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "PITCH:<最低基频>,<最高基频>" 执行一次自相关周期检测
+  else if (strncmp((char *)Buf, "PITCH:", 6) == 0)
+  {
+    float min_freq = 0.0f, max_freq = 0.0f;
+    if (sscanf((char *)Buf + 6, "%f,%f", &min_freq, &max_freq) == 2)
+    {
+      Request_Pitch_Detection(min_freq, max_freq);
+      sprintf(cdc_if_tx_buffer, "ACK_PITCH:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid PITCH format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "OCT:<分数>,<计权>" 切换到倍频程频带输出，"OCT:0" 恢复逐频点输出
+  else if (strncmp((char *)Buf, "OCT:", 4) == 0)
+  {
+    unsigned long fraction = 0;
+    char weighting = 'Z';
+    if (sscanf((char *)Buf + 4, "%lu,%c", &fraction, &weighting) >= 1 &&
+        Set_Octave_Mode((uint32_t)fraction, weighting))
+    {
+      sprintf(cdc_if_tx_buffer, "ACK_OCT:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid OCT format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "SLM:<间隔ms>" 开启声级计并按间隔上报，"SLM:0" 关闭
+  else if (strncmp((char *)Buf, "SLM:", 4) == 0)
+  {
+    unsigned long interval_ms = 0;
+    if (sscanf((char *)Buf + 4, "%lu", &interval_ms) == 1)
+    {
+      Set_Level_Meter_Interval((uint32_t)interval_ms);
+      sprintf(cdc_if_tx_buffer, "ACK_SLM:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid SLM format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "MFCC:<系数个数>,<滤波器个数>,<下限Hz>,<上限Hz>" 连续输出 MFCC 二进制帧，"MFCC:0" 恢复逐频点输出
+  else if (strncmp((char *)Buf, "MFCC:", 5) == 0)
+  {
+    unsigned long num_coeffs = 0, num_filters = 26;
+    float f_low = 0.0f, f_high = 8000.0f;
+    if (sscanf((char *)Buf + 5, "%lu,%lu,%f,%f", &num_coeffs, &num_filters, &f_low, &f_high) >= 1 &&
+        Set_MFCC_Mode((uint32_t)num_coeffs, (uint32_t)num_filters, f_low, f_high))
+    {
+      sprintf(cdc_if_tx_buffer, "ACK_MFCC:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid MFCC format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "DESC:<滚降比例>" 连续输出频谱描述符二进制帧，"DESC:0" 恢复逐频点输出
+  else if (strncmp((char *)Buf, "DESC:", 5) == 0)
+  {
+    float rolloff = 0.0f;
+    if (sscanf((char *)Buf + 5, "%f", &rolloff) == 1 && Set_Descriptor_Mode(rolloff))
+    {
+      sprintf(cdc_if_tx_buffer, "ACK_DESC:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid DESC format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "ENV:<调制频率>,<抽取因子>" 执行一次包络谱分析
+  else if (strncmp((char *)Buf, "ENV:", 4) == 0)
+  {
+    float mod_freq = 0.0f;
+    unsigned long decimation = 8;
+    if (sscanf((char *)Buf + 4, "%f,%lu", &mod_freq, &decimation) >= 1 &&
+        Request_Envelope_Spectrum(mod_freq, (uint32_t)decimation))
+    {
+      sprintf(cdc_if_tx_buffer, "ACK_ENV:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid ENV format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "EST:PG" 周期图，"EST:MT" 多窗等权，"EST:MTA" 多窗自适应加权，
+  // "EST:AR[,<阶数>,<帧长>]" AR 参数谱 (省略参数时沿用当前设置)
+  else if (strncmp((char *)Buf, "EST:", 4) == 0)
+  {
+    uint8_t ok = 0;
+    char *name = (char *)Buf + 4;
+    unsigned long order, frame_len;
+    if (strncmp(name, "AR", 2) == 0)
+    {
+      if (sscanf(name + 2, ",%lu,%lu", &order, &frame_len) == 2)
+      {
+        ok = Set_AR_Estimator((uint32_t)order, (uint32_t)frame_len);
+      }
+      else
+      {
+        ok = Set_Spectrum_Estimator(3);
+      }
+    }
+    else if (strncmp(name, "PG", 2) == 0)
+    {
+      ok = Set_Spectrum_Estimator(0);
+    }
+    else if (strncmp(name, "MTA", 3) == 0)
+    {
+      ok = Set_Spectrum_Estimator(2);
+    }
+    else if (strncmp(name, "MT", 2) == 0)
+    {
+      ok = Set_Spectrum_Estimator(1);
+    }
+    sprintf(cdc_if_tx_buffer, ok ? "ACK_EST:OK\r\n" : "ERR:Invalid EST format\r\n");
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "WAV:<层数>,<H|D|C>,<阈值>" 切换到小波分析引擎并连续发送二进制帧，"WAV:0" 切回 FFT
+  else if (strncmp((char *)Buf, "WAV:", 4) == 0)
+  {
+    unsigned long levels = 0;
+    char wavelet = 'D';
+    float threshold = 0.5f;
+    if (sscanf((char *)Buf + 4, "%lu,%c,%f", &levels, &wavelet, &threshold) >= 1 &&
+        Set_Wavelet_Engine((uint32_t)levels, wavelet, threshold))
+    {
+      sprintf(cdc_if_tx_buffer, "ACK_WAV:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid WAV format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "CQT:<下限Hz>,<上限Hz>" 切换到常数 Q 输出，"CQT:0" 恢复逐频点输出
+  else if (strncmp((char *)Buf, "CQT:", 4) == 0)
+  {
+    float f_low = 0.0f, f_high = 0.0f;
+    if (sscanf((char *)Buf + 4, "%f,%f", &f_low, &f_high) >= 1 &&
+        Set_CQT_Mode(f_low, f_high))
+    {
+      sprintf(cdc_if_tx_buffer, "ACK_CQT:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid CQT format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "SFFT:<等效点数>[,<峰值个数>]" 切换到稀疏 FFT 引擎，"SFFT:0" 切回 FFT
+  else if (strncmp((char *)Buf, "SFFT:", 5) == 0)
+  {
+    unsigned long n_eff = 0, max_peaks = 4;
+    if (sscanf((char *)Buf + 5, "%lu,%lu", &n_eff, &max_peaks) >= 1 &&
+        Set_Sparse_FFT_Mode((uint32_t)n_eff, (uint32_t)max_peaks))
+    {
+      sprintf(cdc_if_tx_buffer, "ACK_SFFT:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid SFFT format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "PFB:P" 信道功率，"PFB:C,<信道>" 单个信道复数样本，"PFB:0" 切回 FFT
+  else if (strncmp((char *)Buf, "PFB:", 4) == 0)
+  {
+    char mode = 0;
+    unsigned long channel = 0;
+    if (sscanf((char *)Buf + 4, "%c,%lu", &mode, &channel) >= 1 &&
+        Set_Channelizer_Mode(mode, (uint32_t)channel))
+    {
+      sprintf(cdc_if_tx_buffer, "ACK_PFB:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid PFB format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "ANOM:LEARN,<帧数>" 学习基线，"ANOM:RUN,<阈值>[,Z|M]" 异常监测，
+  // "ANOM:SAVE" / "ANOM:LOAD" 基线写入/读回 Flash，"ANOM:0" 关闭
+  else if (strncmp((char *)Buf, "ANOM:", 5) == 0)
+  {
+    uint8_t ok = 0;
+    char *arg = (char *)Buf + 5;
+    unsigned long frames = 0;
+    float threshold = 0.0f;
+    char metric = 'Z';
+    if (strncmp(arg, "LEARN", 5) == 0)
+    {
+      ok = (sscanf(arg + 5, ",%lu", &frames) == 1) && Set_Anomaly_Learning((uint32_t)frames);
+    }
+    else if (strncmp(arg, "RUN", 3) == 0)
+    {
+      ok = (sscanf(arg + 3, ",%f,%c", &threshold, &metric) >= 1) && Set_Anomaly_Monitor(threshold, metric);
+    }
+    else if (strncmp(arg, "SAVE", 4) == 0)
+    {
+      ok = Request_Baseline_Storage('S');
+    }
+    else if (strncmp(arg, "LOAD", 4) == 0)
+    {
+      ok = Request_Baseline_Storage('L');
+    }
+    else if (arg[0] == '0')
+    {
+      ok = Set_Anomaly_Learning(0);
+    }
+    sprintf(cdc_if_tx_buffer, ok ? "ACK_ANOM:OK\r\n" : "ERR:Invalid ANOM format\r\n");
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "OCC:START,<门限dB>" 开始占用度统计，"OCC:STOP" 停止，"OCC:?[,<最低占空比%>]" 读取摘要
+  else if (strncmp((char *)Buf, "OCC:", 4) == 0)
+  {
+    uint8_t ok = 0;
+    char *arg = (char *)Buf + 4;
+    float value = 0.0f;
+    if (strncmp(arg, "START", 5) == 0)
+    {
+      ok = (sscanf(arg + 5, ",%f", &value) == 1) && Set_Occupancy_Survey(1, value);
+    }
+    else if (strncmp(arg, "STOP", 4) == 0)
+    {
+      ok = Set_Occupancy_Survey(0, 0.0f);
+    }
+    else if (arg[0] == '?')
+    {
+      sscanf(arg + 1, ",%f", &value);
+      ok = Request_Occupancy_Report(value);
+    }
+    sprintf(cdc_if_tx_buffer, ok ? "ACK_OCC:OK\r\n" : "ERR:Invalid OCC format\r\n");
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "DDS:BENCH" 对比 DDS 与逐点 sinf 生成一帧测试信号的耗时
+  else if (strncmp((char *)Buf, "DDS:BENCH", 9) == 0)
+  {
+    Request_DDS_Benchmark();
+    sprintf(cdc_if_tx_buffer, "ACK_DDS:OK\r\n");
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "GEN:<波形>[,<参数>...]" 选择测试信号波形 (S/Q/T/W/C/L/A/F/M/N/P/G，参数见 Set_Signal_Generator)
+  else if (strncmp((char *)Buf, "GEN:", 4) == 0)
+  {
+    float params[16];
+    uint32_t count = 0;
+    char waveform = (char)Buf[4];
+    char *p = (char *)Buf + 5;
+    while (*p == ',' && count < 16)
+    {
+      char *end;
+      params[count] = strtof(p + 1, &end);
+      if (end == p + 1)
+      {
+        break;
+      }
+      count++;
+      p = end;
+    }
+    if (Set_Signal_Generator(waveform, params, count))
+    {
+      sprintf(cdc_if_tx_buffer, "ACK_GEN:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid GEN format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "CACHE:1" 启用频谱结果缓存，"CACHE:0" 停用 (两者都清空已有条目)
+  else if (strncmp((char *)Buf, "CACHE:", 6) == 0)
+  {
+    if (Buf[6] == '0' || Buf[6] == '1')
+    {
+      Set_Spectrum_Cache((uint8_t)(Buf[6] - '0'));
+      sprintf(cdc_if_tx_buffer, "ACK_CACHE:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid CACHE format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "SWEEP:<起始Hz>,<终止Hz>,<点数>[,LIN|LOG[,<稳定时间ms>]]" 扫频测量幅频/相频响应 (默认对数间隔、不等待)
+  else if (strncmp((char *)Buf, "SWEEP:", 6) == 0)
+  {
+    float start_freq, stop_freq;
+    unsigned long points, dwell_ms = 0;
+    char spacing[4] = "LOG";
+    int parsed = sscanf((char *)Buf + 6, "%f,%f,%lu,%3[A-Z],%lu", &start_freq, &stop_freq, &points, spacing,
+                        &dwell_ms);
+    uint8_t spacing_ok = (strcmp(spacing, "LOG") == 0 || strcmp(spacing, "LIN") == 0);
+    if (parsed >= 3 && spacing_ok &&
+        Request_Frequency_Sweep(start_freq, stop_freq, (uint32_t)points, spacing[1] == 'O', (uint32_t)dwell_ms))
+    {
+      sprintf(cdc_if_tx_buffer, "ACK_SWEEP:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid SWEEP format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "IR:M[,<点数>]" MLS 冲激响应测量，"IR:E[,<点数>[,<起始Hz>,<终止Hz>]]" 指数扫频冲激响应测量
+  else if (strncmp((char *)Buf, "IR:", 3) == 0)
+  {
+    unsigned long taps = 64;
+    float f_low = 200.0f, f_high = 20000.0f;
+    char method = (char)Buf[3];
+    if (Buf[4] == ',')
+    {
+      sscanf((char *)Buf + 5, "%lu,%f,%f", &taps, &f_low, &f_high);
+    }
+    if (Request_Impulse_Response(method, (uint32_t)taps, f_low, f_high))
+    {
+      sprintf(cdc_if_tx_buffer, "ACK_IR:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid IR format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "SRC:ADC" 分析 ADC1 (PA0) 采集的信号，"SRC:GEN" 分析软件信号发生器的输出
+  else if (strncmp((char *)Buf, "SRC:", 4) == 0)
+  {
+    if (strncmp((char *)Buf + 4, "ADC", 3) == 0 || strncmp((char *)Buf + 4, "GEN", 3) == 0)
+    {
+      Set_Acquisition_Source(Buf[4] == 'A');
+      sprintf(cdc_if_tx_buffer, "ACK_SRC:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid SRC format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "RATE:<Hz>" 设置采样频率 (100 ~ 200000)，主循环随后回复 "RATE: requested=... actual=..." 报告实际频率
+  else if (strncmp((char *)Buf, "RATE:", 5) == 0)
+  {
+    float rate = 0.0f;
+    if (sscanf((char *)Buf + 5, "%f", &rate) == 1 && Set_Sample_Rate(rate))
+    {
+      sprintf(cdc_if_tx_buffer, "ACK_RATE:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid RATE format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "SCAN:<通道数>[,M|S]" 多通道扫描 (PA0 起 2 ~ 4 个通道)，M 各通道指标 (默认)，S 各通道幅度谱；"SCAN:0" 恢复单通道
+  else if (strncmp((char *)Buf, "SCAN:", 5) == 0)
+  {
+    unsigned long channels = 0;
+    char output = 'M';
+    if (sscanf((char *)Buf + 5, "%lu,%c", &channels, &output) >= 1 &&
+        Set_Scan_Mode((uint32_t)channels, output))
+    {
+      sprintf(cdc_if_tx_buffer, "ACK_SCAN:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid SCAN format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "TRIG:<R|F|P|N>,<电平>[,<预触发%>[,A|S]]" 电平/斜率触发捕获 (默认预触发 25%，自动重新布防)；"TRIG:0" 关闭
+  else if (strncmp((char *)Buf, "TRIG:", 5) == 0)
+  {
+    char type = 0;
+    float level = 0.0f;
+    float pre_percent = 25.0f;
+    char mode = 'A';
+    int fields = sscanf((char *)Buf + 5, "%c,%f,%f,%c", &type, &level, &pre_percent, &mode);
+    if (((type == '0' && fields == 1) || fields >= 2) && Set_Trigger_Mode(type, level, pre_percent, mode))
+    {
+      sprintf(cdc_if_tx_buffer, "ACK_TRIG:OK\r\n");
+    }
+    else
+    {
+      sprintf(cdc_if_tx_buffer, "ERR:Invalid TRIG format\r\n");
+    }
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
+  // "MASK:SEG,<起始Hz>,<终止Hz>,<dB>[,<终止dB>]" 写入一段限值线，"MASK:HEX,<起始频点>,<十六进制编码...>" 逐频点上传，
+  // "MASK:CLR" 清空限值线，"MASK:RUN[,A|S]" 开始监测，"MASK:0" 停止，"MASK:?" 读取通过/超限计数
+  else if (strncmp((char *)Buf, "MASK:", 5) == 0)
+  {
+    uint8_t ok = 0;
+    char *arg = (char *)Buf + 5;
+    float values[4];
+    char mode = 'A';
+    if (strncmp(arg, "SEG", 3) == 0)
+    {
+      int fields = sscanf(arg + 3, ",%f,%f,%f,%f", &values[0], &values[1], &values[2], &values[3]);
+      ok = (fields >= 3) && Set_Mask_Segment(values[0], values[1], values[2], (fields == 4) ? values[3] : values[2]);
+    }
+    else if (strncmp(arg, "HEX", 3) == 0)
+    {
+      // 每个频点 2 个十六进制字符，一个 USB 包最多约 24 个频点
+      uint8_t codes[32];
+      uint32_t count = 0;
+      unsigned long first = 0;
+      int offset = 0;
+      if (sscanf(arg + 3, ",%lu,%n", &first, &offset) == 1 && offset > 0)
+      {
+        char *p = arg + 3 + offset;
+        while (count < sizeof(codes) && isxdigit((unsigned char)p[0]) && isxdigit((unsigned char)p[1]))
+        {
+          char pair[3] = {p[0], p[1], 0};
+          codes[count++] = (uint8_t)strtoul(pair, NULL, 16);
+          p += 2;
+        }
+        ok = Set_Mask_Codes((uint32_t)first, codes, count);
+      }
+    }
+    else if (strncmp(arg, "CLR", 3) == 0)
+    {
+      Clear_Mask();
+      ok = 1;
+    }
+    else if (strncmp(arg, "RUN", 3) == 0)
+    {
+      sscanf(arg + 3, ",%c", &mode);
+      ok = Set_Mask_Monitor(mode);
+    }
+    else if (arg[0] == '0')
+    {
+      ok = Set_Mask_Monitor('0');
+    }
+    else if (arg[0] == '?')
+    {
+      Request_Mask_Status();
+      ok = 1;
+    }
+    sprintf(cdc_if_tx_buffer, ok ? "ACK_MASK:OK\r\n" : "ERR:Invalid MASK format\r\n");
+    CDC_Transmit_FS((uint8_t *)cdc_if_tx_buffer, strlen(cdc_if_tx_buffer));
+  }
   // 可以添加其他命令的处理逻辑
 }
 /* USER CODE END PRIVATE_FUNCTIONS_IMPLEMENTATION */
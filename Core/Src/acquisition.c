@@ -0,0 +1,130 @@
+#include "acquisition.h"
+#include <math.h>   // floor
+#include <string.h> // memset
+
+/**
+ * @brief 清空状态并设置通道布局。
+ */
+void acquisition_reset(acquisition_t *acq, uint32_t channels)
+{
+    memset(acq, 0, sizeof(*acq));
+    acq->ready_half = -1;
+
+    if (channels < 1)
+    {
+        channels = 1;
+    }
+    else if (channels > ACQ_MAX_CHANNELS)
+    {
+        channels = ACQ_MAX_CHANNELS;
+    }
+    uint32_t frame_len = ACQ_BLOCK_SIZE;
+    while (channels * frame_len > ACQ_BLOCK_SIZE)
+    {
+        frame_len >>= 1;
+    }
+    acq->channels = channels;
+    acq->frame_len = frame_len;
+    acq->block_len = channels * frame_len;
+}
+
+/**
+ * @brief DMA 写完一半时调用 (中断上下文)。
+ */
+void acquisition_block_complete(acquisition_t *acq, uint32_t half)
+{
+    acq->ready_half = (int32_t)(half & 1u);
+    acq->blocks_completed++;
+}
+
+/**
+ * @brief 丢弃过期的块。
+ */
+void acquisition_drop_stale(acquisition_t *acq)
+{
+    if (acq->blocks_completed != acq->last_taken + 1)
+    {
+        acq->ready_half = -1;
+    }
+}
+
+/**
+ * @brief 取走最近完成的块。
+ */
+const uint16_t *acquisition_take_block(acquisition_t *acq)
+{
+    for (;;)
+    {
+        uint32_t completed = acq->blocks_completed;
+        int32_t half = acq->ready_half;
+        if (half < 0)
+        {
+            return 0;
+        }
+        acq->ready_half = -1;
+        if (acq->blocks_completed == completed)
+        {
+            acq->blocks_taken++;
+            acq->last_taken = completed;
+            return &acq->dma_buffer[(uint32_t)half * acq->block_len];
+        }
+        // 取块期间中断又交出了下一块 (两半交替)，改取最新的一块
+        acq->ready_half = half ^ 1;
+    }
+}
+
+/**
+ * @brief ADC 码值转换为电压。
+ */
+void acquisition_convert(const uint16_t *block, float *output, uint32_t len)
+{
+    const float scale = ACQ_ADC_VREF / ACQ_ADC_FULL_SCALE;
+    for (uint32_t i = 0; i < len; i++)
+    {
+        output[i] = (float)block[i] * scale;
+    }
+}
+
+/**
+ * @brief 从交织块中取出一个通道并转换为电压。
+ */
+void acquisition_convert_channel(const acquisition_t *acq, const uint16_t *block, uint32_t channel, float *output)
+{
+    const float scale = ACQ_ADC_VREF / ACQ_ADC_FULL_SCALE;
+    const uint32_t stride = acq->channels;
+    const uint16_t *src = block + channel;
+    for (uint32_t i = 0; i < acq->frame_len; i++)
+    {
+        output[i] = (float)src[i * stride] * scale;
+    }
+}
+
+/**
+ * @brief 计算采样定时器的分频。
+ */
+float acquisition_timer_divider(uint32_t timer_clock, float rate, uint32_t period_max,
+                                uint32_t *prescaler, uint32_t *period)
+{
+    // 总分频比 = (PSC + 1) * (ARR + 1)，用 double 避免 32 位 ARR 时的舍入误差
+    double ticks = (double)timer_clock / (double)rate;
+
+    double psc = floor(ticks / ((double)period_max + 1.0));
+    if (psc > 65535.0)
+    {
+        psc = 65535.0;
+    }
+
+    double arr = floor(ticks / (psc + 1.0) + 0.5) - 1.0;
+    if (arr < 1.0)
+    {
+        arr = 1.0;
+    }
+    else if (arr > (double)period_max)
+    {
+        arr = (double)period_max;
+    }
+
+    *prescaler = (uint32_t)psc;
+    *period = (uint32_t)arr;
+    return (float)((double)timer_clock / ((psc + 1.0) * (arr + 1.0)));
+}
@@ -0,0 +1,170 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    adc.c
+  * @brief   This file provides code for the configuration
+  *          of the ADC instances.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+/* Includes ------------------------------------------------------------------*/
+#include "adc.h"
+
+/* USER CODE BEGIN 0 */
+// ADC1 外设直接按寄存器配置 (CMSIS 定义)，只依赖已随工程提供的 HAL GPIO/DMA 驱动:
+// Drivers/STM32F4xx_HAL_Driver 中没有 HAL ADC/TIM 驱动，stm32f4xx_hal_conf.h 中也未启用这两个模块
+#define ADC1_SMPR2_15CYCLES (ADC_SMPR2_SMP0_0 | ADC_SMPR2_SMP1_0 | ADC_SMPR2_SMP2_0 | ADC_SMPR2_SMP3_0) // IN0 ~ IN3 采样 15 周期
+#define ADC1_EXTSEL_T2_TRGO (ADC_CR2_EXTSEL_1 | ADC_CR2_EXTSEL_2) // 规则组外部触发: TIM2 TRGO (0110)
+
+static void ADC1_DMA_HalfCpltCallback(DMA_HandleTypeDef *hdma);
+static void ADC1_DMA_CpltCallback(DMA_HandleTypeDef *hdma);
+/* USER CODE END 0 */
+
+DMA_HandleTypeDef hdma_adc1;
+
+/* ADC1 init function */
+void MX_ADC1_Init(void)
+{
+
+  /* USER CODE BEGIN ADC1_Init 0 */
+
+  /* USER CODE END ADC1_Init 0 */
+
+  /* USER CODE BEGIN ADC1_Init 1 */
+  // 上电为单通道 PA0，由 TIM2 更新事件 (TRGO) 上升沿触发每次转换，DMA 循环写入乒乓缓冲区；
+  // 多通道扫描 (PA0 ~ PA3) 由 ADC1_Config_Scan 在运行时重新配置规则组
+  /* USER CODE END ADC1_Init 1 */
+
+  /* USER CODE BEGIN ADC1_Init 2 */
+  // 外设寄存器配置和 DMA 回调全部放在 USER CODE 段中，用 CubeMX 重新生成时保留
+  GPIO_InitTypeDef GPIO_InitStruct = {0};
+
+  /* ADC1 clock enable */
+  __HAL_RCC_ADC1_CLK_ENABLE();
+
+  __HAL_RCC_GPIOA_CLK_ENABLE();
+  /**ADC1 GPIO Configuration
+  PA0-WKUP     ------> ADC1_IN0
+  PA1     ------> ADC1_IN1
+  PA2     ------> ADC1_IN2
+  PA3     ------> ADC1_IN3
+  */
+  GPIO_InitStruct.Pin = GPIO_PIN_0|GPIO_PIN_1|GPIO_PIN_2|GPIO_PIN_3;
+  GPIO_InitStruct.Mode = GPIO_MODE_ANALOG;
+  GPIO_InitStruct.Pull = GPIO_NOPULL;
+  HAL_GPIO_Init(GPIOA, &GPIO_InitStruct);
+
+  /* ADC1 DMA Init */
+  hdma_adc1.Instance = DMA2_Stream0;
+  hdma_adc1.Init.Channel = DMA_CHANNEL_0;
+  hdma_adc1.Init.Direction = DMA_PERIPH_TO_MEMORY;
+  hdma_adc1.Init.PeriphInc = DMA_PINC_DISABLE;
+  hdma_adc1.Init.MemInc = DMA_MINC_ENABLE;
+  hdma_adc1.Init.PeriphDataAlignment = DMA_PDATAALIGN_HALFWORD;
+  hdma_adc1.Init.MemDataAlignment = DMA_MDATAALIGN_HALFWORD;
+  hdma_adc1.Init.Mode = DMA_CIRCULAR;
+  hdma_adc1.Init.Priority = DMA_PRIORITY_HIGH;
+  hdma_adc1.Init.FIFOMode = DMA_FIFOMODE_DISABLE;
+  if (HAL_DMA_Init(&hdma_adc1) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  hdma_adc1.XferHalfCpltCallback = ADC1_DMA_HalfCpltCallback;
+  hdma_adc1.XferCpltCallback = ADC1_DMA_CpltCallback;
+
+  /** ADCCLK = PCLK2 / 4 = 21 MHz, 12 bit, right aligned, single channel IN0 */
+  ADC1_COMMON->CCR = (ADC1_COMMON->CCR & ~ADC_CCR_ADCPRE) | ADC_CCR_ADCPRE_0;
+  ADC1->CR1 = 0;
+  ADC1->SMPR2 = ADC1_SMPR2_15CYCLES;
+  ADC1->SQR1 = 0;
+  ADC1->SQR3 = (0u << ADC_SQR3_SQ1_Pos) | (1u << ADC_SQR3_SQ2_Pos) | (2u << ADC_SQR3_SQ3_Pos) | (3u << ADC_SQR3_SQ4_Pos);
+  /** External trigger: TIM2 TRGO rising edge, DMA requests continue in circular mode */
+  ADC1->CR2 = ADC_CR2_EXTEN_0 | ADC1_EXTSEL_T2_TRGO | ADC_CR2_DDS | ADC_CR2_ADON;
+  /* USER CODE END ADC1_Init 2 */
+
+}
+
+/* USER CODE BEGIN 1 */
+
+/**
+  * @brief  重新配置 ADC1 规则组: 1 个通道时为单通道模式，多个通道时为扫描模式，
+  *         第 1 ~ n 个转换依次为 IN0 ~ IN(n-1)，每次 TRGO 触发转换整个序列
+  * @param  channels: 通道数 (1 ~ ADC1_SCAN_MAX_CHANNELS)
+  * @retval HAL 状态 (必须在 ADC 和 DMA 停止时调用)
+  */
+HAL_StatusTypeDef ADC1_Config_Scan(uint32_t channels)
+{
+  if (channels < 1 || channels > ADC1_SCAN_MAX_CHANNELS)
+  {
+    return HAL_ERROR;
+  }
+
+  // 规则序列 SQ1 ~ SQ4 在初始化时已固定为 IN0 ~ IN3，这里只改序列长度和扫描位
+  if (channels > 1)
+  {
+    ADC1->CR1 |= ADC_CR1_SCAN;
+  }
+  else
+  {
+    ADC1->CR1 &= ~ADC_CR1_SCAN;
+  }
+  ADC1->SQR1 = (channels - 1u) << ADC_SQR1_L_Pos;
+  return HAL_OK;
+}
+
+/**
+  * @brief  启动 DMA 循环接收 ADC1 规则组结果 (触发源 TIM2 另行启动)
+  * @param  buffer: DMA 目标缓冲区
+  * @param  length: 码值个数 (半传输/传输完成中断分别对应前/后一半)
+  * @retval HAL 状态
+  */
+HAL_StatusTypeDef ADC1_Start_DMA(uint16_t *buffer, uint32_t length)
+{
+  if (HAL_DMA_Start_IT(&hdma_adc1, (uint32_t)&ADC1->DR, (uint32_t)buffer, length) != HAL_OK)
+  {
+    return HAL_ERROR;
+  }
+  // 清除上一次停止时可能残留的溢出标志，再打开 DMA 请求
+  ADC1->SR = ~(uint32_t)(ADC_SR_OVR | ADC_SR_EOC | ADC_SR_STRT); // 状态位写 0 清除
+  ADC1->CR2 |= ADC_CR2_DMA;
+  return HAL_OK;
+}
+
+/**
+  * @brief  停止 ADC1 的 DMA 请求并中止 DMA 传输 (ADC 保持上电)
+  */
+void ADC1_Stop_DMA(void)
+{
+  ADC1->CR2 &= ~ADC_CR2_DMA;
+  HAL_DMA_Abort(&hdma_adc1);
+}
+
+/**
+  * @brief  DMA 半传输回调: 前一半写完
+  */
+static void ADC1_DMA_HalfCpltCallback(DMA_HandleTypeDef *hdma)
+{
+  UNUSED(hdma);
+  ADC1_ConvHalfCpltCallback();
+}
+
+/**
+  * @brief  DMA 传输完成回调: 后一半写完 (循环模式下 DMA 随即回到前一半)
+  */
+static void ADC1_DMA_CpltCallback(DMA_HandleTypeDef *hdma)
+{
+  UNUSED(hdma);
+  ADC1_ConvCpltCallback();
+}
+
+/* USER CODE END 1 */
@@ -0,0 +1,119 @@
+#include "ar_spectrum.h"
+#include "autocorr.h" // autocorr_compute_in_place
+#include <math.h>     // sqrtf, cosf
+
+// r[0] 的白噪声修正比例 (约 -50 dB 噪底)
+#define AR_WHITE_NOISE_CORRECTION 1e-5f
+// |A(f)|^2 的下限，防止除零
+#define AR_DENOMINATOR_FLOOR 1e-20f
+
+/**
+ * @brief Levinson-Durbin 递推。
+ */
+uint8_t ar_levinson_durbin(const float *r, uint32_t order, ar_model_t *model)
+{
+    if (order == 0 || order > AR_MAX_ORDER || r[0] <= 0.0f)
+    {
+        return 0;
+    }
+
+    float *a = model->coeffs;
+    a[0] = 1.0f;
+    for (uint32_t i = 1; i <= order; i++)
+    {
+        a[i] = 0.0f;
+    }
+    float error = r[0];
+
+    for (uint32_t i = 1; i <= order; i++)
+    {
+        // 反射系数 k_i = -(r[i] + sum a[j] r[i-j]) / E
+        float acc = r[i];
+        for (uint32_t j = 1; j < i; j++)
+        {
+            acc += a[j] * r[i - j];
+        }
+        float k = -acc / error;
+
+        // a[j] += k * a[i-j]，首尾成对更新即可原地完成
+        for (uint32_t j = 1; j <= i / 2; j++)
+        {
+            float front = a[j];
+            float back = a[i - j];
+            a[j] = front + k * back;
+            if (j != i - j)
+            {
+                a[i - j] = back + k * front;
+            }
+        }
+        a[i] = k;
+
+        error *= (1.0f - k * k);
+        if (error <= 0.0f)
+        {
+            return 0; // |k| >= 1，递推不稳定
+        }
+    }
+
+    model->order = order;
+    model->error_power = error;
+    return 1;
+}
+
+/**
+ * @brief 由时域采样估计 AR 模型。
+ */
+uint8_t ar_estimate(const float *x, uint32_t len, uint32_t order,
+                    complex_t *work, uint32_t n, ar_model_t *model)
+{
+    if (len == 0 || order >= len || 2 * len > n)
+    {
+        return 0;
+    }
+
+    if (order > AR_MAX_ORDER)
+    {
+        return 0;
+    }
+
+    // 加 Hann 窗后再求自相关: 短记录下矩形截断会严重降低 Yule-Walker 估计的分辨率
+    for (uint32_t i = 0; i < len; i++)
+    {
+        float window = 0.5f - 0.5f * cosf(2.0f * (float)M_PI * ((float)i + 0.5f) / (float)len);
+        work[i].real = x[i] * window;
+    }
+    autocorr_compute_in_place(work, len, n);
+
+    // 有偏自相关 r[m] / len，Levinson 只需要 r[0] ~ r[order]
+    float r[AR_MAX_ORDER + 1];
+    float inv_len = 1.0f / (float)len;
+    for (uint32_t m = 0; m <= order; m++)
+    {
+        r[m] = work[m].real * inv_len;
+    }
+    r[0] *= (1.0f + AR_WHITE_NOISE_CORRECTION);
+
+    return ar_levinson_durbin(r, order, model);
+}
+
+/**
+ * @brief 在 n 点密集频率网格上计算 AR 谱。
+ */
+void ar_spectrum(const ar_model_t *model, complex_t *work, uint32_t n, float *magnitudes)
+{
+    // --- 1. A(z) 系数零填充到 n 点，一次 FFT 得到整个网格上的 A(f) ---
+    for (uint32_t i = 0; i < n; i++)
+    {
+        work[i].real = (i <= model->order) ? model->coeffs[i] : 0.0f;
+        work[i].imag = 0.0f;
+    }
+    fft_radix2(work, n);
+
+    // --- 2. P(f) = sigma^2 / |A(f)|^2 ---
+    float scale = model->error_power / (float)n;
+    for (uint32_t k = 0; k < n / 2; k++)
+    {
+        float denom = work[k].real * work[k].real + work[k].imag * work[k].imag;
+        magnitudes[k] = sqrtf(scale / (denom + AR_DENOMINATOR_FLOOR));
+    }
+}
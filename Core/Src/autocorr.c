@@ -0,0 +1,152 @@
+#include "autocorr.h"
+
+/**
+ * @brief 基于 FFT 计算线性自相关。
+ */
+void autocorr_compute(const float *x, uint32_t len, complex_t *work, uint32_t n)
+{
+    if (n == 0 || (n & (n - 1)) != 0 || 2 * len > n)
+    {
+        return; // n 必须是 2 的幂，且零填充后不能回绕
+    }
+
+    for (uint32_t i = 0; i < len; i++)
+    {
+        work[i].real = x[i];
+    }
+    autocorr_compute_in_place(work, len, n);
+}
+
+/**
+ * @brief 对已装入 work 的输入计算线性自相关。
+ */
+void autocorr_compute_in_place(complex_t *work, uint32_t len, uint32_t n)
+{
+    if (n == 0 || (n & (n - 1)) != 0 || 2 * len > n)
+    {
+        return;
+    }
+
+    // --- 1. 零填充到 n ---
+    for (uint32_t i = 0; i < n; i++)
+    {
+        if (i >= len)
+        {
+            work[i].real = 0.0f;
+        }
+        work[i].imag = 0.0f;
+    }
+
+    // --- 2. 正变换 ---
+    fft_radix2(work, n);
+
+    // --- 3. 功率谱 |X|^2 (实数且偶对称) ---
+    for (uint32_t i = 0; i < n; i++)
+    {
+        float re = work[i].real;
+        float im = work[i].imag;
+        work[i].real = re * re + im * im;
+        work[i].imag = 0.0f;
+    }
+
+    // --- 4. 逆变换得到自相关 ---
+    fft_inverse_radix2(work, n);
+}
+
+/**
+ * @brief YIN 风格的基音/周期检测。
+ */
+void pitch_detect_yin(const float *x, uint32_t len, complex_t *work, uint32_t n,
+                      float sample_rate, float min_freq, float max_freq,
+                      float threshold, pitch_result_t *result)
+{
+    result->period_samples = 0.0f;
+    result->frequency = 0.0f;
+    result->clarity = 0.0f;
+
+    if (len < 4 || 2 * len > n || min_freq <= 0.0f || max_freq <= min_freq)
+    {
+        return;
+    }
+
+    // --- 1. 周期搜索范围 (至少保留两个周期用于比较) ---
+    uint32_t tau_min = (uint32_t)(sample_rate / max_freq);
+    uint32_t tau_max = (uint32_t)(sample_rate / min_freq) + 1;
+    if (tau_min < 2)
+        tau_min = 2;
+    if (tau_max > len / 2)
+        tau_max = len / 2;
+    if (tau_min + 2 > tau_max)
+    {
+        return;
+    }
+
+    autocorr_compute(x, len, work, n);
+
+    // --- 2. 差分函数与累积均值归一化 (CMNDF)，结果存入虚部 ---
+    // d(t) = sum_{j < len-t} (x[j] - x[j+t])^2 = E_head(t) + E_tail(t) - 2 r(t)
+    float energy_head = work[0].real; // sum_{j < len-t} x[j]^2
+    float energy_tail = work[0].real; // sum_{j >= t} x[j]^2
+    float running_sum = 0.0f;
+    work[0].imag = 1.0f;
+    for (uint32_t tau = 1; tau <= tau_max; tau++)
+    {
+        float head_drop = x[len - tau];
+        float tail_drop = x[tau - 1];
+        energy_head -= head_drop * head_drop;
+        energy_tail -= tail_drop * tail_drop;
+
+        float diff = energy_head + energy_tail - 2.0f * work[tau].real;
+        if (diff < 0.0f)
+            diff = 0.0f; // 浮点舍入可能产生微小负值
+        running_sum += diff;
+        work[tau].imag = (running_sum > 0.0f) ? diff * (float)tau / running_sum : 1.0f;
+    }
+
+    // --- 3. 绝对阈值: 取第一个低于阈值的局部极小值，否则取全局最小值 ---
+    uint32_t best_tau = 0;
+    for (uint32_t tau = tau_min; tau < tau_max; tau++)
+    {
+        if (work[tau].imag < threshold)
+        {
+            while (tau + 1 < tau_max && work[tau + 1].imag < work[tau].imag)
+            {
+                tau++;
+            }
+            best_tau = tau;
+            break;
+        }
+    }
+    if (best_tau == 0)
+    {
+        best_tau = tau_min;
+        for (uint32_t tau = tau_min + 1; tau < tau_max; tau++)
+        {
+            if (work[tau].imag < work[best_tau].imag)
+            {
+                best_tau = tau;
+            }
+        }
+    }
+
+    // --- 4. 抛物线插值得到子样本周期 ---
+    float left = work[best_tau - 1].imag;
+    float center = work[best_tau].imag;
+    float right = work[best_tau + 1].imag;
+    float denom = left - 2.0f * center + right;
+    float delta = 0.0f;
+    if (denom > 0.0f)
+    {
+        delta = 0.5f * (left - right) / denom;
+        if (delta > 0.5f)
+            delta = 0.5f;
+        else if (delta < -0.5f)
+            delta = -0.5f;
+    }
+
+    float period = (float)best_tau + delta;
+    float clarity = 1.0f - center;
+    result->period_samples = period;
+    result->frequency = sample_rate / period;
+    result->clarity = (clarity > 0.0f) ? clarity : 0.0f;
+}
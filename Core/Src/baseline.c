@@ -0,0 +1,175 @@
+#include "baseline.h"
+#include <math.h>   // sqrtf, log10f, fabsf
+#include <stddef.h> // offsetof
+#include <string.h> // memset
+
+#define BASELINE_MAG_FLOOR 1e-6f // 对数前的幅度下限 (-120 dB)，避免近零频点的舍入噪声产生巨大 z 分数
+
+// --- 私有辅助函数 ---
+
+/**
+ * @brief 幅度转换为 dB。
+ */
+static float magnitude_db(float magnitude)
+{
+    return 20.0f * log10f(magnitude + BASELINE_MAG_FLOOR);
+}
+
+/**
+ * @brief 单个频点的 Welford 更新 (count 已包含本帧)。
+ */
+static void welford_update(spectral_baseline_t *baseline, uint32_t bin, float value)
+{
+    float delta = value - baseline->mean[bin];
+    baseline->mean[bin] += delta / (float)baseline->count;
+    baseline->m2[bin] += delta * (value - baseline->mean[bin]);
+}
+
+/**
+ * @brief 单个频点的 z 分数。
+ */
+static float bin_z_score(const spectral_baseline_t *baseline, uint32_t bin, float value, float inv_count)
+{
+    float std = sqrtf(baseline->m2[bin] * inv_count);
+    if (std < BASELINE_MIN_STD_DB)
+    {
+        std = BASELINE_MIN_STD_DB;
+    }
+    return (value - baseline->mean[bin]) / std;
+}
+
+/**
+ * @brief 累加一个频点的 z 分数到评分。
+ */
+static void accumulate_score(anomaly_score_t *score, uint32_t bin, float z, float *sum_sq)
+{
+    float abs_z = fabsf(z);
+    if (abs_z > score->max_z)
+    {
+        score->max_z = abs_z;
+        score->max_bin = bin;
+    }
+    *sum_sq += z * z;
+}
+
+/**
+ * @brief 由 FFT 输出计算一个频点的幅度 (与 fft_calculate_magnitudes 一致)。
+ */
+static float spectrum_magnitude(const complex_t *spectrum, uint32_t bin)
+{
+    float real = spectrum[bin].real;
+    float imag = spectrum[bin].imag;
+    return sqrtf(real * real + imag * imag) / (float)FFT_N;
+}
+
+// --- 公共函数 ---
+
+/**
+ * @brief 清空基线。
+ */
+void baseline_reset(spectral_baseline_t *baseline, float sample_rate)
+{
+    memset(baseline, 0, sizeof(*baseline));
+    baseline->bins = BASELINE_BINS;
+    baseline->sample_rate = sample_rate;
+}
+
+/**
+ * @brief 幅度计算与 Welford 更新融合在一次遍历中。
+ */
+void baseline_learn_spectrum(spectral_baseline_t *baseline, const complex_t *spectrum, float *magnitudes)
+{
+    baseline->count++;
+    for (uint32_t k = 0; k < BASELINE_BINS; k++)
+    {
+        magnitudes[k] = spectrum_magnitude(spectrum, k);
+        welford_update(baseline, k, magnitude_db(magnitudes[k]));
+    }
+}
+
+/**
+ * @brief 幅度计算与异常评分融合在一次遍历中。
+ */
+void baseline_score_spectrum(const spectral_baseline_t *baseline, const complex_t *spectrum,
+                             float *magnitudes, anomaly_score_t *score)
+{
+    float inv_count = 1.0f / (float)(baseline->count - 1); // 样本方差
+    float sum_sq = 0.0f;
+    score->max_z = 0.0f;
+    score->max_bin = 0;
+
+    magnitudes[0] = spectrum_magnitude(spectrum, 0);
+    for (uint32_t k = 1; k < BASELINE_BINS; k++) // 不评估直流
+    {
+        magnitudes[k] = spectrum_magnitude(spectrum, k);
+        float z = bin_z_score(baseline, k, magnitude_db(magnitudes[k]), inv_count);
+        accumulate_score(score, k, z, &sum_sq);
+    }
+    score->rms_z = sqrtf(sum_sq / (float)(BASELINE_BINS - 1));
+}
+
+/**
+ * @brief 用幅度谱更新基线。
+ */
+void baseline_learn(spectral_baseline_t *baseline, const float *magnitudes)
+{
+    baseline->count++;
+    for (uint32_t k = 0; k < BASELINE_BINS; k++)
+    {
+        welford_update(baseline, k, magnitude_db(magnitudes[k]));
+    }
+}
+
+/**
+ * @brief 用幅度谱对照基线评分。
+ */
+void baseline_score(const spectral_baseline_t *baseline, const float *magnitudes, anomaly_score_t *score)
+{
+    float inv_count = 1.0f / (float)(baseline->count - 1);
+    float sum_sq = 0.0f;
+    score->max_z = 0.0f;
+    score->max_bin = 0;
+
+    for (uint32_t k = 1; k < BASELINE_BINS; k++)
+    {
+        float z = bin_z_score(baseline, k, magnitude_db(magnitudes[k]), inv_count);
+        accumulate_score(score, k, z, &sum_sq);
+    }
+    score->rms_z = sqrtf(sum_sq / (float)(BASELINE_BINS - 1));
+}
+
+/**
+ * @brief 计算除校验和字段以外所有字的累加和。
+ */
+static uint32_t baseline_checksum(const spectral_baseline_t *baseline)
+{
+    const uint32_t *words = (const uint32_t *)baseline;
+    uint32_t count = (uint32_t)(offsetof(spectral_baseline_t, checksum) / sizeof(uint32_t));
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        sum += words[i];
+    }
+    return sum;
+}
+
+/**
+ * @brief 填写标识和校验和。
+ */
+void baseline_seal(spectral_baseline_t *baseline)
+{
+    baseline->magic = BASELINE_MAGIC;
+    baseline->bins = BASELINE_BINS;
+    baseline->checksum = baseline_checksum(baseline);
+}
+
+/**
+ * @brief 检查基线是否有效。
+ */
+uint8_t baseline_is_valid(const spectral_baseline_t *baseline)
+{
+    return baseline->magic == BASELINE_MAGIC &&
+           baseline->bins == BASELINE_BINS &&
+           baseline->count >= 2 &&
+           baseline->checksum == baseline_checksum(baseline);
+}
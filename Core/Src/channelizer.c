@@ -0,0 +1,43 @@
+#include "channelizer.h"
+#include <string.h> // memset, memcpy
+
+/**
+ * @brief 初始化信道化器。
+ */
+void channelizer_init(channelizer_t *channelizer)
+{
+    memset(channelizer->history, 0, sizeof(channelizer->history));
+    channelizer->write_index = 0;
+}
+
+/**
+ * @brief WOLA 多相滤波器组，输入 N 个新采样，输出一组 N 信道复数样本。
+ */
+void channelizer_process(channelizer_t *channelizer, const float *block, complex_t *out)
+{
+    const uint32_t n = CHANNELIZER_CHANNELS;
+
+    // --- 1. 新采样写入环形缓冲区 (写入位置总是 N 对齐，一次拷贝即可) ---
+    memcpy(&channelizer->history[channelizer->write_index], block, n * sizeof(float));
+    channelizer->write_index = (channelizer->write_index + n) % CHANNELIZER_TAPS;
+
+    // --- 2. 加权并折叠: 最旧的采样对应原型第 0 个系数，第 i 个采样累加到 out[i mod N] ---
+    for (uint32_t k = 0; k < n; k++)
+    {
+        out[k].real = 0.0f;
+        out[k].imag = 0.0f;
+    }
+    uint32_t oldest = channelizer->write_index; // 写入后，下一个写入位置即最旧的一段
+    for (uint32_t branch = 0; branch < CHANNELIZER_TAPS_PER_BRANCH; branch++)
+    {
+        const float *x = &channelizer->history[(oldest + branch * n) % CHANNELIZER_TAPS];
+        const float *h = &channelizer_prototype[branch * n];
+        for (uint32_t k = 0; k < n; k++)
+        {
+            out[k].real += h[k] * x[k];
+        }
+    }
+
+    // --- 3. 一次 N 点 FFT 完成 N 个信道的调制 ---
+    fft_radix2(out, n);
+}
@@ -0,0 +1,136 @@
+/**
+ * @description: 多相信道化器原型低通 FIR，由 gen_channelizer_prototype.py 自动生成，请勿手动修改。
+ * @note: N = 128 个信道, M = 8 抽头/支路, Kaiser beta = 9，直流增益 1。
+ */
+#include "channelizer.h"
+
+const float channelizer_prototype[CHANNELIZER_TAPS] = {
+    -6.98288065e-09f, -2.26785611e-08f, -4.07894655e-08f, -6.14474513e-08f, -8.47858665e-08f, -1.10939343e-07f, -1.40043580e-07f, -1.72235116e-07f,
+    -2.07651090e-07f, -2.46428993e-07f, -2.88706409e-07f, -3.34620746e-07f, -3.84308953e-07f, -4.37907235e-07f, -4.95550745e-07f, -5.57373284e-07f,
+    -6.23506971e-07f, -6.94081923e-07f, -7.69225911e-07f, -8.49064013e-07f, -9.33718262e-07f, -1.02330728e-06f, -1.11794589e-06f, -1.21774478e-06f,
+    -1.32281005e-06f, -1.43324289e-06f, -1.54913912e-06f, -1.67058879e-06f, -1.79767583e-06f, -1.93047754e-06f, -2.06906424e-06f, -2.21349878e-06f,
+    -2.36383619e-06f, -2.52012316e-06f, -2.68239766e-06f, -2.85068849e-06f, -3.02501484e-06f, -3.20538582e-06f, -3.39180007e-06f, -3.58424529e-06f,
+    -3.78269781e-06f, -3.98712215e-06f, -4.19747057e-06f, -4.41368271e-06f, -4.63568506e-06f, -4.86339063e-06f, -5.09669848e-06f, -5.33549335e-06f,
+    -5.57964523e-06f, -5.82900899e-06f, -6.08342398e-06f, -6.34271370e-06f, -6.60668536e-06f, -6.87512961e-06f, -7.14782017e-06f, -7.42451350e-06f,
+    -7.70494849e-06f, -7.98884622e-06f, -8.27590959e-06f, -8.56582314e-06f, -8.85825278e-06f, -9.15284558e-06f, -9.44922952e-06f, -9.74701338e-06f,
+    -1.00457865e-05f, -1.03451188e-05f, -1.06445604e-05f, -1.09436419e-05f, -1.12418737e-05f, -1.15387469e-05f, -1.18337323e-05f, -1.21262811e-05f,
+    -1.24158247e-05f, -1.27017747e-05f, -1.29835232e-05f, -1.32604427e-05f, -1.35318864e-05f, -1.37971886e-05f, -1.40556644e-05f, -1.43066106e-05f,
+    -1.45493055e-05f, -1.47830094e-05f, -1.50069651e-05f, -1.52203982e-05f, -1.54225173e-05f, -1.56125151e-05f, -1.57895682e-05f, -1.59528381e-05f,
+    -1.61014717e-05f, -1.62346019e-05f, -1.63513482e-05f, -1.64508174e-05f, -1.65321047e-05f, -1.65942939e-05f, -1.66364586e-05f, -1.66576631e-05f,
+    -1.66569631e-05f, -1.66334067e-05f, -1.65860355e-05f, -1.65138853e-05f, -1.64159875e-05f, -1.62913703e-05f, -1.61390591e-05f, -1.59580786e-05f,
+    -1.57474533e-05f, -1.55062092e-05f, -1.52333748e-05f, -1.49279824e-05f, -1.45890697e-05f, -1.42156810e-05f, -1.38068686e-05f, -1.33616943e-05f,
+    -1.28792308e-05f, -1.23585634e-05f, -1.17987913e-05f, -1.11990293e-05f, -1.05584094e-05f, -9.87608240e-06f, -9.15121937e-06f, -8.38301358e-06f,
+    -7.57068203e-06f, -6.71346721e-06f, -5.81063877e-06f, -4.86149531e-06f, -3.86536611e-06f, -2.82161290e-06f, -1.72963166e-06f, -5.88854371e-07f,
+    6.01249149e-07f, 1.84116947e-06f, 3.13135571e-06f, 4.47221378e-06f, 5.86410451e-06f, 7.30734188e-06f, 8.80219123e-06f, 1.03488674e-05f,
+    1.19475330e-05f, 1.35982968e-05f, 1.53012113e-05f, 1.70562721e-05f, 1.88634151e-05f, 2.07225155e-05f, 2.26333855e-05f, 2.45957735e-05f,
+    2.66093615e-05f, 2.86737642e-05f, 3.07885273e-05f, 3.29531256e-05f, 3.51669620e-05f, 3.74293658e-05f, 3.97395912e-05f, 4.20968162e-05f,
+    4.45001412e-05f, 4.69485877e-05f, 4.94410969e-05f, 5.19765290e-05f, 5.45536618e-05f, 5.71711897e-05f, 5.98277230e-05f, 6.25217866e-05f,
+    6.52518194e-05f, 6.80161737e-05f, 7.08131142e-05f, 7.36408177e-05f, 7.64973725e-05f, 7.93807779e-05f, 8.22889438e-05f, 8.52196908e-05f,
+    8.81707494e-05f, 9.11397607e-05f, 9.41242758e-05f, 9.71217562e-05f, 1.00129574e-04f, 1.03145012e-04f, 1.06165265e-04f, 1.09187438e-04f,
+    1.12208550e-04f, 1.15225533e-04f, 1.18235233e-04f, 1.21234410e-04f, 1.24219741e-04f, 1.27187820e-04f, 1.30135159e-04f, 1.33058192e-04f,
+    1.35953272e-04f, 1.38816676e-04f, 1.41644606e-04f, 1.44433192e-04f, 1.47178491e-04f, 1.49876492e-04f, 1.52523116e-04f, 1.55114222e-04f,
+    1.57645604e-04f, 1.60112999e-04f, 1.62512087e-04f, 1.64838494e-04f, 1.67087794e-04f, 1.69255517e-04f, 1.71337145e-04f, 1.73328121e-04f,
+    1.75223849e-04f, 1.77019701e-04f, 1.78711017e-04f, 1.80293111e-04f, 1.81761276e-04f, 1.83110783e-04f, 1.84336893e-04f, 1.85434854e-04f,
+    1.86399909e-04f, 1.87227301e-04f, 1.87912274e-04f, 1.88450082e-04f, 1.88835992e-04f, 1.89065287e-04f, 1.89133274e-04f, 1.89035287e-04f,
+    1.88766694e-04f, 1.88322900e-04f, 1.87699353e-04f, 1.86891550e-04f, 1.85895044e-04f, 1.84705445e-04f, 1.83318429e-04f, 1.81729745e-04f,
+    1.79935216e-04f, 1.77930747e-04f, 1.75712335e-04f, 1.73276066e-04f, 1.70618129e-04f, 1.67734817e-04f, 1.64622537e-04f, 1.61277810e-04f,
+    1.57697284e-04f, 1.53877735e-04f, 1.49816073e-04f, 1.45509352e-04f, 1.40954773e-04f, 1.36149689e-04f, 1.31091613e-04f, 1.25778224e-04f,
+    1.20207371e-04f, 1.14377083e-04f, 1.08285567e-04f, 1.01931223e-04f, 9.53126430e-05f, 8.84286205e-05f, 8.12781538e-05f, 7.38604529e-05f,
+    6.61749442e-05f, 5.82212762e-05f, 4.99993250e-05f, 4.15091991e-05f, 3.27512446e-05f, 2.37260503e-05f, 1.44344524e-05f, 4.87753938e-06f,
+    -4.94334333e-06f, -1.50265891e-05f, -2.53703255e-05f, -3.59724104e-05f, -4.68304276e-05f, -5.79416830e-05f, -6.93032014e-05f, -8.09117219e-05f,
+    -9.27636957e-05f, -1.04855282e-04f, -1.17182345e-04f, -1.29740453e-04f, -1.42524872e-04f, -1.55530568e-04f, -1.68752199e-04f, -1.82184120e-04f,
+    -1.95820375e-04f, -2.09654699e-04f, -2.23680516e-04f, -2.37890937e-04f, -2.52278761e-04f, -2.66836471e-04f, -2.81556237e-04f, -2.96429917e-04f,
+    -3.11449052e-04f, -3.26604871e-04f, -3.41888289e-04f, -3.57289911e-04f, -3.72800028e-04f, -3.88408626e-04f, -4.04105380e-04f, -4.19879662e-04f,
+    -4.35720539e-04f, -4.51616779e-04f, -4.67556852e-04f, -4.83528934e-04f, -4.99520910e-04f, -5.15520378e-04f, -5.31514653e-04f, -5.47490769e-04f,
+    -5.63435491e-04f, -5.79335309e-04f, -5.95176454e-04f, -6.10944896e-04f, -6.26626352e-04f, -6.42206294e-04f, -6.57669952e-04f, -6.73002325e-04f,
+    -6.88188182e-04f, -7.03212075e-04f, -7.18058344e-04f, -7.32711124e-04f, -7.47154354e-04f, -7.61371785e-04f, -7.75346989e-04f, -7.89063368e-04f,
+    -8.02504163e-04f, -8.15652462e-04f, -8.28491211e-04f, -8.41003224e-04f, -8.53171193e-04f, -8.64977697e-04f, -8.76405213e-04f, -8.87436130e-04f,
+    -8.98052755e-04f, -9.08237328e-04f, -9.17972031e-04f, -9.27239000e-04f, -9.36020340e-04f, -9.44298132e-04f, -9.52054449e-04f, -9.59271367e-04f,
+    -9.65930977e-04f, -9.72015399e-04f, -9.77506793e-04f, -9.82387373e-04f, -9.86639422e-04f, -9.90245300e-04f, -9.93187463e-04f, -9.95448474e-04f,
+    -9.97011015e-04f, -9.97857903e-04f, -9.97972102e-04f, -9.97336738e-04f, -9.95935111e-04f, -9.93750713e-04f, -9.90767235e-04f, -9.86968586e-04f,
+    -9.82338907e-04f, -9.76862580e-04f, -9.70524247e-04f, -9.63308823e-04f, -9.55201507e-04f, -9.46187797e-04f, -9.36253506e-04f, -9.25384771e-04f,
+    -9.13568072e-04f, -9.00790240e-04f, -8.87038474e-04f, -8.72300352e-04f, -8.56563848e-04f, -8.39817338e-04f, -8.22049619e-04f, -8.03249918e-04f,
+    -7.83407909e-04f, -7.62513717e-04f, -7.40557939e-04f, -7.17531650e-04f, -6.93426416e-04f, -6.68234309e-04f, -6.41947911e-04f, -6.14560330e-04f,
+    -5.86065212e-04f, -5.56456746e-04f, -5.25729677e-04f, -4.93879317e-04f, -4.60901553e-04f, -4.26792855e-04f, -3.91550287e-04f, -3.55171515e-04f,
+    -3.17654814e-04f, -2.78999076e-04f, -2.39203819e-04f, -1.98269192e-04f, -1.56195984e-04f, -1.12985627e-04f, -6.86402050e-05f, -2.31624582e-05f,
+    2.34442120e-05f, 7.11757383e-05f, 1.20027383e-04f, 1.69993735e-04f, 2.21068705e-04f, 2.73245523e-04f, 3.26516738e-04f, 3.80874214e-04f,
+    4.36309127e-04f, 4.92811967e-04f, 5.50372535e-04f, 6.08979946e-04f, 6.68622626e-04f, 7.29288313e-04f, 7.90964061e-04f, 8.53636240e-04f,
+    9.17290538e-04f, 9.81911964e-04f, 1.04748485e-03f, 1.11399287e-03f, 1.18141900e-03f, 1.24974558e-03f, 1.31895429e-03f, 1.38902615e-03f,
+    1.45994153e-03f, 1.53168018e-03f, 1.60422120e-03f, 1.67754307e-03f, 1.75162367e-03f, 1.82644024e-03f, 1.90196946e-03f, 1.97818739e-03f,
+    2.05506953e-03f, 2.13259081e-03f, 2.21072560e-03f, 2.28944771e-03f, 2.36873046e-03f, 2.44854659e-03f, 2.52886838e-03f, 2.60966759e-03f,
+    2.69091550e-03f, 2.77258293e-03f, 2.85464025e-03f, 2.93705737e-03f, 3.01980380e-03f, 3.10284863e-03f, 3.18616057e-03f, 3.26970793e-03f,
+    3.35345869e-03f, 3.43738048e-03f, 3.52144058e-03f, 3.60560599e-03f, 3.68984343e-03f, 3.77411932e-03f, 3.85839983e-03f, 3.94265093e-03f,
+    4.02683834e-03f, 4.11092760e-03f, 4.19488407e-03f, 4.27867295e-03f, 4.36225931e-03f, 4.44560811e-03f, 4.52868420e-03f, 4.61145235e-03f,
+    4.69387730e-03f, 4.77592373e-03f, 4.85755633e-03f, 4.93873977e-03f, 5.01943876e-03f, 5.09961807e-03f, 5.17924253e-03f, 5.25827706e-03f,
+    5.33668670e-03f, 5.41443661e-03f, 5.49149212e-03f, 5.56781874e-03f, 5.64338214e-03f, 5.71814826e-03f, 5.79208325e-03f, 5.86515351e-03f,
+    5.93732576e-03f, 6.00856697e-03f, 6.07884447e-03f, 6.14812593e-03f, 6.21637937e-03f, 6.28357318e-03f, 6.34967619e-03f, 6.41465762e-03f,
+    6.47848715e-03f, 6.54113491e-03f, 6.60257151e-03f, 6.66276807e-03f, 6.72169622e-03f, 6.77932811e-03f, 6.83563647e-03f, 6.89059458e-03f,
+    6.94417632e-03f, 6.99635616e-03f, 7.04710920e-03f, 7.09641119e-03f, 7.14423849e-03f, 7.19056818e-03f, 7.23537799e-03f, 7.27864635e-03f,
+    7.32035240e-03f, 7.36047601e-03f, 7.39899780e-03f, 7.43589912e-03f, 7.47116207e-03f, 7.50476957e-03f, 7.53670527e-03f, 7.56695366e-03f,
+    7.59550001e-03f, 7.62233042e-03f, 7.64743180e-03f, 7.67079190e-03f, 7.69239932e-03f, 7.71224350e-03f, 7.73031472e-03f, 7.74660415e-03f,
+    7.76110382e-03f, 7.77380661e-03f, 7.78470631e-03f, 7.79379757e-03f, 7.80107594e-03f, 7.80653784e-03f, 7.81018060e-03f, 7.81200243e-03f,
+    7.81200243e-03f, 7.81018060e-03f, 7.80653784e-03f, 7.80107594e-03f, 7.79379757e-03f, 7.78470631e-03f, 7.77380661e-03f, 7.76110382e-03f,
+    7.74660415e-03f, 7.73031472e-03f, 7.71224350e-03f, 7.69239932e-03f, 7.67079190e-03f, 7.64743180e-03f, 7.62233042e-03f, 7.59550001e-03f,
+    7.56695366e-03f, 7.53670527e-03f, 7.50476957e-03f, 7.47116207e-03f, 7.43589912e-03f, 7.39899780e-03f, 7.36047601e-03f, 7.32035240e-03f,
+    7.27864635e-03f, 7.23537799e-03f, 7.19056818e-03f, 7.14423849e-03f, 7.09641119e-03f, 7.04710920e-03f, 6.99635616e-03f, 6.94417632e-03f,
+    6.89059458e-03f, 6.83563647e-03f, 6.77932811e-03f, 6.72169622e-03f, 6.66276807e-03f, 6.60257151e-03f, 6.54113491e-03f, 6.47848715e-03f,
+    6.41465762e-03f, 6.34967619e-03f, 6.28357318e-03f, 6.21637937e-03f, 6.14812593e-03f, 6.07884447e-03f, 6.00856697e-03f, 5.93732576e-03f,
+    5.86515351e-03f, 5.79208325e-03f, 5.71814826e-03f, 5.64338214e-03f, 5.56781874e-03f, 5.49149212e-03f, 5.41443661e-03f, 5.33668670e-03f,
+    5.25827706e-03f, 5.17924253e-03f, 5.09961807e-03f, 5.01943876e-03f, 4.93873977e-03f, 4.85755633e-03f, 4.77592373e-03f, 4.69387730e-03f,
+    4.61145235e-03f, 4.52868420e-03f, 4.44560811e-03f, 4.36225931e-03f, 4.27867295e-03f, 4.19488407e-03f, 4.11092760e-03f, 4.02683834e-03f,
+    3.94265093e-03f, 3.85839983e-03f, 3.77411932e-03f, 3.68984343e-03f, 3.60560599e-03f, 3.52144058e-03f, 3.43738048e-03f, 3.35345869e-03f,
+    3.26970793e-03f, 3.18616057e-03f, 3.10284863e-03f, 3.01980380e-03f, 2.93705737e-03f, 2.85464025e-03f, 2.77258293e-03f, 2.69091550e-03f,
+    2.60966759e-03f, 2.52886838e-03f, 2.44854659e-03f, 2.36873046e-03f, 2.28944771e-03f, 2.21072560e-03f, 2.13259081e-03f, 2.05506953e-03f,
+    1.97818739e-03f, 1.90196946e-03f, 1.82644024e-03f, 1.75162367e-03f, 1.67754307e-03f, 1.60422120e-03f, 1.53168018e-03f, 1.45994153e-03f,
+    1.38902615e-03f, 1.31895429e-03f, 1.24974558e-03f, 1.18141900e-03f, 1.11399287e-03f, 1.04748485e-03f, 9.81911964e-04f, 9.17290538e-04f,
+    8.53636240e-04f, 7.90964061e-04f, 7.29288313e-04f, 6.68622626e-04f, 6.08979946e-04f, 5.50372535e-04f, 4.92811967e-04f, 4.36309127e-04f,
+    3.80874214e-04f, 3.26516738e-04f, 2.73245523e-04f, 2.21068705e-04f, 1.69993735e-04f, 1.20027383e-04f, 7.11757383e-05f, 2.34442120e-05f,
+    -2.31624582e-05f, -6.86402050e-05f, -1.12985627e-04f, -1.56195984e-04f, -1.98269192e-04f, -2.39203819e-04f, -2.78999076e-04f, -3.17654814e-04f,
+    -3.55171515e-04f, -3.91550287e-04f, -4.26792855e-04f, -4.60901553e-04f, -4.93879317e-04f, -5.25729677e-04f, -5.56456746e-04f, -5.86065212e-04f,
+    -6.14560330e-04f, -6.41947911e-04f, -6.68234309e-04f, -6.93426416e-04f, -7.17531650e-04f, -7.40557939e-04f, -7.62513717e-04f, -7.83407909e-04f,
+    -8.03249918e-04f, -8.22049619e-04f, -8.39817338e-04f, -8.56563848e-04f, -8.72300352e-04f, -8.87038474e-04f, -9.00790240e-04f, -9.13568072e-04f,
+    -9.25384771e-04f, -9.36253506e-04f, -9.46187797e-04f, -9.55201507e-04f, -9.63308823e-04f, -9.70524247e-04f, -9.76862580e-04f, -9.82338907e-04f,
+    -9.86968586e-04f, -9.90767235e-04f, -9.93750713e-04f, -9.95935111e-04f, -9.97336738e-04f, -9.97972102e-04f, -9.97857903e-04f, -9.97011015e-04f,
+    -9.95448474e-04f, -9.93187463e-04f, -9.90245300e-04f, -9.86639422e-04f, -9.82387373e-04f, -9.77506793e-04f, -9.72015399e-04f, -9.65930977e-04f,
+    -9.59271367e-04f, -9.52054449e-04f, -9.44298132e-04f, -9.36020340e-04f, -9.27239000e-04f, -9.17972031e-04f, -9.08237328e-04f, -8.98052755e-04f,
+    -8.87436130e-04f, -8.76405213e-04f, -8.64977697e-04f, -8.53171193e-04f, -8.41003224e-04f, -8.28491211e-04f, -8.15652462e-04f, -8.02504163e-04f,
+    -7.89063368e-04f, -7.75346989e-04f, -7.61371785e-04f, -7.47154354e-04f, -7.32711124e-04f, -7.18058344e-04f, -7.03212075e-04f, -6.88188182e-04f,
+    -6.73002325e-04f, -6.57669952e-04f, -6.42206294e-04f, -6.26626352e-04f, -6.10944896e-04f, -5.95176454e-04f, -5.79335309e-04f, -5.63435491e-04f,
+    -5.47490769e-04f, -5.31514653e-04f, -5.15520378e-04f, -4.99520910e-04f, -4.83528934e-04f, -4.67556852e-04f, -4.51616779e-04f, -4.35720539e-04f,
+    -4.19879662e-04f, -4.04105380e-04f, -3.88408626e-04f, -3.72800028e-04f, -3.57289911e-04f, -3.41888289e-04f, -3.26604871e-04f, -3.11449052e-04f,
+    -2.96429917e-04f, -2.81556237e-04f, -2.66836471e-04f, -2.52278761e-04f, -2.37890937e-04f, -2.23680516e-04f, -2.09654699e-04f, -1.95820375e-04f,
+    -1.82184120e-04f, -1.68752199e-04f, -1.55530568e-04f, -1.42524872e-04f, -1.29740453e-04f, -1.17182345e-04f, -1.04855282e-04f, -9.27636957e-05f,
+    -8.09117219e-05f, -6.93032014e-05f, -5.79416830e-05f, -4.68304276e-05f, -3.59724104e-05f, -2.53703255e-05f, -1.50265891e-05f, -4.94334333e-06f,
+    4.87753938e-06f, 1.44344524e-05f, 2.37260503e-05f, 3.27512446e-05f, 4.15091991e-05f, 4.99993250e-05f, 5.82212762e-05f, 6.61749442e-05f,
+    7.38604529e-05f, 8.12781538e-05f, 8.84286205e-05f, 9.53126430e-05f, 1.01931223e-04f, 1.08285567e-04f, 1.14377083e-04f, 1.20207371e-04f,
+    1.25778224e-04f, 1.31091613e-04f, 1.36149689e-04f, 1.40954773e-04f, 1.45509352e-04f, 1.49816073e-04f, 1.53877735e-04f, 1.57697284e-04f,
+    1.61277810e-04f, 1.64622537e-04f, 1.67734817e-04f, 1.70618129e-04f, 1.73276066e-04f, 1.75712335e-04f, 1.77930747e-04f, 1.79935216e-04f,
+    1.81729745e-04f, 1.83318429e-04f, 1.84705445e-04f, 1.85895044e-04f, 1.86891550e-04f, 1.87699353e-04f, 1.88322900e-04f, 1.88766694e-04f,
+    1.89035287e-04f, 1.89133274e-04f, 1.89065287e-04f, 1.88835992e-04f, 1.88450082e-04f, 1.87912274e-04f, 1.87227301e-04f, 1.86399909e-04f,
+    1.85434854e-04f, 1.84336893e-04f, 1.83110783e-04f, 1.81761276e-04f, 1.80293111e-04f, 1.78711017e-04f, 1.77019701e-04f, 1.75223849e-04f,
+    1.73328121e-04f, 1.71337145e-04f, 1.69255517e-04f, 1.67087794e-04f, 1.64838494e-04f, 1.62512087e-04f, 1.60112999e-04f, 1.57645604e-04f,
+    1.55114222e-04f, 1.52523116e-04f, 1.49876492e-04f, 1.47178491e-04f, 1.44433192e-04f, 1.41644606e-04f, 1.38816676e-04f, 1.35953272e-04f,
+    1.33058192e-04f, 1.30135159e-04f, 1.27187820e-04f, 1.24219741e-04f, 1.21234410e-04f, 1.18235233e-04f, 1.15225533e-04f, 1.12208550e-04f,
+    1.09187438e-04f, 1.06165265e-04f, 1.03145012e-04f, 1.00129574e-04f, 9.71217562e-05f, 9.41242758e-05f, 9.11397607e-05f, 8.81707494e-05f,
+    8.52196908e-05f, 8.22889438e-05f, 7.93807779e-05f, 7.64973725e-05f, 7.36408177e-05f, 7.08131142e-05f, 6.80161737e-05f, 6.52518194e-05f,
+    6.25217866e-05f, 5.98277230e-05f, 5.71711897e-05f, 5.45536618e-05f, 5.19765290e-05f, 4.94410969e-05f, 4.69485877e-05f, 4.45001412e-05f,
+    4.20968162e-05f, 3.97395912e-05f, 3.74293658e-05f, 3.51669620e-05f, 3.29531256e-05f, 3.07885273e-05f, 2.86737642e-05f, 2.66093615e-05f,
+    2.45957735e-05f, 2.26333855e-05f, 2.07225155e-05f, 1.88634151e-05f, 1.70562721e-05f, 1.53012113e-05f, 1.35982968e-05f, 1.19475330e-05f,
+    1.03488674e-05f, 8.80219123e-06f, 7.30734188e-06f, 5.86410451e-06f, 4.47221378e-06f, 3.13135571e-06f, 1.84116947e-06f, 6.01249149e-07f,
+    -5.88854371e-07f, -1.72963166e-06f, -2.82161290e-06f, -3.86536611e-06f, -4.86149531e-06f, -5.81063877e-06f, -6.71346721e-06f, -7.57068203e-06f,
+    -8.38301358e-06f, -9.15121937e-06f, -9.87608240e-06f, -1.05584094e-05f, -1.11990293e-05f, -1.17987913e-05f, -1.23585634e-05f, -1.28792308e-05f,
+    -1.33616943e-05f, -1.38068686e-05f, -1.42156810e-05f, -1.45890697e-05f, -1.49279824e-05f, -1.52333748e-05f, -1.55062092e-05f, -1.57474533e-05f,
+    -1.59580786e-05f, -1.61390591e-05f, -1.62913703e-05f, -1.64159875e-05f, -1.65138853e-05f, -1.65860355e-05f, -1.66334067e-05f, -1.66569631e-05f,
+    -1.66576631e-05f, -1.66364586e-05f, -1.65942939e-05f, -1.65321047e-05f, -1.64508174e-05f, -1.63513482e-05f, -1.62346019e-05f, -1.61014717e-05f,
+    -1.59528381e-05f, -1.57895682e-05f, -1.56125151e-05f, -1.54225173e-05f, -1.52203982e-05f, -1.50069651e-05f, -1.47830094e-05f, -1.45493055e-05f,
+    -1.43066106e-05f, -1.40556644e-05f, -1.37971886e-05f, -1.35318864e-05f, -1.32604427e-05f, -1.29835232e-05f, -1.27017747e-05f, -1.24158247e-05f,
+    -1.21262811e-05f, -1.18337323e-05f, -1.15387469e-05f, -1.12418737e-05f, -1.09436419e-05f, -1.06445604e-05f, -1.03451188e-05f, -1.00457865e-05f,
+    -9.74701338e-06f, -9.44922952e-06f, -9.15284558e-06f, -8.85825278e-06f, -8.56582314e-06f, -8.27590959e-06f, -7.98884622e-06f, -7.70494849e-06f,
+    -7.42451350e-06f, -7.14782017e-06f, -6.87512961e-06f, -6.60668536e-06f, -6.34271370e-06f, -6.08342398e-06f, -5.82900899e-06f, -5.57964523e-06f,
+    -5.33549335e-06f, -5.09669848e-06f, -4.86339063e-06f, -4.63568506e-06f, -4.41368271e-06f, -4.19747057e-06f, -3.98712215e-06f, -3.78269781e-06f,
+    -3.58424529e-06f, -3.39180007e-06f, -3.20538582e-06f, -3.02501484e-06f, -2.85068849e-06f, -2.68239766e-06f, -2.52012316e-06f, -2.36383619e-06f,
+    -2.21349878e-06f, -2.06906424e-06f, -1.93047754e-06f, -1.79767583e-06f, -1.67058879e-06f, -1.54913912e-06f, -1.43324289e-06f, -1.32281005e-06f,
+    -1.21774478e-06f, -1.11794589e-06f, -1.02330728e-06f, -9.33718262e-07f, -8.49064013e-07f, -7.69225911e-07f, -6.94081923e-07f, -6.23506971e-07f,
+    -5.57373284e-07f, -4.95550745e-07f, -4.37907235e-07f, -3.84308953e-07f, -3.34620746e-07f, -2.88706409e-07f, -2.46428993e-07f, -2.07651090e-07f,
+    -1.72235116e-07f, -1.40043580e-07f, -1.10939343e-07f, -8.47858665e-08f, -6.14474513e-08f, -4.07894655e-08f, -2.26785611e-08f, -6.98288065e-09f,
+};
@@ -0,0 +1,29 @@
+#include "cqt.h"
+#include <math.h> // sqrtf
+
+/**
+ * @brief 常数 Q 变换 (稀疏频域核乘加)。
+ */
+void cqt_compute(const complex_t *spectrum, uint32_t first_bin, uint32_t num_bins, float *magnitudes)
+{
+    for (uint32_t k = 0; k < num_bins; k++)
+    {
+        const cqt_kernel_row_t *row = &cqt_kernel_rows[first_bin + k];
+        const int16_t(*kernel)[2] = &cqt_kernel_values[row->offset];
+        const complex_t *x = &spectrum[row->start_bin];
+
+        // 整数系数先与频谱相乘累加，最后统一乘以缩放系数
+        float acc_real = 0.0f;
+        float acc_imag = 0.0f;
+        for (uint32_t j = 0; j < row->length; j++)
+        {
+            float kr = (float)kernel[j][0];
+            float ki = (float)kernel[j][1];
+            acc_real += x[j].real * kr - x[j].imag * ki;
+            acc_imag += x[j].real * ki + x[j].imag * kr;
+        }
+
+        float scale = row->scale / (float)CQT_N;
+        magnitudes[k] = scale * sqrtf(acc_real * acc_real + acc_imag * acc_imag);
+    }
+}
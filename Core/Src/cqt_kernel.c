@@ -0,0 +1,203 @@
+/**
+ * @description: 常数 Q 变换稀疏频域核，由 gen_cqt_kernel.py 自动生成，请勿手动修改。
+ * @note: N = 1024, fs = 48000 Hz, fmin = 880 Hz, 12 频点/倍频程, 4 个倍频程, threshold = 0.01，共 1080 个非零系数。
+ */
+#include "cqt.h"
+
+const float cqt_center_freqs[CQT_NUM_BINS] = {
+    880.0000f, 932.3275f, 987.7666f, 1046.5023f, 1108.7305f, 1174.6591f, 1244.5079f, 1318.5102f,
+    1396.9129f, 1479.9777f, 1567.9817f, 1661.2188f, 1760.0000f, 1864.6550f, 1975.5332f, 2093.0045f,
+    2217.4610f, 2349.3181f, 2489.0159f, 2637.0205f, 2793.8259f, 2959.9554f, 3135.9635f, 3322.4376f,
+    3520.0000f, 3729.3101f, 3951.0664f, 4186.0090f, 4434.9221f, 4698.6363f, 4978.0317f, 5274.0409f,
+    5587.6517f, 5919.9108f, 6271.9270f, 6644.8752f, 7040.0000f, 7458.6202f, 7902.1328f, 8372.0181f,
+    8869.8442f, 9397.2726f, 9956.0635f, 10548.0818f, 11175.3034f, 11839.8215f, 12543.8540f, 13289.7503f,
+};
+
+const cqt_kernel_row_t cqt_kernel_rows[CQT_NUM_BINS] = {
+    {17, 4, 0, 2.46995032e-05f},
+    {18, 5, 4, 2.54362029e-05f},
+    {19, 5, 9, 2.55823575e-05f},
+    {20, 5, 14, 2.45398390e-05f},
+    {21, 6, 19, 2.52916392e-05f},
+    {23, 5, 25, 2.56105052e-05f},
+    {24, 6, 30, 2.51210089e-05f},
+    {25, 7, 36, 2.68790909e-05f},
+    {27, 7, 43, 2.53570786e-05f},
+    {28, 8, 50, 2.44463175e-05f},
+    {30, 8, 58, 2.61190262e-05f},
+    {32, 8, 66, 2.47523167e-05f},
+    {34, 8, 74, 2.63992511e-05f},
+    {36, 9, 82, 2.72635583e-05f},
+    {38, 9, 91, 2.74966139e-05f},
+    {40, 10, 100, 2.52125165e-05f},
+    {42, 11, 110, 2.76399730e-05f},
+    {45, 11, 121, 2.56089847e-05f},
+    {47, 12, 132, 2.79670051e-05f},
+    {50, 13, 144, 2.80572096e-05f},
+    {53, 14, 157, 2.79364539e-05f},
+    {56, 15, 171, 2.83155794e-05f},
+    {60, 15, 186, 2.55512324e-05f},
+    {63, 16, 201, 2.85805053e-05f},
+    {67, 17, 217, 2.56103715e-05f},
+    {71, 18, 234, 2.87094965e-05f},
+    {75, 19, 252, 2.90004639e-05f},
+    {80, 20, 271, 2.90947458e-05f},
+    {84, 21, 291, 2.92680483e-05f},
+    {89, 23, 312, 2.56059430e-05f},
+    {94, 24, 335, 2.95110281e-05f},
+    {100, 25, 359, 2.56151127e-05f},
+    {106, 27, 384, 2.98305841e-05f},
+    {112, 29, 411, 2.99485925e-05f},
+    {119, 30, 440, 3.00241509e-05f},
+    {126, 32, 470, 2.56057994e-05f},
+    {133, 34, 502, 3.03029172e-05f},
+    {140, 37, 536, 3.03959007e-05f},
+    {149, 38, 573, 3.04497102e-05f},
+    {158, 40, 611, 3.04608777e-05f},
+    {166, 43, 651, 2.56057330e-05f},
+    {178, 46, 694, 2.55998567e-05f},
+    {186, 49, 740, 2.56198940e-05f},
+    {198, 52, 789, 3.03040939e-05f},
+    {209, 55, 841, 3.01750346e-05f},
+    {221, 58, 896, 2.99471259e-05f},
+    {235, 61, 954, 2.96522119e-05f},
+    {250, 65, 1015, 2.92383479e-05f},
+};
+
+const int16_t cqt_kernel_values[1080][2] = {
+    {2842, 1861}, {-23242, -15120}, {32767, 21174}, {-11617, -7456}, {-2558, -1677}, {20764, 13519}, {-32767, -21192}, {15622, 10035},
+    {-889, -567}, {2071, 1359}, {-18187, -11855}, {32767, 21215}, {-20501, -13185}, {3019, 1929}, {-1264, -831}, {14959, 9767},
+    {-32767, -21252}, {27482, 17705}, {-7902, -5057}, {481, 274}, {-10707, -6016}, {29548, 16364}, {-32767, -17885}, {15390, 8278},
+    {-1692, -897}, {5867, 3850}, {-22105, -14406}, {32767, 21212}, {-23236, -14941}, {6661, 4254}, {-2576, -1436}, {15652, 8600},
+    {-31945, -17298}, {32767, 17484}, {-17037, -8957}, {3157, 1635}, {532, 296}, {-8006, -4385}, {23102, 12470}, {-32767, -17427},
+    {25968, 13608}, {-10583, -5463}, {1226, 623}, {2775, 1830}, {-13761, -9015}, {28140, 18310}, {-32767, -21179}, {22724, 14588},
+    {-8317, -5303}, {771, 488}, {-390, -259}, {6331, 4168}, {-19571, -12798}, {32115, 20862}, {-32767, -21142}, {20883, 13384},
+    {-7228, -4601}, {602, 380}, {-1338, -719}, {8884, 4702}, {-22101, -11525}, {32767, 16832}, {-32062, -16222}, {20590, 10259},
+    {-7682, -3769}, {918, 443}, {-2252, -1491}, {10498, 6907}, {-23173, -15143}, {32767, 21270}, {-32059, -20671}, {21603, 13835},
+    {-9139, -5813}, {1667, 1053}, {-2839, -1481}, {11115, 5713}, {-23158, -11724}, {32480, 16194}, {-32767, -16086}, {23802, 11504},
+    {-11686, -5560}, {3101, 1452}, {-2559, -1318}, {9801, 4971}, {-20695, -10338}, {30243, 14876}, {-32767, -15869}, {26636, 12699},
+    {-15703, -7369}, {5977, 2760}, {-913, -415}, {-2076, -1056}, {8260, 4137}, {-18134, -8943}, {27993, 13592}, {-32767, -15663},
+    {29717, 13981}, {-20596, -9536}, {10269, 4678}, {-3066, -1374}, {-1245, -831}, {6000, 3979}, {-14546, -9581}, {24593, 16091},
+    {-31875, -20716}, {32767, 21153}, {-26796, -17182}, {16989, 10820}, {-7746, -4900}, {2012, 1264}, {-569, -283}, {3871, 1896},
+    {-10649, -5134}, {19871, 9429}, {-28455, -13289}, {32767, 15059}, {-30803, -13928}, {23477, 10442}, {-14037, -6141}, {6045, 2601},
+    {-1425, -603}, {1536, 1028}, {-5874, -3907}, {13218, 8732}, {-22078, -14488}, {29566, 19273}, {-32767, -21217}, {30340, 19513},
+    {-23298, -14883}, {14422, 9151}, {-6718, -4234}, {1932, 1210}, {333, 160}, {-2682, -1271}, {7723, 3601}, {-15242, -6994},
+    {23599, 10654}, {-30226, -13423}, {32767, 14311}, {-30261, -12996}, {23645, 9984}, {-15270, -6337}, {7721, 3149}, {-2659, -1065},
+    {-673, -317}, {3364, 1558}, {-8523, -3882}, {15794, 7078}, {-23691, -10443}, {30020, 13014}, {-32767, -13966}, {31002, 12990},
+    {-25317, -10425}, {17552, 7102}, {-9956, -3958}, {4246, 1658}, {-1040, -399}, {518, 239}, {-2780, -1261}, {7213, 3219},
+    {-13706, -6016}, {21234, 9166}, {-28061, -11909}, {32326, 13485}, {-32767, -13434}, {29248, 11782}, {-22811, -9027}, {15251, 5927},
+    {-8402, -3206}, {3485, 1305}, {-803, -295}, {-391, -177}, {2276, 1012}, {-6035, -2638}, {11710, 5033}, {-18624, -7870},
+    {25458, 10574}, {-30616, -12496}, {32767, 13140}, {-31328, -12341}, {26684, 10323}, {-20045, -7613}, {13005, 4848}, {-6987, -2556},
+    {2822, 1013}, {-605, -213}, {-1550, -1050}, {4508, 3032}, {-9240, -6173}, {15410, 10227}, {-22109, -14575}, {28042, 18364},
+    {-31900, -20751}, {32767, 21172}, {-30430, -19530}, {25450, 16224}, {-18974, -12014}, {12361, 7774}, {-6771, -4229}, {2863, 1776},
+    {-702, -432}, {485, 208}, {-2192, -925}, {5380, 2230}, {-10121, -4124}, {16045, 6422}, {-22336, -8782}, {27899, 10772},
+    {-31639, -11993}, {32767, 12191}, {-31037, -11332}, {26819, 9606}, {-20989, -7372}, {14672, 5053}, {-8932, -3015}, {4503, 1489},
+    {-1660, -538}, {1041, 710}, {-3173, -2150}, {6700, 4510}, {-11563, -7732}, {17334, 11514}, {-23249, -15340}, {28356, 18585},
+    {-31743, -20666}, {32767, 21190}, {-31227, -20058}, {27418, 17493}, {-22055, -13976}, {16080, 10121}, {-10427, -6519}, {5807, 3606},
+    {-2576, -1589}, {719, 440}, {1027, 413}, {-2993, -1182}, {6199, 2404}, {-10629, -4048}, {15970, 5969}, {-21629, -7933},
+    {26827, 9654}, {-30757, -10856}, {32767, 11339}, {-32508, -11027}, {30022, 9979}, {-25734, -8378}, {20347, 6487}, {-14679, -4581},
+    {9486, 2896}, {-5308, -1585}, {2392, 698}, {-695, -198}, {830, 324}, {-2489, -954}, {5226, 1965}, {-9078, -3350},
+    {13857, 5017}, {-19138, -6797}, {24317, 8469}, {-28706, -9801}, {31673, 10597}, {-32767, -10740}, {31816, 10212}, {-28966, -9102},
+    {24649, 7579}, {-19489, -5862}, {14177, 4170}, {-9333, -2683}, {5401, 1517}, {-2588, -710}, {870, 233}, {-1257, -469},
+    {3100, 1135}, {-5926, -2130}, {9728, 3429}, {-14313, -4947}, {19307, 6540}, {-24196, -8031}, {28404, 9235}, {-31395, -9995},
+    {32767, 10211}, {-32330, -9857}, {30143, 8988}, {-26501, -7726}, {21884, 6234}, {-16860, -4691}, {11990, 3257}, {-7734, -2050},
+    {4384, 1133}, {-2044, -515}, {643, 158}, {-822, -298}, {2243, 797}, {-4511, -1572}, {7678, 2624}, {-11658, -3904},
+    {16212, 5319}, {-20967, -6737}, {25455, 8007}, {-29187, -8985}, {31728, 9554}, {-32767, -9648}, {32175, 9260}, {-30023, -8441},
+    {26574, 7296}, {-22236, -5958}, {17492, 4572}, {-12825, -3269}, {8646, 2147}, {-5234, -1266}, {2722, 641}, {-1089, -249},
+    {501, 349}, {-1569, -1086}, {3335, 2293}, {-5887, -4022}, {9215, 6254}, {-13192, -8894}, {17575, 11771}, {-22023, -14652},
+    {26138, 17275}, {-29518, -19379}, {31810, 20744}, {-32767, -21225}, {32283, 20771}, {-30409, -19434}, {27347, 17359}, {-23421, -14766},
+    {19022, 11912}, {-14561, -9056}, {10404, 6426}, {-6833, -4192}, {4017, 2447}, {-2003, -1212}, {733, 441}, {-571, -190},
+    {1620, 529}, {-3301, -1056}, {5690, 1781}, {-8782, -2690}, {12478, 3739}, {-16586, -4858}, {20828, 5963}, {-24873, -6956},
+    {28374, 7748}, {-31007, -8263}, {32522, 8453}, {-32767, -8302}, {31718, 7830}, {-29478, -7085}, {26263, 6142}, {-22372, -5088},
+    {18151, 4011}, {-13944, -2992}, {10055, 2093}, {-6713, -1354}, {4055, 792}, {-2117, -400}, {854, 156}, {-1000, -700},
+    {2242, 1559}, {-4081, -2820}, {6558, 4501}, {-9642, -6574}, {13230, 8961}, {-17142, -11535}, {21136, 14128}, {-24931, -16554},
+    {28232, 18622}, {-30770, -20161}, {32328, 21040}, {-32767, -21183}, {32049, 20579}, {-30235, -19284}, {27483, 17410}, {-24025, -15117},
+    {20141, 12587}, {-16126, -10009}, {12258, 7556}, {-8767, -5367}, {5817, 3537}, {-3497, -2112}, {1817, 1090}, {-723, -430},
+    {-831, -247}, {1890, 548}, {-3465, -982}, {5601, 1550}, {-8294, -2241}, {11482, 3026}, {-15041, -3866}, {18794, 4708},
+    {-22520, -5494}, {25977, 6169}, {-28921, -6681}, {31136, 6992}, {-32452, -7078}, {32767, 6937}, {-32055, -6581}, {30370, 6041},
+    {-27844, -5361}, {24666, 4592}, {-21066, -3789}, {17291, 3000}, {-13579, -2270}, {10138, 1631}, {-7126, -1102}, {4644, 689},
+    {-2732, -388}, {1374, 187}, {-505, -65}, {-696, -195}, {1606, 439}, {-2962, -790}, {4812, 1252}, {-7167, -1817},
+    {9992, 2468}, {-13206, -3176}, {16679, 3903}, {-20242, -4606}, {23701, 5241}, {-26846, -5764}, {29479, 6140}, {-31423, -6344},
+    {32545, 6363}, {-32767, -6198}, {32072, 5863}, {-30508, -5384}, {28184, 4795}, {-25255, -4138}, {21914, 3452}, {-18366, -2778},
+    {14817, 2148}, {-11452, -1589}, {8420, 1116}, {-5829, -736}, {3736, 448}, {-2151, -245}, {1041, 112}, {-343, -35},
+    {741, 192}, {-1610, -407}, {2874, 708}, {-4575, -1097}, {6726, 1570}, {-9303, -2111}, {12247, 2700}, {-15459, -3309},
+    {18809, 3905}, {-22139, -4455}, {25278, 4926}, {-28054, -5288}, {30307, 5520}, {-31901, -5609}, {32738, 5549}, {-32767, -5347},
+    {31985, 5019}, {-30440, -4585}, {28227, 4075}, {-25478, -3518}, {22352, 2947}, {-19022, -2389}, {15660, 1870}, {-12426, -1406},
+    {9454, 1011}, {-6844, -690}, {4662, 441}, {-2932, -259}, {1643, 135}, {-755, -57}, {-851, -609}, {1710, 1215},
+    {-2923, -2064}, {4526, 3175}, {-6528, -4549}, {8912, 6170}, {-11632, -8001}, {14611, 9984}, {-17744, -12045}, {20905, 14098},
+    {-23953, -16046}, {26742, 17796}, {-29131, -19257}, {30993, 20352}, {-32228, -21021}, {32767, 21230}, {-32579, -20967}, {31675, 20248},
+    {-30103, -19113}, {27950, 17626}, {-25329, -15864}, {22375, 13919}, {-19236, -11885}, {16057, 9852}, {-12973, -7906}, {10104, 6115},
+    {-7540, -4532}, {5345, 3190}, {-3551, -2104}, {2159, 1271}, {-1146, -670}, {467, 271}, {484, 107}, {-1108, -238},
+    {2020, 421}, {-3260, -659}, {4852, 949}, {-6799, -1287}, {9084, 1662}, {-11664, -2060}, {14474, 2465}, {-17426, -2858},
+    {20414, 3219}, {-23321, -3531}, {26024, 3777}, {-28403, -3945}, {30348, 4025}, {-31765, -4015}, {32584, 3915}, {-32767, -3734},
+    {32303, 3480}, {-31215, -3169}, {29556, 2818}, {-27406, -2443}, {24868, 2063}, {-22055, -1694}, {19093, 1348}, {-16101, -1038},
+    {13194, 769}, {-10470, -546}, {8009, 368}, {-5866, -234}, {4074, 137}, {-2640, -73}, {1551, 33}, {-775, -12},
+    {-350, -71}, {862, 169}, {-1619, -308}, {2658, 488}, {-4004, -710}, {5670, 970}, {-7651, -1260}, {9923, 1572},
+    {-12442, -1893}, {15148, 2210}, {-17960, -2508}, {20787, 2773}, {-23526, -2991}, {26075, 3153}, {-28329, -3249}, {30196, 3276},
+    {-31595, -3232}, {32465, 3119}, {-32767, -2946}, {32488, 2720}, {-31639, -2453}, {30259, 2160}, {-28408, -1852}, {26164, 1545},
+    {-23622, -1249}, {20884, 976}, {-18055, -733}, {15236, 525}, {-12521, -354}, {9989, 221}, {-7704, -123}, {5710, 56},
+    {-4032, -15}, {2675, -6}, {-1628, 14}, {864, -13}, {-348, 7}, {750, 131}, {-1411, -238}, {2317, 376},
+    {-3491, -544}, {4949, 741}, {-6692, -960}, {8707, 1194}, {-10966, -1435}, {13425, 1674}, {-16026, -1898}, {18697, 2098},
+    {-21359, -2264}, {23925, 2388}, {-26305, -2463}, {28416, 2484}, {-30177, -2452}, {31521, 2367}, {-32396, -2232}, {32767, 2056},
+    {-32619, -1846}, {31958, 1612}, {-30811, -1365}, {29221, 1115}, {-27251, -872}, {24974, 646}, {-22475, -443}, {19841, 269},
+    {-17161, -128}, {14517, 19}, {-11987, 58}, {9633, -106}, {-7507, 128}, {5643, -131}, {-4062, 119}, {2767, -98},
+    {-1750, 73}, {990, -47}, {-456, 25}, {-653, -98}, {1229, 178}, {-2016, -279}, {3035, 401}, {-4303, -541},
+    {5825, 696}, {-7595, -860}, {9598, 1028}, {-11803, -1191}, {14170, 1342}, {-16645, -1473}, {19168, 1578}, {-21670, -1650},
+    {24078, 1685}, {-26318, -1679}, {28318, 1632}, {-30013, -1545}, {31344, 1421}, {-32265, -1265}, {32745, 1082}, {-32767, -882},
+    {32329, 671}, {-31447, -460}, {30152, 256}, {-28489, -67}, {26514, -100}, {-24292, 241}, {21896, -351}, {-19398, 430},
+    {16873, -478}, {-14389, 496}, {12008, -488}, {-9785, 458}, {7761, -411}, {-5968, 353}, {4422, -288}, {-3132, 224},
+    {2090, -162}, {-1284, 108}, {690, -62}, {-405, -301}, {835, 617}, {-1435, -1053}, {2227, 1624}, {-3229, -2340},
+    {4453, 3207}, {-5904, -4224}, {7576, 5385}, {-9455, -6677}, {11518, 8081}, {-13730, -9570}, {16049, 11114}, {-18425, -12676},
+    {20801, 14216}, {-23117, -15695}, {25309, 17071}, {-27317, -18303}, {29081, 19356}, {-30548, -20198}, {31673, 20802}, {-32421, -21151},
+    {32767, 21234}, {-32700, -21049}, {32223, 20602}, {-31349, -19908}, {30106, 18989}, {-28532, -17874}, {26675, 16597}, {-24590, -15195},
+    {22338, 13709}, {-19982, -12179}, {17584, 10644}, {-15205, -9140}, {12900, 7701}, {-10720, -6355}, {8703, 5123}, {-6882, -4023},
+    {5278, 3063}, {-3902, -2249}, {2755, 1577}, {-1832, -1041}, {1118, 630}, {-591, -331}, {-563, -421}, {1019, 758},
+    {-1630, -1205}, {2413, 1773}, {-3383, -2468}, {4546, 3296}, {-5907, -4255}, {7462, 5340}, {-9198, -6541}, {11098, 7840},
+    {-13135, -9219}, {15277, 10653}, {-17483, -12111}, {19710, 13565}, {-21909, -14980}, {24030, 16322}, {-26021, -17558}, {27834, 18657},
+    {-29420, -19589}, {30738, 20331}, {-31752, -20863}, {32435, 21169}, {-32767, -21242}, {32739, 21082}, {-32350, -20691}, {31612, 20083},
+    {-30545, -19274}, {29177, 18286}, {-27545, -17145}, {25691, 15882}, {-23664, -14529}, {21514, 13118}, {-19292, -11682}, {17050, 10253},
+    {-14836, -8860}, {12694, 7528}, {-10664, -6280}, {8779, 5134}, {-7063, -4101}, {5536, 3192}, {-4207, -2408}, {3079, 1750},
+    {-2148, -1213}, {1405, 787}, {-834, -464}, {417, 230}, {-344, -261}, {691, 520}, {-1165, -871}, {1784, 1325},
+    {-2561, -1890}, {3509, 2573}, {-4634, -3376}, {5938, 4299}, {-7417, -5335}, {9062, 6476}, {-10857, -7709}, {12780, 9015},
+    {-14802, -10374}, {16892, 11761}, {-19012, -13150}, {21120, 14513}, {-23174, -15820}, {25129, 17042}, {-26941, -18150}, {28569, 19120},
+    {-29973, -19927}, {31121, 20552}, {-31982, -20981}, {32535, 21201}, {-32767, -21209}, {32671, 21005}, {-32249, -20594}, {31511, 19987},
+    {-30477, -19200}, {29170, 18252}, {-27623, -17166}, {25872, 15969}, {-23960, -14687}, {21928, 13349}, {-19823, -11984}, {17687, 10619},
+    {-15565, -9280}, {13496, 7990}, {-11515, -6770}, {9653, 5636}, {-7935, -4600}, {6381, 3673}, {-5002, -2859}, {3805, 2159},
+    {-2791, -1572}, {1953, 1093}, {-1283, -712}, {766, 422}, {-385, -210}, {-352, -16}, {685, 27}, {-1133, -38},
+    {1710, 47}, {-2429, -51}, {3300, 49}, {-4328, -38}, {5517, 15}, {-6864, 24}, {8362, -80}, {-10001, 157},
+    {11763, -257}, {-13627, 381}, {15568, -531}, {-17557, 707}, {19560, -908}, {-21543, 1132}, {23468, -1378}, {-25300, 1642},
+    {27001, -1918}, {-28536, 2204}, {29874, -2491}, {-30986, 2776}, {31846, -3050}, {-32438, 3307}, {32747, -3542}, {-32767, 3748},
+    {32497, -3919}, {-31944, 4051}, {31120, -4141}, {-30043, 4185}, {28737, -4183}, {-27230, 4135}, {25553, -4041}, {-23741, 3904},
+    {21831, -3727}, {-19859, 3516}, {17861, -3276}, {-15874, 3012}, {13930, -2732}, {-12058, 2441}, {10284, -2148}, {-8631, 1858},
+    {7114, -1577}, {-5747, 1311}, {4536, -1064}, {-3485, 840}, {2590, -641}, {-1848, 470}, {1247, -325}, {-777, 208},
+    {423, -116}, {404, 6}, {-735, -7}, {1170, 4}, {-1722, 5}, {2402, -21}, {-3218, 48}, {4175, -88},
+    {-5277, 144}, {6521, -217}, {-7903, 312}, {9415, -430}, {-11043, 572}, {12771, -740}, {-14580, 935}, {16444, -1155},
+    {-18338, 1402}, {20233, -1671}, {-22099, 1962}, {23903, -2270}, {-25615, 2591}, {27204, -2921}, {-28639, 3253}, {29895, -3582},
+    {-30946, 3900}, {31773, -4203}, {-32359, 4482}, {32693, -4733}, {-32767, 4949}, {32581, -5126}, {-32138, 5259}, {31448, -5344},
+    {-30523, 5380}, {29384, -5365}, {-28050, 5300}, {26549, -5185}, {-24909, 5023}, {23159, -4819}, {-21331, 4575}, {19455, -4298},
+    {-17564, 3993}, {15686, -3668}, {-13850, 3328}, {12079, -2981}, {-10397, 2634}, {8821, -2292}, {-7367, 1963}, {6045, -1650},
+    {-4862, 1359}, {3822, -1094}, {-2923, 856}, {2162, -648}, {-1533, 469}, {1026, -321}, {-630, 201}, {333, -109},
+    {386, -6}, {-690, 15}, {1085, -31}, {-1583, 54}, {2194, -89}, {-2923, 136}, {3778, -199}, {-4762, 281},
+    {5873, -382}, {-7111, 507}, {8470, -656}, {-9940, 831}, {11511, -1034}, {-13166, 1264}, {14888, -1521}, {-16657, 1805},
+    {18450, -2114}, {-20242, 2445}, {22007, -2796}, {-23720, 3161}, {25353, -3538}, {-26880, 3919}, {28276, -4300}, {-29517, 4674},
+    {30582, -5035}, {-31454, 5377}, {32115, -5693}, {-32556, 5978}, {32767, -6225}, {-32746, 6429}, {32493, -6587}, {-32012, 6694},
+    {31313, -6748}, {-30407, 6749}, {29311, -6694}, {-28044, 6586}, {26628, -6426}, {-25086, 6217}, {23444, -5963}, {-21727, 5669},
+    {19963, -5340}, {-18178, 4982}, {16397, -4602}, {-14644, 4207}, {12940, -3804}, {-11307, 3399}, {9760, -3000}, {-8314, 2611},
+    {6980, -2239}, {-5766, 1889}, {4677, -1564}, {-3715, 1268}, {2880, -1002}, {-2167, 769}, {1571, -568}, {-1084, 400},
+    {696, -262}, {-399, 153}, {507, -28}, {-825, 50}, {1229, -82}, {-1727, 127}, {2326, -185}, {-3033, 260},
+    {3851, -353}, {-4783, 469}, {5829, -607}, {-6988, 771}, {8254, -962}, {-9621, 1182}, {11079, -1430}, {-12617, 1707},
+    {14219, -2013}, {-15870, 2346}, {17551, -2704}, {-19243, 3086}, {20924, -3487}, {-22572, 3905}, {24166, -4333}, {-25682, 4768},
+    {27099, -5203}, {-28397, 5633}, {29555, -6052}, {-30556, 6452}, {31386, -6829}, {-32030, 7175}, {32479, -7485}, {-32726, 7754},
+    {32767, -7976}, {-32602, 8148}, {32233, -8267}, {-31666, 8329}, {30911, -8333}, {-29979, 8280}, {28885, -8169}, {-27646, 8002},
+    {26281, -7782}, {-24809, 7512}, {23252, -7196}, {-21633, 6841}, {19973, -6451}, {-18294, 6033}, {16618, -5593}, {-14963, 5139},
+    {13350, -4677}, {-11794, 4213}, {10311, -3755}, {-8914, 3308}, {7611, -2878}, {-6412, 2470}, {5322, -2087}, {-4343, 1734},
+    {3477, -1413}, {-2721, 1126}, {2073, -872}, {-1527, 654}, {1076, -469}, {-714, 316}, {430, -193}, {-422, 40},
+    {695, -69}, {-1040, 110}, {1464, -164}, {-1974, 234}, {2576, -321}, {-3275, 429}, {4072, -559}, {-4971, 713},
+    {5970, -894}, {-7067, 1103}, {8259, -1341}, {-9540, 1609}, {10902, -1908}, {-12335, 2236}, {13828, -2595}, {-15368, 2981},
+    {16938, -3394}, {-18525, 3830}, {20110, -4287}, {-21676, 4760}, {23204, -5245}, {-24675, 5737}, {26072, -6230}, {-27377, 6720},
+    {28573, -7200}, {-29643, 7663}, {30574, -8104}, {-31352, 8517}, {31968, -8895}, {-32413, 9234}, {32680, -9527}, {-32767, 9771},
+    {32672, -9961}, {-32396, 10095}, {31944, -10169}, {-31322, 10183}, {30539, -10136}, {-29605, 10028}, {28534, -9861}, {-27340, 9637},
+    {26039, -9358}, {-24648, 9029}, {23184, -8655}, {-21666, 8240}, {20112, -7790}, {-18540, 7313}, {16967, -6813}, {-15411, 6298},
+    {13886, -5775}, {-12408, 5250}, {10989, -4729}, {-9640, 4219}, {8370, -3724}, {-7188, 3251}, {6098, -2803}, {-5104, 2385},
+    {4209, -1998}, {-3411, 1645}, {2711, -1328}, {-2105, 1047}, {1588, -802}, {-1155, 593}, {801, -417}, {-517, 273},
+};
@@ -0,0 +1,75 @@
+#include "dds.h"
+#include <math.h> // floor
+
+#define DDS_FRACTION_BITS (30 - DDS_QUARTER_BITS)                  // 象限内相位中用于插值的位数
+#define DDS_FRACTION_MASK ((1u << DDS_FRACTION_BITS) - 1u)
+#define DDS_FRACTION_SCALE (1.0f / (float)(1u << DDS_FRACTION_BITS)) // 插值位转换为 0 ~ 1
+
+/**
+ * @brief 由频率计算相位增量 (双精度计算，避免 float 在 2^32 量级上的舍入)。
+ */
+uint32_t dds_phase_step(float freq, float sample_rate)
+{
+    // 超出 [0, sample_rate) 的频率按混叠后的频率处理，避免浮点转无符号整数越界 (未定义行为)
+    double cycles = (double)freq / (double)sample_rate;
+    cycles -= floor(cycles);
+    return (uint32_t)(uint64_t)(cycles * 4294967296.0);
+}
+
+/**
+ * @brief 四分之一周期查表 + 线性插值。
+ */
+float dds_sin(uint32_t phase)
+{
+    uint32_t quadrant = phase >> 30;
+    uint32_t quarter_phase = phase & 0x3FFFFFFFu;
+    if (quadrant & 1u)
+    {
+        // 第 2、4 象限镜像: sin(pi/2 + x) = sin(pi/2 - x)，减 1 使下标不超过 DDS_QUARTER_SIZE - 1 (误差 2^-32 周期)
+        quarter_phase = 0x3FFFFFFFu - quarter_phase;
+    }
+
+    uint32_t index = quarter_phase >> DDS_FRACTION_BITS;
+    float fraction = (float)(quarter_phase & DDS_FRACTION_MASK) * DDS_FRACTION_SCALE;
+    float a = dds_quarter_sine[index];
+    float value = a + (dds_quarter_sine[index + 1] - a) * fraction;
+
+    return (quadrant & 2u) ? -value : value; // 第 3、4 象限取负
+}
+
+/**
+ * @brief 初始化振荡器。
+ */
+void dds_init(dds_oscillator_t *osc, float freq, float sample_rate, float amplitude, float offset)
+{
+    osc->phase = 0;
+    dds_set(osc, freq, sample_rate, amplitude, offset);
+}
+
+/**
+ * @brief 修改参数，保持相位。
+ */
+void dds_set(dds_oscillator_t *osc, float freq, float sample_rate, float amplitude, float offset)
+{
+    osc->phase_step = dds_phase_step(freq, sample_rate);
+    osc->amplitude = amplitude;
+    osc->offset = offset;
+}
+
+/**
+ * @brief 生成 len 个采样并推进相位。
+ */
+void dds_generate(dds_oscillator_t *osc, float *buffer, uint32_t len)
+{
+    uint32_t phase = osc->phase;
+    uint32_t step = osc->phase_step;
+    float amplitude = osc->amplitude;
+    float offset = osc->offset;
+
+    for (uint32_t i = 0; i < len; i++)
+    {
+        buffer[i] = amplitude * dds_sin(phase) + offset;
+        phase += step; // 按 2^32 自然回绕
+    }
+    osc->phase = phase;
+}
@@ -0,0 +1,73 @@
+/**
+ * @description: DDS 四分之一周期正弦表，由 gen_dds_table.py 自动生成，请勿手动修改。
+ * @note: Q = 512，共 513 项，线性插值最大误差 1.18e-06。
+ */
+#include "dds.h"
+
+const float dds_quarter_sine[DDS_QUARTER_SIZE + 1] = {
+    0.000000000f, 0.003067957f, 0.006135885f, 0.009203755f, 0.012271538f, 0.015339206f, 0.018406730f, 0.021474080f,
+    0.024541229f, 0.027608146f, 0.030674803f, 0.033741172f, 0.036807223f, 0.039872928f, 0.042938257f, 0.046003182f,
+    0.049067674f, 0.052131705f, 0.055195244f, 0.058258265f, 0.061320736f, 0.064382631f, 0.067443920f, 0.070504573f,
+    0.073564564f, 0.076623861f, 0.079682438f, 0.082740265f, 0.085797312f, 0.088853553f, 0.091908956f, 0.094963495f,
+    0.098017140f, 0.101069863f, 0.104121634f, 0.107172425f, 0.110222207f, 0.113270952f, 0.116318631f, 0.119365215f,
+    0.122410675f, 0.125454983f, 0.128498111f, 0.131540029f, 0.134580709f, 0.137620122f, 0.140658239f, 0.143695033f,
+    0.146730474f, 0.149764535f, 0.152797185f, 0.155828398f, 0.158858143f, 0.161886394f, 0.164913120f, 0.167938295f,
+    0.170961889f, 0.173983873f, 0.177004220f, 0.180022901f, 0.183039888f, 0.186055152f, 0.189068664f, 0.192080397f,
+    0.195090322f, 0.198098411f, 0.201104635f, 0.204108966f, 0.207111376f, 0.210111837f, 0.213110320f, 0.216106797f,
+    0.219101240f, 0.222093621f, 0.225083911f, 0.228072083f, 0.231058108f, 0.234041959f, 0.237023606f, 0.240003022f,
+    0.242980180f, 0.245955050f, 0.248927606f, 0.251897818f, 0.254865660f, 0.257831102f, 0.260794118f, 0.263754679f,
+    0.266712757f, 0.269668326f, 0.272621355f, 0.275571819f, 0.278519689f, 0.281464938f, 0.284407537f, 0.287347460f,
+    0.290284677f, 0.293219163f, 0.296150888f, 0.299079826f, 0.302005949f, 0.304929230f, 0.307849640f, 0.310767153f,
+    0.313681740f, 0.316593376f, 0.319502031f, 0.322407679f, 0.325310292f, 0.328209844f, 0.331106306f, 0.333999651f,
+    0.336889853f, 0.339776884f, 0.342660717f, 0.345541325f, 0.348418680f, 0.351292756f, 0.354163525f, 0.357030961f,
+    0.359895037f, 0.362755724f, 0.365612998f, 0.368466830f, 0.371317194f, 0.374164063f, 0.377007410f, 0.379847209f,
+    0.382683432f, 0.385516054f, 0.388345047f, 0.391170384f, 0.393992040f, 0.396809987f, 0.399624200f, 0.402434651f,
+    0.405241314f, 0.408044163f, 0.410843171f, 0.413638312f, 0.416429560f, 0.419216888f, 0.422000271f, 0.424779681f,
+    0.427555093f, 0.430326481f, 0.433093819f, 0.435857080f, 0.438616239f, 0.441371269f, 0.444122145f, 0.446868840f,
+    0.449611330f, 0.452349587f, 0.455083587f, 0.457813304f, 0.460538711f, 0.463259784f, 0.465976496f, 0.468688822f,
+    0.471396737f, 0.474100215f, 0.476799230f, 0.479493758f, 0.482183772f, 0.484869248f, 0.487550160f, 0.490226483f,
+    0.492898192f, 0.495565262f, 0.498227667f, 0.500885383f, 0.503538384f, 0.506186645f, 0.508830143f, 0.511468850f,
+    0.514102744f, 0.516731799f, 0.519355990f, 0.521975293f, 0.524589683f, 0.527199135f, 0.529803625f, 0.532403128f,
+    0.534997620f, 0.537587076f, 0.540171473f, 0.542750785f, 0.545324988f, 0.547894059f, 0.550457973f, 0.553016706f,
+    0.555570233f, 0.558118531f, 0.560661576f, 0.563199344f, 0.565731811f, 0.568258953f, 0.570780746f, 0.573297167f,
+    0.575808191f, 0.578313796f, 0.580813958f, 0.583308653f, 0.585797857f, 0.588281548f, 0.590759702f, 0.593232295f,
+    0.595699304f, 0.598160707f, 0.600616479f, 0.603066599f, 0.605511041f, 0.607949785f, 0.610382806f, 0.612810082f,
+    0.615231591f, 0.617647308f, 0.620057212f, 0.622461279f, 0.624859488f, 0.627251815f, 0.629638239f, 0.632018736f,
+    0.634393284f, 0.636761861f, 0.639124445f, 0.641481013f, 0.643831543f, 0.646176013f, 0.648514401f, 0.650846685f,
+    0.653172843f, 0.655492853f, 0.657806693f, 0.660114342f, 0.662415778f, 0.664710978f, 0.666999922f, 0.669282588f,
+    0.671558955f, 0.673829000f, 0.676092704f, 0.678350043f, 0.680600998f, 0.682845546f, 0.685083668f, 0.687315341f,
+    0.689540545f, 0.691759258f, 0.693971461f, 0.696177131f, 0.698376249f, 0.700568794f, 0.702754744f, 0.704934080f,
+    0.707106781f, 0.709272826f, 0.711432196f, 0.713584869f, 0.715730825f, 0.717870045f, 0.720002508f, 0.722128194f,
+    0.724247083f, 0.726359155f, 0.728464390f, 0.730562769f, 0.732654272f, 0.734738878f, 0.736816569f, 0.738887324f,
+    0.740951125f, 0.743007952f, 0.745057785f, 0.747100606f, 0.749136395f, 0.751165132f, 0.753186799f, 0.755201377f,
+    0.757208847f, 0.759209189f, 0.761202385f, 0.763188417f, 0.765167266f, 0.767138912f, 0.769103338f, 0.771060524f,
+    0.773010453f, 0.774953107f, 0.776888466f, 0.778816512f, 0.780737229f, 0.782650596f, 0.784556597f, 0.786455214f,
+    0.788346428f, 0.790230221f, 0.792106577f, 0.793975478f, 0.795836905f, 0.797690841f, 0.799537269f, 0.801376172f,
+    0.803207531f, 0.805031331f, 0.806847554f, 0.808656182f, 0.810457198f, 0.812250587f, 0.814036330f, 0.815814411f,
+    0.817584813f, 0.819347520f, 0.821102515f, 0.822849781f, 0.824589303f, 0.826321063f, 0.828045045f, 0.829761234f,
+    0.831469612f, 0.833170165f, 0.834862875f, 0.836547727f, 0.838224706f, 0.839893794f, 0.841554977f, 0.843208240f,
+    0.844853565f, 0.846490939f, 0.848120345f, 0.849741768f, 0.851355193f, 0.852960605f, 0.854557988f, 0.856147328f,
+    0.857728610f, 0.859301818f, 0.860866939f, 0.862423956f, 0.863972856f, 0.865513624f, 0.867046246f, 0.868570706f,
+    0.870086991f, 0.871595087f, 0.873094978f, 0.874586652f, 0.876070094f, 0.877545290f, 0.879012226f, 0.880470889f,
+    0.881921264f, 0.883363339f, 0.884797098f, 0.886222530f, 0.887639620f, 0.889048356f, 0.890448723f, 0.891840709f,
+    0.893224301f, 0.894599486f, 0.895966250f, 0.897324581f, 0.898674466f, 0.900015892f, 0.901348847f, 0.902673318f,
+    0.903989293f, 0.905296759f, 0.906595705f, 0.907886116f, 0.909167983f, 0.910441292f, 0.911706032f, 0.912962190f,
+    0.914209756f, 0.915448716f, 0.916679060f, 0.917900776f, 0.919113852f, 0.920318277f, 0.921514039f, 0.922701128f,
+    0.923879533f, 0.925049241f, 0.926210242f, 0.927362526f, 0.928506080f, 0.929640896f, 0.930766961f, 0.931884266f,
+    0.932992799f, 0.934092550f, 0.935183510f, 0.936265667f, 0.937339012f, 0.938403534f, 0.939459224f, 0.940506071f,
+    0.941544065f, 0.942573198f, 0.943593458f, 0.944604837f, 0.945607325f, 0.946600913f, 0.947585591f, 0.948561350f,
+    0.949528181f, 0.950486074f, 0.951435021f, 0.952375013f, 0.953306040f, 0.954228095f, 0.955141168f, 0.956045251f,
+    0.956940336f, 0.957826413f, 0.958703475f, 0.959571513f, 0.960430519f, 0.961280486f, 0.962121404f, 0.962953267f,
+    0.963776066f, 0.964589793f, 0.965394442f, 0.966190003f, 0.966976471f, 0.967753837f, 0.968522094f, 0.969281235f,
+    0.970031253f, 0.970772141f, 0.971503891f, 0.972226497f, 0.972939952f, 0.973644250f, 0.974339383f, 0.975025345f,
+    0.975702130f, 0.976369731f, 0.977028143f, 0.977677358f, 0.978317371f, 0.978948175f, 0.979569766f, 0.980182136f,
+    0.980785280f, 0.981379193f, 0.981963869f, 0.982539302f, 0.983105487f, 0.983662419f, 0.984210092f, 0.984748502f,
+    0.985277642f, 0.985797509f, 0.986308097f, 0.986809402f, 0.987301418f, 0.987784142f, 0.988257568f, 0.988721692f,
+    0.989176510f, 0.989622017f, 0.990058210f, 0.990485084f, 0.990902635f, 0.991310860f, 0.991709754f, 0.992099313f,
+    0.992479535f, 0.992850414f, 0.993211949f, 0.993564136f, 0.993906970f, 0.994240449f, 0.994564571f, 0.994879331f,
+    0.995184727f, 0.995480755f, 0.995767414f, 0.996044701f, 0.996312612f, 0.996571146f, 0.996820299f, 0.997060070f,
+    0.997290457f, 0.997511456f, 0.997723067f, 0.997925286f, 0.998118113f, 0.998301545f, 0.998475581f, 0.998640218f,
+    0.998795456f, 0.998941293f, 0.999077728f, 0.999204759f, 0.999322385f, 0.999430605f, 0.999529418f, 0.999618822f,
+    0.999698819f, 0.999769405f, 0.999830582f, 0.999882347f, 0.999924702f, 0.999957645f, 0.999981175f, 0.999995294f,
+    1.000000000f,
+};
@@ -0,0 +1,275 @@
+/**
+ * @description: DPSS (Slepian) 窗函数表，由 gen_dpss_tables.py 自动生成，请勿手动修改。
+ * @note: N = 1024, NW = 2.5, K = 4，每个窗只保存前 N/2 点 (单位能量归一化)。
+ */
+#include "multitaper.h"
+
+const float dpss_eigenvalues[MULTITAPER_K] = {
+    0.99999718f, 0.99984301f, 0.99621561f, 0.95212502f};
+
+const float dpss_half_tapers[MULTITAPER_K][MULTITAPER_N / 2] = {
+    {
+        2.09542404e-04f, 2.20703373e-04f, 2.32146824e-04f, 2.43876573e-04f, 2.55896454e-04f, 2.68210315e-04f, 2.80822019e-04f, 2.93735445e-04f,
+        3.06954483e-04f, 3.20483040e-04f, 3.34325036e-04f, 3.48484403e-04f, 3.62965087e-04f, 3.77771046e-04f, 3.92906250e-04f, 4.08374682e-04f,
+        4.24180334e-04f, 4.40327210e-04f, 4.56819325e-04f, 4.73660705e-04f, 4.90855383e-04f, 5.08407404e-04f, 5.26320820e-04f, 5.44599693e-04f,
+        5.63248092e-04f, 5.82270095e-04f, 6.01669785e-04f, 6.21451255e-04f, 6.41618601e-04f, 6.62175927e-04f, 6.83127343e-04f, 7.04476961e-04f,
+        7.26228902e-04f, 7.48387288e-04f, 7.70956245e-04f, 7.93939903e-04f, 8.17342394e-04f, 8.41167854e-04f, 8.65420420e-04f, 8.90104228e-04f,
+        9.15223418e-04f, 9.40782129e-04f, 9.66784500e-04f, 9.93234669e-04f, 1.02013678e-03f, 1.04749495e-03f, 1.07531334e-03f, 1.10359605e-03f,
+        1.13234724e-03f, 1.16157101e-03f, 1.19127149e-03f, 1.22145280e-03f, 1.25211904e-03f, 1.28327433e-03f, 1.31492275e-03f, 1.34706840e-03f,
+        1.37971537e-03f, 1.41286773e-03f, 1.44652955e-03f, 1.48070489e-03f, 1.51539780e-03f, 1.55061232e-03f, 1.58635248e-03f, 1.62262230e-03f,
+        1.65942578e-03f, 1.69676693e-03f, 1.73464972e-03f, 1.77307812e-03f, 1.81205609e-03f, 1.85158757e-03f, 1.89167648e-03f, 1.93232673e-03f,
+        1.97354223e-03f, 2.01532684e-03f, 2.05768443e-03f, 2.10061884e-03f, 2.14413389e-03f, 2.18823339e-03f, 2.23292113e-03f, 2.27820087e-03f,
+        2.32407636e-03f, 2.37055132e-03f, 2.41762946e-03f, 2.46531445e-03f, 2.51360995e-03f, 2.56251960e-03f, 2.61204700e-03f, 2.66219574e-03f,
+        2.71296938e-03f, 2.76437146e-03f, 2.81640547e-03f, 2.86907491e-03f, 2.92238322e-03f, 2.97633383e-03f, 3.03093013e-03f, 3.08617550e-03f,
+        3.14207326e-03f, 3.19862673e-03f, 3.25583917e-03f, 3.31371384e-03f, 3.37225394e-03f, 3.43146266e-03f, 3.49134313e-03f, 3.55189847e-03f,
+        3.61313175e-03f, 3.67504603e-03f, 3.73764429e-03f, 3.80092951e-03f, 3.86490463e-03f, 3.92957254e-03f, 3.99493609e-03f, 4.06099810e-03f,
+        4.12776136e-03f, 4.19522860e-03f, 4.26340252e-03f, 4.33228579e-03f, 4.40188101e-03f, 4.47219076e-03f, 4.54321758e-03f, 4.61496395e-03f,
+        4.68743233e-03f, 4.76062510e-03f, 4.83454464e-03f, 4.90919324e-03f, 4.98457318e-03f, 5.06068668e-03f, 5.13753590e-03f, 5.21512297e-03f,
+        5.29344998e-03f, 5.37251894e-03f, 5.45233183e-03f, 5.53289060e-03f, 5.61419711e-03f, 5.69625319e-03f, 5.77906063e-03f, 5.86262114e-03f,
+        5.94693641e-03f, 6.03200805e-03f, 6.11783763e-03f, 6.20442667e-03f, 6.29177662e-03f, 6.37988889e-03f, 6.46876484e-03f, 6.55840575e-03f,
+        6.64881286e-03f, 6.73998736e-03f, 6.83193037e-03f, 6.92464296e-03f, 7.01812613e-03f, 7.11238085e-03f, 7.20740799e-03f, 7.30320839e-03f,
+        7.39978282e-03f, 7.49713200e-03f, 7.59525658e-03f, 7.69415715e-03f, 7.79383423e-03f, 7.89428829e-03f, 7.99551974e-03f, 8.09752892e-03f,
+        8.20031611e-03f, 8.30388152e-03f, 8.40822530e-03f, 8.51334754e-03f, 8.61924826e-03f, 8.72592741e-03f, 8.83338490e-03f, 8.94162053e-03f,
+        9.05063407e-03f, 9.16042522e-03f, 9.27099359e-03f, 9.38233875e-03f, 9.49446018e-03f, 9.60735731e-03f, 9.72102950e-03f, 9.83547601e-03f,
+        9.95069608e-03f, 1.00666888e-02f, 1.01834534e-02f, 1.03009887e-02f, 1.04192938e-02f, 1.05383674e-02f, 1.06582084e-02f, 1.07788156e-02f,
+        1.09001875e-02f, 1.10223227e-02f, 1.11452198e-02f, 1.12688772e-02f, 1.13932933e-02f, 1.15184663e-02f, 1.16443945e-02f, 1.17710760e-02f,
+        1.18985090e-02f, 1.20266914e-02f, 1.21556211e-02f, 1.22852960e-02f, 1.24157138e-02f, 1.25468724e-02f, 1.26787693e-02f, 1.28114021e-02f,
+        1.29447683e-02f, 1.30788652e-02f, 1.32136903e-02f, 1.33492407e-02f, 1.34855137e-02f, 1.36225064e-02f, 1.37602158e-02f, 1.38986390e-02f,
+        1.40377726e-02f, 1.41776137e-02f, 1.43181589e-02f, 1.44594049e-02f, 1.46013483e-02f, 1.47439855e-02f, 1.48873131e-02f, 1.50313273e-02f,
+        1.51760245e-02f, 1.53214009e-02f, 1.54674526e-02f, 1.56141757e-02f, 1.57615661e-02f, 1.59096198e-02f, 1.60583326e-02f, 1.62077002e-02f,
+        1.63577184e-02f, 1.65083827e-02f, 1.66596887e-02f, 1.68116318e-02f, 1.69642075e-02f, 1.71174109e-02f, 1.72712375e-02f, 1.74256822e-02f,
+        1.75807402e-02f, 1.77364065e-02f, 1.78926761e-02f, 1.80495438e-02f, 1.82070044e-02f, 1.83650526e-02f, 1.85236830e-02f, 1.86828903e-02f,
+        1.88426688e-02f, 1.90030131e-02f, 1.91639175e-02f, 1.93253763e-02f, 1.94873836e-02f, 1.96499336e-02f, 1.98130203e-02f, 1.99766378e-02f,
+        2.01407800e-02f, 2.03054407e-02f, 2.04706137e-02f, 2.06362927e-02f, 2.08024713e-02f, 2.09691431e-02f, 2.11363016e-02f, 2.13039403e-02f,
+        2.14720524e-02f, 2.16406313e-02f, 2.18096702e-02f, 2.19791623e-02f, 2.21491006e-02f, 2.23194783e-02f, 2.24902881e-02f, 2.26615231e-02f,
+        2.28331760e-02f, 2.30052396e-02f, 2.31777066e-02f, 2.33505696e-02f, 2.35238212e-02f, 2.36974539e-02f, 2.38714602e-02f, 2.40458324e-02f,
+        2.42205628e-02f, 2.43956437e-02f, 2.45710672e-02f, 2.47468256e-02f, 2.49229109e-02f, 2.50993150e-02f, 2.52760300e-02f, 2.54530477e-02f,
+        2.56303600e-02f, 2.58079587e-02f, 2.59858355e-02f, 2.61639820e-02f, 2.63423898e-02f, 2.65210506e-02f, 2.66999558e-02f, 2.68790969e-02f,
+        2.70584652e-02f, 2.72380522e-02f, 2.74178490e-02f, 2.75978470e-02f, 2.77780372e-02f, 2.79584110e-02f, 2.81389593e-02f, 2.83196731e-02f,
+        2.85005436e-02f, 2.86815615e-02f, 2.88627179e-02f, 2.90440036e-02f, 2.92254093e-02f, 2.94069259e-02f, 2.95885440e-02f, 2.97702543e-02f,
+        2.99520475e-02f, 3.01339141e-02f, 3.03158447e-02f, 3.04978298e-02f, 3.06798599e-02f, 3.08619254e-02f, 3.10440167e-02f, 3.12261241e-02f,
+        3.14082379e-02f, 3.15903485e-02f, 3.17724461e-02f, 3.19545209e-02f, 3.21365630e-02f, 3.23185627e-02f, 3.25005100e-02f, 3.26823950e-02f,
+        3.28642078e-02f, 3.30459384e-02f, 3.32275768e-02f, 3.34091129e-02f, 3.35905367e-02f, 3.37718381e-02f, 3.39530070e-02f, 3.41340333e-02f,
+        3.43149068e-02f, 3.44956172e-02f, 3.46761546e-02f, 3.48565085e-02f, 3.50366687e-02f, 3.52166250e-02f, 3.53963672e-02f, 3.55758848e-02f,
+        3.57551677e-02f, 3.59342054e-02f, 3.61129876e-02f, 3.62915039e-02f, 3.64697440e-02f, 3.66476976e-02f, 3.68253541e-02f, 3.70027032e-02f,
+        3.71797345e-02f, 3.73564376e-02f, 3.75328020e-02f, 3.77088173e-02f, 3.78844730e-02f, 3.80597587e-02f, 3.82346640e-02f, 3.84091784e-02f,
+        3.85832914e-02f, 3.87569926e-02f, 3.89302715e-02f, 3.91031178e-02f, 3.92755208e-02f, 3.94474702e-02f, 3.96189556e-02f, 3.97899664e-02f,
+        3.99604923e-02f, 4.01305228e-02f, 4.03000475e-02f, 4.04690560e-02f, 4.06375379e-02f, 4.08054829e-02f, 4.09728804e-02f, 4.11397202e-02f,
+        4.13059919e-02f, 4.14716851e-02f, 4.16367896e-02f, 4.18012951e-02f, 4.19651911e-02f, 4.21284676e-02f, 4.22911141e-02f, 4.24531206e-02f,
+        4.26144767e-02f, 4.27751723e-02f, 4.29351973e-02f, 4.30945414e-02f, 4.32531946e-02f, 4.34111468e-02f, 4.35683879e-02f, 4.37249079e-02f,
+        4.38806967e-02f, 4.40357444e-02f, 4.41900411e-02f, 4.43435769e-02f, 4.44963418e-02f, 4.46483260e-02f, 4.47995197e-02f, 4.49499131e-02f,
+        4.50994965e-02f, 4.52482602e-02f, 4.53961946e-02f, 4.55432899e-02f, 4.56895366e-02f, 4.58349251e-02f, 4.59794461e-02f, 4.61230899e-02f,
+        4.62658472e-02f, 4.64077087e-02f, 4.65486649e-02f, 4.66887067e-02f, 4.68278247e-02f, 4.69660098e-02f, 4.71032530e-02f, 4.72395450e-02f,
+        4.73748768e-02f, 4.75092396e-02f, 4.76426243e-02f, 4.77750221e-02f, 4.79064242e-02f, 4.80368218e-02f, 4.81662062e-02f, 4.82945688e-02f,
+        4.84219009e-02f, 4.85481940e-02f, 4.86734398e-02f, 4.87976297e-02f, 4.89207554e-02f, 4.90428086e-02f, 4.91637812e-02f, 4.92836648e-02f,
+        4.94024516e-02f, 4.95201333e-02f, 4.96367022e-02f, 4.97521501e-02f, 4.98664695e-02f, 4.99796524e-02f, 5.00916912e-02f, 5.02025783e-02f,
+        5.03123061e-02f, 5.04208672e-02f, 5.05282542e-02f, 5.06344596e-02f, 5.07394764e-02f, 5.08432972e-02f, 5.09459151e-02f, 5.10473228e-02f,
+        5.11475136e-02f, 5.12464806e-02f, 5.13442169e-02f, 5.14407158e-02f, 5.15359707e-02f, 5.16299750e-02f, 5.17227223e-02f, 5.18142062e-02f,
+        5.19044203e-02f, 5.19933584e-02f, 5.20810145e-02f, 5.21673823e-02f, 5.22524561e-02f, 5.23362297e-02f, 5.24186976e-02f, 5.24998539e-02f,
+        5.25796930e-02f, 5.26582093e-02f, 5.27353975e-02f, 5.28112522e-02f, 5.28857680e-02f, 5.29589398e-02f, 5.30307626e-02f, 5.31012312e-02f,
+        5.31703408e-02f, 5.32380866e-02f, 5.33044639e-02f, 5.33694679e-02f, 5.34330943e-02f, 5.34953384e-02f, 5.35561961e-02f, 5.36156629e-02f,
+        5.36737348e-02f, 5.37304077e-02f, 5.37856777e-02f, 5.38395407e-02f, 5.38919932e-02f, 5.39430313e-02f, 5.39926516e-02f, 5.40408505e-02f,
+        5.40876247e-02f, 5.41329708e-02f, 5.41768857e-02f, 5.42193663e-02f, 5.42604096e-02f, 5.43000128e-02f, 5.43381730e-02f, 5.43748875e-02f,
+        5.44101538e-02f, 5.44439694e-02f, 5.44763319e-02f, 5.45072390e-02f, 5.45366886e-02f, 5.45646785e-02f, 5.45912068e-02f, 5.46162717e-02f,
+        5.46398714e-02f, 5.46620041e-02f, 5.46826684e-02f, 5.47018627e-02f, 5.47195858e-02f, 5.47358364e-02f, 5.47506133e-02f, 5.47639154e-02f,
+        5.47757420e-02f, 5.47860920e-02f, 5.47949648e-02f, 5.48023598e-02f, 5.48082764e-02f, 5.48127142e-02f, 5.48156729e-02f, 5.48171523e-02f,
+    },
+    {
+        1.49104398e-03f, 1.54924697e-03f, 1.60846146e-03f, 1.66869356e-03f, 1.72994931e-03f, 1.79223464e-03f, 1.85555542e-03f, 1.91991744e-03f,
+        1.98532638e-03f, 2.05178784e-03f, 2.11930734e-03f, 2.18789029e-03f, 2.25754203e-03f, 2.32826777e-03f, 2.40007266e-03f, 2.47296173e-03f,
+        2.54693992e-03f, 2.62201206e-03f, 2.69818290e-03f, 2.77545705e-03f, 2.85383905e-03f, 2.93333331e-03f, 3.01394415e-03f, 3.09567575e-03f,
+        3.17853223e-03f, 3.26251754e-03f, 3.34763555e-03f, 3.43389002e-03f, 3.52128458e-03f, 3.60982273e-03f, 3.69950787e-03f, 3.79034329e-03f,
+        3.88233212e-03f, 3.97547740e-03f, 4.06978204e-03f, 4.16524881e-03f, 4.26188036e-03f, 4.35967921e-03f, 4.45864777e-03f, 4.55878828e-03f,
+        4.66010289e-03f, 4.76259358e-03f, 4.86626222e-03f, 4.97111053e-03f, 5.07714010e-03f, 5.18435238e-03f, 5.29274868e-03f, 5.40233017e-03f,
+        5.51309788e-03f, 5.62505270e-03f, 5.73819535e-03f, 5.85252645e-03f, 5.96804643e-03f, 6.08475561e-03f, 6.20265413e-03f, 6.32174200e-03f,
+        6.44201907e-03f, 6.56348505e-03f, 6.68613948e-03f, 6.80998177e-03f, 6.93501115e-03f, 7.06122671e-03f, 7.18862739e-03f, 7.31721195e-03f,
+        7.44697902e-03f, 7.57792704e-03f, 7.71005433e-03f, 7.84335901e-03f, 7.97783906e-03f, 8.11349229e-03f, 8.25031637e-03f, 8.38830876e-03f,
+        8.52746681e-03f, 8.66778766e-03f, 8.80926830e-03f, 8.95190558e-03f, 9.09569613e-03f, 9.24063646e-03f, 9.38672289e-03f, 9.53395158e-03f,
+        9.68231850e-03f, 9.83181948e-03f, 9.98245016e-03f, 1.01342060e-02f, 1.02870823e-02f, 1.04410743e-02f, 1.05961768e-02f, 1.07523846e-02f,
+        1.09096925e-02f, 1.10680947e-02f, 1.12275856e-02f, 1.13881593e-02f, 1.15498096e-02f, 1.17125304e-02f, 1.18763151e-02f, 1.20411573e-02f,
+        1.22070500e-02f, 1.23739864e-02f, 1.25419594e-02f, 1.27109615e-02f, 1.28809853e-02f, 1.30520232e-02f, 1.32240674e-02f, 1.33971097e-02f,
+        1.35711420e-02f, 1.37461561e-02f, 1.39221432e-02f, 1.40990948e-02f, 1.42770018e-02f, 1.44558553e-02f, 1.46356460e-02f, 1.48163645e-02f,
+        1.49980012e-02f, 1.51805463e-02f, 1.53639899e-02f, 1.55483219e-02f, 1.57335320e-02f, 1.59196096e-02f, 1.61065443e-02f, 1.62943251e-02f,
+        1.64829411e-02f, 1.66723811e-02f, 1.68626338e-02f, 1.70536878e-02f, 1.72455313e-02f, 1.74381525e-02f, 1.76315394e-02f, 1.78256798e-02f,
+        1.80205614e-02f, 1.82161716e-02f, 1.84124979e-02f, 1.86095273e-02f, 1.88072468e-02f, 1.90056433e-02f, 1.92047034e-02f, 1.94044136e-02f,
+        1.96047603e-02f, 1.98057296e-02f, 2.00073075e-02f, 2.02094800e-02f, 2.04122326e-02f, 2.06155509e-02f, 2.08194204e-02f, 2.10238262e-02f,
+        2.12287533e-02f, 2.14341868e-02f, 2.16401114e-02f, 2.18465117e-02f, 2.20533721e-02f, 2.22606770e-02f, 2.24684105e-02f, 2.26765567e-02f,
+        2.28850994e-02f, 2.30940223e-02f, 2.33033091e-02f, 2.35129431e-02f, 2.37229077e-02f, 2.39331861e-02f, 2.41437612e-02f, 2.43546160e-02f,
+        2.45657332e-02f, 2.47770954e-02f, 2.49886852e-02f, 2.52004848e-02f, 2.54124766e-02f, 2.56246426e-02f, 2.58369647e-02f, 2.60494250e-02f,
+        2.62620050e-02f, 2.64746864e-02f, 2.66874507e-02f, 2.69002793e-02f, 2.71131534e-02f, 2.73260542e-02f, 2.75389627e-02f, 2.77518599e-02f,
+        2.79647264e-02f, 2.81775432e-02f, 2.83902907e-02f, 2.86029494e-02f, 2.88154999e-02f, 2.90279223e-02f, 2.92401968e-02f, 2.94523037e-02f,
+        2.96642228e-02f, 2.98759342e-02f, 3.00874176e-02f, 3.02986528e-02f, 3.05096195e-02f, 3.07202972e-02f, 3.09306655e-02f, 3.11407038e-02f,
+        3.13503914e-02f, 3.15597075e-02f, 3.17686315e-02f, 3.19771423e-02f, 3.21852192e-02f, 3.23928410e-02f, 3.25999867e-02f, 3.28066351e-02f,
+        3.30127652e-02f, 3.32183556e-02f, 3.34233850e-02f, 3.36278321e-02f, 3.38316755e-02f, 3.40348938e-02f, 3.42374653e-02f, 3.44393687e-02f,
+        3.46405823e-02f, 3.48410846e-02f, 3.50408538e-02f, 3.52398683e-02f, 3.54381064e-02f, 3.56355463e-02f, 3.58321663e-02f, 3.60279446e-02f,
+        3.62228593e-02f, 3.64168888e-02f, 3.66100110e-02f, 3.68022042e-02f, 3.69934465e-02f, 3.71837160e-02f, 3.73729909e-02f, 3.75612492e-02f,
+        3.77484691e-02f, 3.79346288e-02f, 3.81197063e-02f, 3.83036797e-02f, 3.84865273e-02f, 3.86682272e-02f, 3.88487575e-02f, 3.90280965e-02f,
+        3.92062223e-02f, 3.93831133e-02f, 3.95587476e-02f, 3.97331036e-02f, 3.99061595e-02f, 4.00778939e-02f, 4.02482850e-02f, 4.04173112e-02f,
+        4.05849511e-02f, 4.07511832e-02f, 4.09159861e-02f, 4.10793383e-02f, 4.12412186e-02f, 4.14016057e-02f, 4.15604783e-02f, 4.17178154e-02f,
+        4.18735957e-02f, 4.20277984e-02f, 4.21804025e-02f, 4.23313871e-02f, 4.24807313e-02f, 4.26284145e-02f, 4.27744160e-02f, 4.29187152e-02f,
+        4.30612917e-02f, 4.32021251e-02f, 4.33411951e-02f, 4.34784814e-02f, 4.36139640e-02f, 4.37476229e-02f, 4.38794381e-02f, 4.40093898e-02f,
+        4.41374583e-02f, 4.42636241e-02f, 4.43878677e-02f, 4.45101696e-02f, 4.46305108e-02f, 4.47488719e-02f, 4.48652341e-02f, 4.49795785e-02f,
+        4.50918862e-02f, 4.52021387e-02f, 4.53103175e-02f, 4.54164043e-02f, 4.55203808e-02f, 4.56222289e-02f, 4.57219308e-02f, 4.58194686e-02f,
+        4.59148247e-02f, 4.60079817e-02f, 4.60989221e-02f, 4.61876288e-02f, 4.62740848e-02f, 4.63582732e-02f, 4.64401774e-02f, 4.65197808e-02f,
+        4.65970670e-02f, 4.66720199e-02f, 4.67446233e-02f, 4.68148616e-02f, 4.68827190e-02f, 4.69481800e-02f, 4.70112293e-02f, 4.70718518e-02f,
+        4.71300326e-02f, 4.71857568e-02f, 4.72390100e-02f, 4.72897778e-02f, 4.73380461e-02f, 4.73838007e-02f, 4.74270281e-02f, 4.74677145e-02f,
+        4.75058467e-02f, 4.75414114e-02f, 4.75743958e-02f, 4.76047870e-02f, 4.76325726e-02f, 4.76577403e-02f, 4.76802778e-02f, 4.77001734e-02f,
+        4.77174154e-02f, 4.77319924e-02f, 4.77438931e-02f, 4.77531065e-02f, 4.77596219e-02f, 4.77634288e-02f, 4.77645168e-02f, 4.77628758e-02f,
+        4.77584961e-02f, 4.77513681e-02f, 4.77414823e-02f, 4.77288297e-02f, 4.77134014e-02f, 4.76951887e-02f, 4.76741832e-02f, 4.76503769e-02f,
+        4.76237618e-02f, 4.75943302e-02f, 4.75620749e-02f, 4.75269885e-02f, 4.74890643e-02f, 4.74482955e-02f, 4.74046759e-02f, 4.73581993e-02f,
+        4.73088598e-02f, 4.72566518e-02f, 4.72015700e-02f, 4.71436093e-02f, 4.70827649e-02f, 4.70190323e-02f, 4.69524071e-02f, 4.68828853e-02f,
+        4.68104633e-02f, 4.67351374e-02f, 4.66569046e-02f, 4.65757619e-02f, 4.64917065e-02f, 4.64047362e-02f, 4.63148488e-02f, 4.62220424e-02f,
+        4.61263156e-02f, 4.60276669e-02f, 4.59260955e-02f, 4.58216005e-02f, 4.57141815e-02f, 4.56038383e-02f, 4.54905711e-02f, 4.53743802e-02f,
+        4.52552663e-02f, 4.51332303e-02f, 4.50082735e-02f, 4.48803973e-02f, 4.47496036e-02f, 4.46158945e-02f, 4.44792723e-02f, 4.43397396e-02f,
+        4.41972994e-02f, 4.40519548e-02f, 4.39037095e-02f, 4.37525671e-02f, 4.35985318e-02f, 4.34416079e-02f, 4.32818000e-02f, 4.31191130e-02f,
+        4.29535522e-02f, 4.27851231e-02f, 4.26138313e-02f, 4.24396831e-02f, 4.22626847e-02f, 4.20828427e-02f, 4.19001642e-02f, 4.17146562e-02f,
+        4.15263263e-02f, 4.13351821e-02f, 4.11412319e-02f, 4.09444839e-02f, 4.07449466e-02f, 4.05426291e-02f, 4.03375405e-02f, 4.01296902e-02f,
+        3.99190879e-02f, 3.97057438e-02f, 3.94896680e-02f, 3.92708712e-02f, 3.90493641e-02f, 3.88251580e-02f, 3.85982642e-02f, 3.83686944e-02f,
+        3.81364606e-02f, 3.79015749e-02f, 3.76640499e-02f, 3.74238983e-02f, 3.71811331e-02f, 3.69357677e-02f, 3.66878157e-02f, 3.64372908e-02f,
+        3.61842072e-02f, 3.59285793e-02f, 3.56704216e-02f, 3.54097491e-02f, 3.51465769e-02f, 3.48809205e-02f, 3.46127955e-02f, 3.43422178e-02f,
+        3.40692037e-02f, 3.37937696e-02f, 3.35159321e-02f, 3.32357082e-02f, 3.29531151e-02f, 3.26681703e-02f, 3.23808914e-02f, 3.20912963e-02f,
+        3.17994033e-02f, 3.15052307e-02f, 3.12087972e-02f, 3.09101217e-02f, 3.06092234e-02f, 3.03061215e-02f, 3.00008357e-02f, 2.96933857e-02f,
+        2.93837918e-02f, 2.90720741e-02f, 2.87582531e-02f, 2.84423496e-02f, 2.81243845e-02f, 2.78043789e-02f, 2.74823544e-02f, 2.71583324e-02f,
+        2.68323347e-02f, 2.65043835e-02f, 2.61745008e-02f, 2.58427092e-02f, 2.55090313e-02f, 2.51734899e-02f, 2.48361080e-02f, 2.44969089e-02f,
+        2.41559160e-02f, 2.38131529e-02f, 2.34686434e-02f, 2.31224116e-02f, 2.27744815e-02f, 2.24248776e-02f, 2.20736244e-02f, 2.17207465e-02f,
+        2.13662689e-02f, 2.10102167e-02f, 2.06526151e-02f, 2.02934894e-02f, 1.99328652e-02f, 1.95707682e-02f, 1.92072244e-02f, 1.88422597e-02f,
+        1.84759004e-02f, 1.81081727e-02f, 1.77391032e-02f, 1.73687184e-02f, 1.69970452e-02f, 1.66241105e-02f, 1.62499412e-02f, 1.58745646e-02f,
+        1.54980080e-02f, 1.51202989e-02f, 1.47414647e-02f, 1.43615331e-02f, 1.39805320e-02f, 1.35984893e-02f, 1.32154330e-02f, 1.28313912e-02f,
+        1.24463922e-02f, 1.20604643e-02f, 1.16736360e-02f, 1.12859358e-02f, 1.08973924e-02f, 1.05080344e-02f, 1.01178908e-02f, 9.72699034e-03f,
+        9.33536212e-03f, 8.94303515e-03f, 8.55003859e-03f, 8.15640165e-03f, 7.76215361e-03f, 7.36732383e-03f, 6.97194171e-03f, 6.57603672e-03f,
+        6.17963840e-03f, 5.78277633e-03f, 5.38548015e-03f, 4.98777953e-03f, 4.58970419e-03f, 4.19128391e-03f, 3.79254849e-03f, 3.39352776e-03f,
+        2.99425159e-03f, 2.59474987e-03f, 2.19505254e-03f, 1.79518952e-03f, 1.39519078e-03f, 9.95086289e-04f, 5.94906040e-04f, 1.94680023e-04f,
+    },
+    {
+        6.90848866e-03f, 7.08815910e-03f, 7.26951005e-03f, 7.45253204e-03f, 7.63721528e-03f, 7.82354966e-03f, 8.01152473e-03f, 8.20112975e-03f,
+        8.39235362e-03f, 8.58518495e-03f, 8.77961201e-03f, 8.97562275e-03f, 9.17320481e-03f, 9.37234550e-03f, 9.57303181e-03f, 9.77525040e-03f,
+        9.97898762e-03f, 1.01842295e-02f, 1.03909618e-02f, 1.05991698e-02f, 1.08088387e-02f, 1.10199531e-02f, 1.12324976e-02f, 1.14464562e-02f,
+        1.16618128e-02f, 1.18785509e-02f, 1.20966536e-02f, 1.23161038e-02f, 1.25368841e-02f, 1.27589767e-02f, 1.29823636e-02f, 1.32070264e-02f,
+        1.34329464e-02f, 1.36601046e-02f, 1.38884818e-02f, 1.41180585e-02f, 1.43488146e-02f, 1.45807301e-02f, 1.48137844e-02f, 1.50479569e-02f,
+        1.52832263e-02f, 1.55195715e-02f, 1.57569707e-02f, 1.59954020e-02f, 1.62348432e-02f, 1.64752719e-02f, 1.67166651e-02f, 1.69589999e-02f,
+        1.72022529e-02f, 1.74464006e-02f, 1.76914190e-02f, 1.79372840e-02f, 1.81839712e-02f, 1.84314559e-02f, 1.86797131e-02f, 1.89287177e-02f,
+        1.91784441e-02f, 1.94288667e-02f, 1.96799596e-02f, 1.99316964e-02f, 2.01840508e-02f, 2.04369960e-02f, 2.06905050e-02f, 2.09445508e-02f,
+        2.11991059e-02f, 2.14541427e-02f, 2.17096332e-02f, 2.19655494e-02f, 2.22218630e-02f, 2.24785454e-02f, 2.27355679e-02f, 2.29929016e-02f,
+        2.32505172e-02f, 2.35083854e-02f, 2.37664767e-02f, 2.40247612e-02f, 2.42832090e-02f, 2.45417900e-02f, 2.48004739e-02f, 2.50592300e-02f,
+        2.53180278e-02f, 2.55768364e-02f, 2.58356246e-02f, 2.60943614e-02f, 2.63530154e-02f, 2.66115550e-02f, 2.68699486e-02f, 2.71281643e-02f,
+        2.73861702e-02f, 2.76439341e-02f, 2.79014239e-02f, 2.81586071e-02f, 2.84154512e-02f, 2.86719236e-02f, 2.89279915e-02f, 2.91836221e-02f,
+        2.94387824e-02f, 2.96934393e-02f, 2.99475597e-02f, 3.02011101e-02f, 3.04540573e-02f, 3.07063679e-02f, 3.09580081e-02f, 3.12089445e-02f,
+        3.14591433e-02f, 3.17085708e-02f, 3.19571931e-02f, 3.22049763e-02f, 3.24518865e-02f, 3.26978896e-02f, 3.29429518e-02f, 3.31870387e-02f,
+        3.34301165e-02f, 3.36721508e-02f, 3.39131076e-02f, 3.41529526e-02f, 3.43916516e-02f, 3.46291705e-02f, 3.48654749e-02f, 3.51005307e-02f,
+        3.53343037e-02f, 3.55667597e-02f, 3.57978644e-02f, 3.60275837e-02f, 3.62558834e-02f, 3.64827295e-02f, 3.67080879e-02f, 3.69319245e-02f,
+        3.71542054e-02f, 3.73748965e-02f, 3.75939641e-02f, 3.78113743e-02f, 3.80270934e-02f, 3.82410877e-02f, 3.84533236e-02f, 3.86637675e-02f,
+        3.88723862e-02f, 3.90791461e-02f, 3.92840142e-02f, 3.94869572e-02f, 3.96879422e-02f, 3.98869362e-02f, 4.00839065e-02f, 4.02788204e-02f,
+        4.04716454e-02f, 4.06623491e-02f, 4.08508993e-02f, 4.10372638e-02f, 4.12214107e-02f, 4.14033082e-02f, 4.15829247e-02f, 4.17602288e-02f,
+        4.19351891e-02f, 4.21077745e-02f, 4.22779542e-02f, 4.24456973e-02f, 4.26109733e-02f, 4.27737519e-02f, 4.29340030e-02f, 4.30916966e-02f,
+        4.32468030e-02f, 4.33992926e-02f, 4.35491364e-02f, 4.36963051e-02f, 4.38407700e-02f, 4.39825025e-02f, 4.41214743e-02f, 4.42576573e-02f,
+        4.43910238e-02f, 4.45215461e-02f, 4.46491969e-02f, 4.47739493e-02f, 4.48957765e-02f, 4.50146520e-02f, 4.51305496e-02f, 4.52434434e-02f,
+        4.53533079e-02f, 4.54601177e-02f, 4.55638478e-02f, 4.56644736e-02f, 4.57619706e-02f, 4.58563147e-02f, 4.59474824e-02f, 4.60354500e-02f,
+        4.61201946e-02f, 4.62016933e-02f, 4.62799238e-02f, 4.63548640e-02f, 4.64264922e-02f, 4.64947869e-02f, 4.65597273e-02f, 4.66212926e-02f,
+        4.66794625e-02f, 4.67342172e-02f, 4.67855370e-02f, 4.68334029e-02f, 4.68777959e-02f, 4.69186978e-02f, 4.69560905e-02f, 4.69899563e-02f,
+        4.70202781e-02f, 4.70470390e-02f, 4.70702226e-02f, 4.70898129e-02f, 4.71057943e-02f, 4.71181515e-02f, 4.71268699e-02f, 4.71319350e-02f,
+        4.71333330e-02f, 4.71310503e-02f, 4.71250738e-02f, 4.71153910e-02f, 4.71019896e-02f, 4.70848579e-02f, 4.70639845e-02f, 4.70393586e-02f,
+        4.70109699e-02f, 4.69788082e-02f, 4.69428641e-02f, 4.69031286e-02f, 4.68595931e-02f, 4.68122494e-02f, 4.67610898e-02f, 4.67061073e-02f,
+        4.66472950e-02f, 4.65846467e-02f, 4.65181566e-02f, 4.64478194e-02f, 4.63736303e-02f, 4.62955850e-02f, 4.62136796e-02f, 4.61279107e-02f,
+        4.60382755e-02f, 4.59447715e-02f, 4.58473969e-02f, 4.57461502e-02f, 4.56410306e-02f, 4.55320375e-02f, 4.54191711e-02f, 4.53024319e-02f,
+        4.51818210e-02f, 4.50573400e-02f, 4.49289910e-02f, 4.47967765e-02f, 4.46606996e-02f, 4.45207639e-02f, 4.43769735e-02f, 4.42293329e-02f,
+        4.40778474e-02f, 4.39225224e-02f, 4.37633642e-02f, 4.36003793e-02f, 4.34335749e-02f, 4.32629586e-02f, 4.30885387e-02f, 4.29103237e-02f,
+        4.27283228e-02f, 4.25425457e-02f, 4.23530027e-02f, 4.21597044e-02f, 4.19626620e-02f, 4.17618874e-02f, 4.15573926e-02f, 4.13491905e-02f,
+        4.11372944e-02f, 4.09217179e-02f, 4.07024754e-02f, 4.04795815e-02f, 4.02530517e-02f, 4.00229017e-02f, 3.97891478e-02f, 3.95518067e-02f,
+        3.93108958e-02f, 3.90664329e-02f, 3.88184362e-02f, 3.85669245e-02f, 3.83119172e-02f, 3.80534340e-02f, 3.77914952e-02f, 3.75261215e-02f,
+        3.72573343e-02f, 3.69851552e-02f, 3.67096065e-02f, 3.64307108e-02f, 3.61484915e-02f, 3.58629721e-02f, 3.55741769e-02f, 3.52821304e-02f,
+        3.49868578e-02f, 3.46883846e-02f, 3.43867369e-02f, 3.40819412e-02f, 3.37740244e-02f, 3.34630140e-02f, 3.31489379e-02f, 3.28318244e-02f,
+        3.25117023e-02f, 3.21886008e-02f, 3.18625497e-02f, 3.15335791e-02f, 3.12017196e-02f, 3.08670021e-02f, 3.05294580e-02f, 3.01891194e-02f,
+        2.98460185e-02f, 2.95001879e-02f, 2.91516608e-02f, 2.88004709e-02f, 2.84466519e-02f, 2.80902384e-02f, 2.77312650e-02f, 2.73697670e-02f,
+        2.70057800e-02f, 2.66393398e-02f, 2.62704828e-02f, 2.58992459e-02f, 2.55256659e-02f, 2.51497806e-02f, 2.47716276e-02f, 2.43912453e-02f,
+        2.40086722e-02f, 2.36239472e-02f, 2.32371096e-02f, 2.28481991e-02f, 2.24572556e-02f, 2.20643195e-02f, 2.16694313e-02f, 2.12726321e-02f,
+        2.08739632e-02f, 2.04734662e-02f, 2.00711829e-02f, 1.96671557e-02f, 1.92614270e-02f, 1.88540397e-02f, 1.84450369e-02f, 1.80344620e-02f,
+        1.76223587e-02f, 1.72087709e-02f, 1.67937429e-02f, 1.63773193e-02f, 1.59595446e-02f, 1.55404640e-02f, 1.51201226e-02f, 1.46985660e-02f,
+        1.42758400e-02f, 1.38519903e-02f, 1.34270633e-02f, 1.30011054e-02f, 1.25741631e-02f, 1.21462832e-02f, 1.17175128e-02f, 1.12878990e-02f,
+        1.08574893e-02f, 1.04263313e-02f, 9.99447262e-03f, 9.56196125e-03f, 9.12884525e-03f, 8.69517287e-03f, 8.26099247e-03f, 7.82635261e-03f,
+        7.39130193e-03f, 6.95588923e-03f, 6.52016344e-03f, 6.08417358e-03f, 5.64796881e-03f, 5.21159838e-03f, 4.77511164e-03f, 4.33855803e-03f,
+        3.90198707e-03f, 3.46544837e-03f, 3.02899160e-03f, 2.59266652e-03f, 2.15652290e-03f, 1.72061062e-03f, 1.28497955e-03f, 8.49679638e-04f,
+        4.14760846e-04f, -1.97268377e-05f, -4.53733405e-04f, -8.87208837e-04f, -1.32010311e-03f, -1.75236621e-03f, -2.18394811e-03f, -2.61479883e-03f,
+        -3.04486840e-03f, -3.47410686e-03f, -3.90246432e-03f, -4.32989090e-03f, -4.75633681e-03f, -5.18175227e-03f, -5.60608760e-03f, -6.02929317e-03f,
+        -6.45131944e-03f, -6.87211696e-03f, -7.29163634e-03f, -7.70982831e-03f, -8.12664372e-03f, -8.54203350e-03f, -8.95594870e-03f, -9.36834053e-03f,
+        -9.77916029e-03f, -1.01883594e-02f, -1.05958896e-02f, -1.10017025e-02f, -1.14057500e-02f, -1.18079843e-02f, -1.22083575e-02f, -1.26068222e-02f,
+        -1.30033309e-02f, -1.33978363e-02f, -1.37902916e-02f, -1.41806499e-02f, -1.45688647e-02f, -1.49548895e-02f, -1.53386782e-02f, -1.57201850e-02f,
+        -1.60993641e-02f, -1.64761700e-02f, -1.68505578e-02f, -1.72224823e-02f, -1.75918989e-02f, -1.79587633e-02f, -1.83230313e-02f, -1.86846591e-02f,
+        -1.90436031e-02f, -1.93998200e-02f, -1.97532670e-02f, -2.01039014e-02f, -2.04516807e-02f, -2.07965630e-02f, -2.11385067e-02f, -2.14774702e-02f,
+        -2.18134126e-02f, -2.21462932e-02f, -2.24760717e-02f, -2.28027079e-02f, -2.31261624e-02f, -2.34463958e-02f, -2.37633692e-02f, -2.40770441e-02f,
+        -2.43873823e-02f, -2.46943461e-02f, -2.49978981e-02f, -2.52980013e-02f, -2.55946191e-02f, -2.58877154e-02f, -2.61772544e-02f, -2.64632008e-02f,
+        -2.67455196e-02f, -2.70241764e-02f, -2.72991371e-02f, -2.75703680e-02f, -2.78378360e-02f, -2.81015084e-02f, -2.83613528e-02f, -2.86173375e-02f,
+        -2.88694310e-02f, -2.91176025e-02f, -2.93618214e-02f, -2.96020580e-02f, -2.98382826e-02f, -3.00704663e-02f, -3.02985805e-02f, -3.05225972e-02f,
+        -3.07424889e-02f, -3.09582286e-02f, -3.11697896e-02f, -3.13771461e-02f, -3.15802724e-02f, -3.17791435e-02f, -3.19737350e-02f, -3.21640229e-02f,
+        -3.23499837e-02f, -3.25315945e-02f, -3.27088329e-02f, -3.28816772e-02f, -3.30501058e-02f, -3.32140982e-02f, -3.33736339e-02f, -3.35286934e-02f,
+        -3.36792575e-02f, -3.38253075e-02f, -3.39668255e-02f, -3.41037940e-02f, -3.42361960e-02f, -3.43640152e-02f, -3.44872357e-02f, -3.46058424e-02f,
+        -3.47198206e-02f, -3.48291561e-02f, -3.49338354e-02f, -3.50338457e-02f, -3.51291745e-02f, -3.52198100e-02f, -3.53057409e-02f, -3.53869568e-02f,
+        -3.54634474e-02f, -3.55352034e-02f, -3.56022159e-02f, -3.56644764e-02f, -3.57219775e-02f, -3.57747118e-02f, -3.58226729e-02f, -3.58658549e-02f,
+        -3.59042523e-02f, -3.59378605e-02f, -3.59666753e-02f, -3.59906930e-02f, -3.60099108e-02f, -3.60243262e-02f, -3.60339375e-02f, -3.60387434e-02f,
+    },
+    {
+        2.25394489e-02f, 2.28681634e-02f, 2.31969026e-02f, 2.35256184e-02f, 2.38542627e-02f, 2.41827873e-02f, 2.45111435e-02f, 2.48392827e-02f,
+        2.51671562e-02f, 2.54947147e-02f, 2.58219093e-02f, 2.61486906e-02f, 2.64750092e-02f, 2.68008155e-02f, 2.71260598e-02f, 2.74506924e-02f,
+        2.77746634e-02f, 2.80979227e-02f, 2.84204203e-02f, 2.87421061e-02f, 2.90629298e-02f, 2.93828412e-02f, 2.97017899e-02f, 3.00197255e-02f,
+        3.03365977e-02f, 3.06523560e-02f, 3.09669499e-02f, 3.12803291e-02f, 3.15924430e-02f, 3.19032411e-02f, 3.22126731e-02f, 3.25206885e-02f,
+        3.28272370e-02f, 3.31322682e-02f, 3.34357318e-02f, 3.37375777e-02f, 3.40377556e-02f, 3.43362155e-02f, 3.46329074e-02f, 3.49277814e-02f,
+        3.52207878e-02f, 3.55118767e-02f, 3.58009988e-02f, 3.60881046e-02f, 3.63731448e-02f, 3.66560703e-02f, 3.69368321e-02f, 3.72153814e-02f,
+        3.74916695e-02f, 3.77656481e-02f, 3.80372689e-02f, 3.83064838e-02f, 3.85732449e-02f, 3.88375048e-02f, 3.90992159e-02f, 3.93583312e-02f,
+        3.96148037e-02f, 3.98685867e-02f, 4.01196339e-02f, 4.03678992e-02f, 4.06133367e-02f, 4.08559008e-02f, 4.10955464e-02f, 4.13322285e-02f,
+        4.15659023e-02f, 4.17965237e-02f, 4.20240487e-02f, 4.22484336e-02f, 4.24696351e-02f, 4.26876103e-02f, 4.29023167e-02f, 4.31137120e-02f,
+        4.33217544e-02f, 4.35264025e-02f, 4.37276154e-02f, 4.39253522e-02f, 4.41195730e-02f, 4.43102378e-02f, 4.44973073e-02f, 4.46807427e-02f,
+        4.48605053e-02f, 4.50365573e-02f, 4.52088610e-02f, 4.53773794e-02f, 4.55420759e-02f, 4.57029142e-02f, 4.58598589e-02f, 4.60128747e-02f,
+        4.61619269e-02f, 4.63069815e-02f, 4.64480049e-02f, 4.65849640e-02f, 4.67178261e-02f, 4.68465594e-02f, 4.69711324e-02f, 4.70915141e-02f,
+        4.72076742e-02f, 4.73195829e-02f, 4.74272110e-02f, 4.75305300e-02f, 4.76295116e-02f, 4.77241286e-02f, 4.78143540e-02f, 4.79001616e-02f,
+        4.79815258e-02f, 4.80584215e-02f, 4.81308243e-02f, 4.81987106e-02f, 4.82620571e-02f, 4.83208413e-02f, 4.83750413e-02f, 4.84246361e-02f,
+        4.84696050e-02f, 4.85099281e-02f, 4.85455863e-02f, 4.85765609e-02f, 4.86028340e-02f, 4.86243885e-02f, 4.86412079e-02f, 4.86532762e-02f,
+        4.86605784e-02f, 4.86631001e-02f, 4.86608274e-02f, 4.86537473e-02f, 4.86418475e-02f, 4.86251164e-02f, 4.86035430e-02f, 4.85771173e-02f,
+        4.85458296e-02f, 4.85096713e-02f, 4.84686343e-02f, 4.84227115e-02f, 4.83718961e-02f, 4.83161825e-02f, 4.82555656e-02f, 4.81900410e-02f,
+        4.81196051e-02f, 4.80442551e-02f, 4.79639890e-02f, 4.78788054e-02f, 4.77887038e-02f, 4.76936842e-02f, 4.75937477e-02f, 4.74888959e-02f,
+        4.73791314e-02f, 4.72644572e-02f, 4.71448774e-02f, 4.70203968e-02f, 4.68910207e-02f, 4.67567556e-02f, 4.66176085e-02f, 4.64735870e-02f,
+        4.63246999e-02f, 4.61709565e-02f, 4.60123668e-02f, 4.58489417e-02f, 4.56806929e-02f, 4.55076327e-02f, 4.53297744e-02f, 4.51471319e-02f,
+        4.49597198e-02f, 4.47675537e-02f, 4.45706498e-02f, 4.43690250e-02f, 4.41626971e-02f, 4.39516847e-02f, 4.37360069e-02f, 4.35156839e-02f,
+        4.32907363e-02f, 4.30611858e-02f, 4.28270546e-02f, 4.25883657e-02f, 4.23451430e-02f, 4.20974109e-02f, 4.18451947e-02f, 4.15885204e-02f,
+        4.13274148e-02f, 4.10619052e-02f, 4.07920200e-02f, 4.05177881e-02f, 4.02392390e-02f, 3.99564032e-02f, 3.96693117e-02f, 3.93779964e-02f,
+        3.90824897e-02f, 3.87828250e-02f, 3.84790359e-02f, 3.81711573e-02f, 3.78592244e-02f, 3.75432731e-02f, 3.72233402e-02f, 3.68994629e-02f,
+        3.65716794e-02f, 3.62400283e-02f, 3.59045489e-02f, 3.55652813e-02f, 3.52222661e-02f, 3.48755447e-02f, 3.45251589e-02f, 3.41711514e-02f,
+        3.38135654e-02f, 3.34524447e-02f, 3.30878338e-02f, 3.27197778e-02f, 3.23483223e-02f, 3.19735135e-02f, 3.15953985e-02f, 3.12140245e-02f,
+        3.08294397e-02f, 3.04416926e-02f, 3.00508325e-02f, 2.96569089e-02f, 2.92599723e-02f, 2.88600734e-02f, 2.84572635e-02f, 2.80515946e-02f,
+        2.76431191e-02f, 2.72318899e-02f, 2.68179603e-02f, 2.64013843e-02f, 2.59822164e-02f, 2.55605114e-02f, 2.51363247e-02f, 2.47097120e-02f,
+        2.42807297e-02f, 2.38494346e-02f, 2.34158837e-02f, 2.29801347e-02f, 2.25422456e-02f, 2.21022749e-02f, 2.16602813e-02f, 2.12163241e-02f,
+        2.07704630e-02f, 2.03227580e-02f, 1.98732693e-02f, 1.94220578e-02f, 1.89691844e-02f, 1.85147107e-02f, 1.80586983e-02f, 1.76012094e-02f,
+        1.71423063e-02f, 1.66820516e-02f, 1.62205084e-02f, 1.57577398e-02f, 1.52938095e-02f, 1.48287812e-02f, 1.43627189e-02f, 1.38956869e-02f,
+        1.34277497e-02f, 1.29589721e-02f, 1.24894189e-02f, 1.20191554e-02f, 1.15482468e-02f, 1.10767586e-02f, 1.06047565e-02f, 1.01323065e-02f,
+        9.65947434e-03f, 9.18632629e-03f, 8.71292856e-03f, 8.23934751e-03f, 7.76564962e-03f, 7.29190146e-03f, 6.81816968e-03f, 6.34452100e-03f,
+        5.87102220e-03f, 5.39774014e-03f, 4.92474168e-03f, 4.45209374e-03f, 3.97986325e-03f, 3.50811715e-03f, 3.03692237e-03f, 2.56634583e-03f,
+        2.09645445e-03f, 1.62731506e-03f, 1.15899450e-03f, 6.91559524e-04f, 2.25076819e-04f, -2.40387000e-04f, -7.04765413e-04f, -1.16799200e-03f,
+        -1.63000045e-03f, -2.09072457e-03f, -2.55009833e-03f, -3.00805580e-03f, -3.46453124e-03f, -3.91945907e-03f, -4.37277388e-03f, -4.82441045e-03f,
+        -5.27430376e-03f, -5.72238901e-03f, -6.16860160e-03f, -6.61287718e-03f, -7.05515165e-03f, -7.49536114e-03f, -7.93344205e-03f, -8.36933107e-03f,
+        -8.80296516e-03f, -9.23428158e-03f, -9.66321790e-03f, -1.00897120e-02f, -1.05137021e-02f, -1.09351267e-02f, -1.13539248e-02f, -1.17700356e-02f,
+        -1.21833988e-02f, -1.25939542e-02f, -1.30016424e-02f, -1.34064041e-02f, -1.38081806e-02f, -1.42069134e-02f, -1.46025446e-02f, -1.49950168e-02f,
+        -1.53842727e-02f, -1.57702559e-02f, -1.61529103e-02f, -1.65321801e-02f, -1.69080102e-02f, -1.72803460e-02f, -1.76491333e-02f, -1.80143184e-02f,
+        -1.83758482e-02f, -1.87336702e-02f, -1.90877323e-02f, -1.94379830e-02f, -1.97843714e-02f, -2.01268472e-02f, -2.04653606e-02f, -2.07998624e-02f,
+        -2.11303039e-02f, -2.14566373e-02f, -2.17788152e-02f, -2.20967908e-02f, -2.24105180e-02f, -2.27199513e-02f, -2.30250458e-02f, -2.33257575e-02f,
+        -2.36220428e-02f, -2.39138588e-02f, -2.42011634e-02f, -2.44839150e-02f, -2.47620730e-02f, -2.50355971e-02f, -2.53044480e-02f, -2.55685871e-02f,
+        -2.58279763e-02f, -2.60825785e-02f, -2.63323571e-02f, -2.65772764e-02f, -2.68173013e-02f, -2.70523978e-02f, -2.72825321e-02f, -2.75076716e-02f,
+        -2.77277844e-02f, -2.79428392e-02f, -2.81528057e-02f, -2.83576542e-02f, -2.85573559e-02f, -2.87518828e-02f, -2.89412077e-02f, -2.91253042e-02f,
+        -2.93041467e-02f, -2.94777104e-02f, -2.96459714e-02f, -2.98089065e-02f, -2.99664934e-02f, -3.01187108e-02f, -3.02655379e-02f, -3.04069551e-02f,
+        -3.05429434e-02f, -3.06734847e-02f, -3.07985618e-02f, -3.09181584e-02f, -3.10322590e-02f, -3.11408490e-02f, -3.12439146e-02f, -3.13414428e-02f,
+        -3.14334219e-02f, -3.15198405e-02f, -3.16006884e-02f, -3.16759563e-02f, -3.17456356e-02f, -3.18097188e-02f, -3.18681992e-02f, -3.19210709e-02f,
+        -3.19683290e-02f, -3.20099694e-02f, -3.20459889e-02f, -3.20763854e-02f, -3.21011575e-02f, -3.21203046e-02f, -3.21338273e-02f, -3.21417268e-02f,
+        -3.21440053e-02f, -3.21406660e-02f, -3.21317129e-02f, -3.21171509e-02f, -3.20969858e-02f, -3.20712243e-02f, -3.20398740e-02f, -3.20029434e-02f,
+        -3.19604419e-02f, -3.19123797e-02f, -3.18587680e-02f, -3.17996190e-02f, -3.17349455e-02f, -3.16647613e-02f, -3.15890813e-02f, -3.15079209e-02f,
+        -3.14212968e-02f, -3.13292262e-02f, -3.12317274e-02f, -3.11288194e-02f, -3.10205224e-02f, -3.09068571e-02f, -3.07878453e-02f, -3.06635095e-02f,
+        -3.05338733e-02f, -3.03989607e-02f, -3.02587972e-02f, -3.01134085e-02f, -2.99628216e-02f, -2.98070641e-02f, -2.96461646e-02f, -2.94801523e-02f,
+        -2.93090576e-02f, -2.91329113e-02f, -2.89517453e-02f, -2.87655922e-02f, -2.85744854e-02f, -2.83784592e-02f, -2.81775486e-02f, -2.79717894e-02f,
+        -2.77612183e-02f, -2.75458727e-02f, -2.73257906e-02f, -2.71010111e-02f, -2.68715739e-02f, -2.66375193e-02f, -2.63988887e-02f, -2.61557239e-02f,
+        -2.59080676e-02f, -2.56559634e-02f, -2.53994552e-02f, -2.51385880e-02f, -2.48734073e-02f, -2.46039595e-02f, -2.43302914e-02f, -2.40524507e-02f,
+        -2.37704858e-02f, -2.34844456e-02f, -2.31943799e-02f, -2.29003389e-02f, -2.26023736e-02f, -2.23005356e-02f, -2.19948772e-02f, -2.16854513e-02f,
+        -2.13723113e-02f, -2.10555113e-02f, -2.07351060e-02f, -2.04111506e-02f, -2.00837011e-02f, -1.97528139e-02f, -1.94185458e-02f, -1.90809546e-02f,
+        -1.87400982e-02f, -1.83960353e-02f, -1.80488251e-02f, -1.76985270e-02f, -1.73452015e-02f, -1.69889090e-02f, -1.66297108e-02f, -1.62676684e-02f,
+        -1.59028439e-02f, -1.55352999e-02f, -1.51650994e-02f, -1.47923058e-02f, -1.44169828e-02f, -1.40391949e-02f, -1.36590066e-02f, -1.32764829e-02f,
+        -1.28916895e-02f, -1.25046919e-02f, -1.21155565e-02f, -1.17243497e-02f, -1.13311384e-02f, -1.09359898e-02f, -1.05389714e-02f, -1.01401510e-02f,
+        -9.73959673e-03f, -9.33737698e-03f, -8.93356043e-03f, -8.52821599e-03f, -8.12141287e-03f, -7.71322047e-03f, -7.30370844e-03f, -6.89294667e-03f,
+        -6.48100521e-03f, -6.06795434e-03f, -5.65386450e-03f, -5.23880632e-03f, -4.82285058e-03f, -4.40606820e-03f, -3.98853025e-03f, -3.57030791e-03f,
+        -3.15147250e-03f, -2.73209540e-03f, -2.31224811e-03f, -1.89200221e-03f, -1.47142932e-03f, -1.05060115e-03f, -6.29589416e-04f, -2.08465888e-04f,
+    },
+};
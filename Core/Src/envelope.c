@@ -0,0 +1,63 @@
+#include "envelope.h"
+#include <math.h> // sqrtf
+
+/**
+ * @brief 基于希尔伯特变换的包络谱分析。
+ */
+uint32_t envelope_spectrum(complex_t *work, uint32_t n, uint32_t decimation, float *magnitudes)
+{
+    if (n < 4 || (n & (n - 1)) != 0 ||
+        decimation == 0 || (decimation & (decimation - 1)) != 0 || decimation > n / 4)
+    {
+        return 0; // n 和抽取因子都必须是 2 的幂，且抽取后至少保留 4 点
+    }
+
+    // --- 1. 正变换 ---
+    fft_radix2(work, n);
+
+    // --- 2. 构造解析信号的频谱: 正频率加倍，负频率置零，直流和奈奎斯特保持不变 ---
+    for (uint32_t k = 1; k < n / 2; k++)
+    {
+        work[k].real *= 2.0f;
+        work[k].imag *= 2.0f;
+    }
+    for (uint32_t k = n / 2 + 1; k < n; k++)
+    {
+        work[k].real = 0.0f;
+        work[k].imag = 0.0f;
+    }
+
+    // --- 3. 逆变换得到解析信号 ---
+    fft_inverse_radix2(work, n);
+
+    // --- 4. 包络 = |解析信号|，同时按块平均抽取 (写入位置 j <= 读取位置 j * D，可原地进行) ---
+    uint32_t env_n = n / decimation;
+    float inv_decimation = 1.0f / (float)decimation;
+    float env_mean = 0.0f;
+    for (uint32_t j = 0; j < env_n; j++)
+    {
+        float acc = 0.0f;
+        for (uint32_t d = 0; d < decimation; d++)
+        {
+            complex_t z = work[j * decimation + d];
+            acc += sqrtf(z.real * z.real + z.imag * z.imag);
+        }
+        acc *= inv_decimation;
+        work[j].real = acc;
+        env_mean += acc;
+    }
+    env_mean /= (float)env_n;
+
+    // --- 5. 去除包络直流分量，避免掩盖低频故障特征 ---
+    for (uint32_t j = 0; j < env_n; j++)
+    {
+        work[j].real -= env_mean;
+        work[j].imag = 0.0f;
+    }
+
+    // --- 6. 对包络做第二次 FFT ---
+    fft_radix2(work, env_n);
+    fft_calculate_magnitudes(work, magnitudes, env_n);
+
+    return env_n / 2;
+}
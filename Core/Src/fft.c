@@ -53,6 +53,14 @@ static void bit_reversal_permutation(complex_t *data, uint32_t n, uint32_t log2n
  * @brief 执行基-2 时域抽取快速傅里叶变换 (Radix-2 DIT FFT)。
  */
 void fft_radix2(complex_t *input_output, uint32_t n)
+{
+    fft_radix2_batch(input_output, n, 1);
+}
+
+/**
+ * @brief 对连续存放的多组数据执行基-2 FFT。
+ */
+void fft_radix2_batch(complex_t *input_output, uint32_t n, uint32_t count)
 {
     // --- 输入验证 ---
     if (n == 0 || (n & (n - 1)) != 0)
@@ -60,6 +68,7 @@ void fft_radix2(complex_t *input_output, uint32_t n)
         // n 必须大于 0 且是 2 的幂 (检查 n & (n-1) 是否为 0)
         return; // 如果输入无效则返回
     }
+    uint32_t total = n * count; // 所有组的总点数
 
     // --- 计算 log2(n) ---
     uint32_t log2n = 0;
@@ -71,8 +80,11 @@ void fft_radix2(complex_t *input_output, uint32_t n)
     }
 
     // --- 位反转置换 ---
-    // 重新排列输入数据，以便进行蝶形运算
-    bit_reversal_permutation(input_output, n, log2n);
+    // 重新排列输入数据，以便进行蝶形运算 (每组分别置换)
+    for (uint32_t offset = 0; offset < total; offset += n)
+    {
+        bit_reversal_permutation(&input_output[offset], n, log2n);
+    }
 
     // --- 蝶形运算 ---
     // 从第 1 级到第 log2n 级迭代
@@ -96,7 +108,8 @@ void fft_radix2(complex_t *input_output, uint32_t n)
         for (uint32_t j = 0; j < m_half; j++)
         {
             // 遍历具有相同旋转因子的所有分组 (k 从 j 开始，步长为 m)
-            for (uint32_t k = j; k < n; k += m)
+            // m 整除 n，分组不会跨越相邻两组数据，因此各组共用同一个旋转因子，一次循环处理完所有组
+            for (uint32_t k = j; k < total; k += m)
             {
                 complex_t t;                 // 临时变量，用于存储 w * input_output[k + m/2]
                 uint32_t k_odd = k + m_half; // 蝶形运算的“奇数”输入索引
@@ -123,6 +136,32 @@ void fft_radix2(complex_t *input_output, uint32_t n)
     }
 }
 
+/**
+ * @brief 执行基-2 快速傅里叶逆变换 (IFFT)。
+ */
+void fft_inverse_radix2(complex_t *input_output, uint32_t n)
+{
+    if (n == 0 || (n & (n - 1)) != 0)
+    {
+        return; // n 必须大于 0 且是 2 的幂
+    }
+
+    // IFFT(X) = conj(FFT(conj(X))) / n
+    for (uint32_t i = 0; i < n; i++)
+    {
+        input_output[i].imag = -input_output[i].imag;
+    }
+
+    fft_radix2(input_output, n);
+
+    float scale = 1.0f / (float)n;
+    for (uint32_t i = 0; i < n; i++)
+    {
+        input_output[i].real = input_output[i].real * scale;
+        input_output[i].imag = -input_output[i].imag * scale;
+    }
+}
+
 /**
  * @brief 计算复数 FFT 输出的幅度。
  */
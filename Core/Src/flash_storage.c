@@ -0,0 +1,40 @@
+#include "flash_storage.h"
+#include "stm32f4xx_hal.h" // HAL_FLASH_*, HAL_FLASHEx_Erase
+
+/**
+ * @brief 擦除存储扇区并按字写入数据。
+ */
+uint8_t flash_storage_write(const void *data, uint32_t len)
+{
+    if (len == 0 || len > FLASH_STORAGE_SIZE)
+    {
+        return 0;
+    }
+
+    FLASH_EraseInitTypeDef erase;
+    erase.TypeErase = FLASH_TYPEERASE_SECTORS;
+    erase.Sector = FLASH_STORAGE_SECTOR;
+    erase.NbSectors = 1;
+    erase.VoltageRange = FLASH_VOLTAGE_RANGE_3; // 2.7 ~ 3.6 V，按 32 位并行擦写
+    uint32_t sector_error = 0;
+
+    HAL_FLASH_Unlock();
+    uint8_t ok = (HAL_FLASHEx_Erase(&erase, &sector_error) == HAL_OK);
+
+    const uint32_t *words = (const uint32_t *)data;
+    uint32_t num_words = (len + 3) / 4;
+    for (uint32_t i = 0; ok && i < num_words; i++)
+    {
+        ok = (HAL_FLASH_Program(FLASH_TYPEPROGRAM_WORD, FLASH_STORAGE_ADDRESS + 4 * i, words[i]) == HAL_OK);
+    }
+    HAL_FLASH_Lock();
+    return ok;
+}
+
+/**
+ * @brief 返回存储区的只读指针。
+ */
+const void *flash_storage_read(void)
+{
+    return (const void *)FLASH_STORAGE_ADDRESS;
+}
@@ -0,0 +1,121 @@
+#include "gcc_phat.h"
+#include <math.h> // sqrtf
+
+// PHAT 加权时忽略幅度过小的频点，防止除零
+#define GCC_PHAT_EPSILON 1e-20f
+
+/**
+ * @brief 使用 GCC-PHAT 估计两路信号之间的时延。
+ */
+void gcc_phat_estimate(const float *x, const float *y, uint32_t len,
+                       complex_t *work, uint32_t n, uint32_t max_lag,
+                       gcc_phat_result_t *result)
+{
+    result->lag_samples = 0.0f;
+    result->confidence = 0.0f;
+
+    if (n < 4 || (n & (n - 1)) != 0 || len > n)
+    {
+        return; // n 必须是 2 的幂，且能容纳输入
+    }
+    if (max_lag == 0 || max_lag > n / 2 - 1)
+    {
+        max_lag = n / 2 - 1;
+    }
+
+    // --- 1. 两路实信号打包为 z = x + j*y，零填充到 n ---
+    for (uint32_t i = 0; i < n; i++)
+    {
+        if (i < len)
+        {
+            work[i].real = x[i];
+            work[i].imag = y[i];
+        }
+        else
+        {
+            work[i].real = 0.0f;
+            work[i].imag = 0.0f;
+        }
+    }
+
+    // --- 2. 一次正变换得到 Z[k] ---
+    fft_radix2(work, n);
+
+    // --- 3. 分离 X[k], Y[k]，求互谱 G = conj(X) * Y 并按幅度归一化 ---
+    // X[k] = (Z[k] + conj(Z[n-k])) / 2,  Y[k] = (Z[k] - conj(Z[n-k])) / 2j
+    // 公共的 1/2 因子在归一化中抵消，故省略。
+    // G 具有共轭对称性，只需计算 k = 0 ~ n/2，再镜像写入 G[n-k]。
+    for (uint32_t k = 0; k <= n / 2; k++)
+    {
+        uint32_t k_mirror = (n - k) & (n - 1);
+        complex_t a = work[k];
+        complex_t b = work[k_mirror];
+        b.imag = -b.imag; // b = conj(Z[n-k])
+
+        float xr = a.real + b.real;
+        float xi = a.imag + b.imag;
+        // (a - b) / j = -j * (a - b)
+        float yr = a.imag - b.imag;
+        float yi = -(a.real - b.real);
+
+        // conj(X) * Y
+        float gr = xr * yr + xi * yi;
+        float gi = xr * yi - xi * yr;
+
+        float mag_sq = gr * gr + gi * gi;
+        if (mag_sq > GCC_PHAT_EPSILON)
+        {
+            float inv_mag = 1.0f / sqrtf(mag_sq);
+            gr *= inv_mag;
+            gi *= inv_mag;
+        }
+        else
+        {
+            gr = 0.0f;
+            gi = 0.0f;
+        }
+
+        work[k].real = gr;
+        work[k].imag = gi;
+        work[k_mirror].real = gr;
+        work[k_mirror].imag = -gi;
+    }
+
+    // --- 4. 逆变换得到广义互相关 r[m] (实序列，负时延位于数组尾部) ---
+    fft_inverse_radix2(work, n);
+
+    // --- 5. 在 ±max_lag 范围内搜索峰值 ---
+    int32_t best_lag = 0;
+    float best_value = work[0].real;
+    for (uint32_t m = 1; m <= max_lag; m++)
+    {
+        if (work[m].real > best_value)
+        {
+            best_value = work[m].real;
+            best_lag = (int32_t)m;
+        }
+        if (work[n - m].real > best_value)
+        {
+            best_value = work[n - m].real;
+            best_lag = -(int32_t)m;
+        }
+    }
+
+    // --- 6. 抛物线插值得到子样本时延 ---
+    uint32_t idx = (uint32_t)best_lag & (n - 1);
+    float left = work[(idx - 1) & (n - 1)].real;
+    float right = work[(idx + 1) & (n - 1)].real;
+    float denom = left - 2.0f * best_value + right;
+    float delta = 0.0f;
+    if (denom < 0.0f)
+    {
+        delta = 0.5f * (left - right) / denom;
+        if (delta > 0.5f)
+            delta = 0.5f;
+        else if (delta < -0.5f)
+            delta = -0.5f;
+    }
+
+    result->lag_samples = (float)best_lag + delta;
+    result->confidence = best_value;
+}
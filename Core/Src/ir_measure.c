@@ -0,0 +1,126 @@
+#include "ir_measure.h"
+
+#define IR_SWEEP_REGULARIZATION 1e-4f // 逆滤波正则化量 (相对于扫频范围内 |X|^2 的最大值)
+
+/**
+ * @brief 生成双极性 MLS 激励。
+ */
+void ir_mls_generate(uint32_t *state, float *buffer, uint32_t len, float amplitude)
+{
+    uint32_t s = *state;
+    for (uint32_t n = 0; n < len; n++)
+    {
+        buffer[n] = (s & 1u) ? -amplitude : amplitude;
+
+        // 反馈位为抽头位的奇偶校验
+        uint32_t feedback = s & MLS_TAP_MASK;
+        feedback ^= feedback >> 8;
+        feedback ^= feedback >> 4;
+        feedback ^= feedback >> 2;
+        feedback ^= feedback >> 1;
+        s = (s >> 1) | ((feedback & 1u) << (MLS_ORDER - 1));
+    }
+    *state = s;
+}
+
+/**
+ * @brief 原地快速 Walsh-Hadamard 变换。
+ */
+void ir_fwht(float *data, uint32_t len)
+{
+    for (uint32_t half = 1; half < len; half <<= 1)
+    {
+        for (uint32_t i = 0; i < len; i += 2 * half)
+        {
+            for (uint32_t j = i; j < i + half; j++)
+            {
+                float a = data[j];
+                float b = data[j + half];
+                data[j] = a + b;
+                data[j + half] = a - b;
+            }
+        }
+    }
+}
+
+/**
+ * @brief MLS 反卷积。
+ */
+void ir_mls_deconvolve(const float *response, float *work, float *impulse, float amplitude)
+{
+    // --- 1. 按输入置换表散布 (Hadamard 下标 0 不对应任何采样) ---
+    work[0] = 0.0f;
+    for (uint32_t n = 0; n < MLS_LENGTH; n++)
+    {
+        work[mls_input_perm[n]] = response[n];
+    }
+
+    // --- 2. 快速 Hadamard 变换得到循环相关 r[k] ---
+    ir_fwht(work, MLS_HADAMARD_SIZE);
+
+    // --- 3. 按输出置换表收集，并去掉 MLS 相关的直流偏置 ---
+    // r[k] = (N + 1) * h[k] - sum(h)，且 sum(y) = -sum(h) (MLS 各项之和为 -1)，work[0] 即 sum(y)
+    float sum = work[0];
+    float scale = 1.0f / ((float)(MLS_LENGTH + 1) * amplitude);
+    for (uint32_t k = 0; k < MLS_LENGTH; k++)
+    {
+        impulse[k] = (work[mls_output_perm[k]] - sum) * scale;
+    }
+}
+
+/**
+ * @brief 指数扫频反卷积。
+ */
+void ir_sweep_deconvolve(complex_t *buffer, uint32_t n, float f_low, float f_high, float sample_rate)
+{
+    fft_radix2(buffer, n);
+
+    uint32_t k_low = (uint32_t)(f_low * (float)n / sample_rate);
+    uint32_t k_high = (uint32_t)(f_high * (float)n / sample_rate + 0.5f);
+    if (k_high > n / 2)
+    {
+        k_high = n / 2;
+    }
+
+    // --- 1. 正则化量取扫频范围内激励功率的最大值的固定比例 ---
+    float max_power = 0.0f;
+    for (uint32_t k = k_low; k <= k_high; k++)
+    {
+        complex_t z = buffer[k];
+        complex_t zc = buffer[(n - k) & (n - 1)];
+        float xr = 0.5f * (z.real + zc.real);
+        float xi = 0.5f * (z.imag - zc.imag);
+        float power = xr * xr + xi * xi;
+        if (power > max_power)
+        {
+            max_power = power;
+        }
+    }
+    float eps = IR_SWEEP_REGULARIZATION * max_power + 1e-30f;
+
+    // --- 2. 成对分离 X(k)、Y(k)，求 H(k)，并按共轭对称写回 k 和 n-k ---
+    for (uint32_t k = 0; k <= n / 2; k++)
+    {
+        uint32_t m = (n - k) & (n - 1);
+        complex_t h = {0.0f, 0.0f};
+        if (k >= k_low && k <= k_high)
+        {
+            complex_t z = buffer[k];
+            complex_t zc = buffer[m];
+            // X = (Z(k) + conj(Z(n-k))) / 2，Y = (Z(k) - conj(Z(n-k))) / 2j
+            float xr = 0.5f * (z.real + zc.real);
+            float xi = 0.5f * (z.imag - zc.imag);
+            float yr = 0.5f * (z.imag + zc.imag);
+            float yi = -0.5f * (z.real - zc.real);
+            float inv = 1.0f / (xr * xr + xi * xi + eps);
+            // H = Y * conj(X) / (|X|^2 + eps)
+            h.real = (yr * xr + yi * xi) * inv;
+            h.imag = (yi * xr - yr * xi) * inv;
+        }
+        buffer[k] = h;
+        buffer[m].real = h.real;
+        buffer[m].imag = -h.imag;
+    }
+
+    fft_inverse_radix2(buffer, n);
+}
@@ -0,0 +1,116 @@
+#include "level_meter.h"
+#include <math.h>  // expf, log10f
+#include <float.h> // FLT_MAX
+
+// 声级下限，防止对 0 取对数
+#define LEVEL_METER_MS_FLOOR 1e-20f
+// 启动稳定时间 (Fast 时间常数的 5 倍)
+#define LEVEL_METER_SETTLE_TAUS 5.0f
+
+// --- 私有辅助函数 ---
+
+/**
+ * @brief 根据时间常数计算一阶指数平均系数。
+ */
+static float time_constant_alpha(float sample_rate, float tau)
+{
+    return 1.0f - expf(-1.0f / (sample_rate * tau));
+}
+
+/**
+ * @brief 均方值转换为 dB。
+ */
+static float ms_to_db(float ms)
+{
+    return 10.0f * log10f(ms + LEVEL_METER_MS_FLOOR);
+}
+
+// --- 公共函数 ---
+
+/**
+ * @brief 初始化声级计。
+ */
+void level_meter_init(level_meter_t *meter, float sample_rate)
+{
+    meter->alpha_fast = time_constant_alpha(sample_rate, LEVEL_METER_TAU_FAST);
+    meter->alpha_slow = time_constant_alpha(sample_rate, LEVEL_METER_TAU_SLOW);
+    meter->alpha_impulse_rise = time_constant_alpha(sample_rate, LEVEL_METER_TAU_IMPULSE_RISE);
+    meter->alpha_impulse_fall = time_constant_alpha(sample_rate, LEVEL_METER_TAU_IMPULSE_FALL);
+
+    meter->ms_fast = 0.0f;
+    meter->ms_slow = 0.0f;
+    meter->ms_impulse = 0.0f;
+
+    meter->energy_sum = 0.0;
+    meter->sample_count = 0;
+    meter->ms_max = 0.0f;
+    meter->ms_min = FLT_MAX;
+
+    meter->settle_samples = (uint32_t)(sample_rate * LEVEL_METER_TAU_FAST * LEVEL_METER_SETTLE_TAUS);
+}
+
+/**
+ * @brief 用一段时域采样更新声级计。
+ */
+void level_meter_process(level_meter_t *meter, const float *samples, uint32_t len)
+{
+    // 状态读入局部变量，循环内只做寄存器运算
+    float ms_fast = meter->ms_fast;
+    float ms_slow = meter->ms_slow;
+    float ms_impulse = meter->ms_impulse;
+    float ms_max = meter->ms_max;
+    float ms_min = meter->ms_min;
+    float block_energy = 0.0f;
+    uint32_t settle = meter->settle_samples;
+
+    for (uint32_t i = 0; i < len; i++)
+    {
+        float sq = samples[i] * samples[i];
+        block_energy += sq;
+
+        ms_fast += meter->alpha_fast * (sq - ms_fast);
+        ms_slow += meter->alpha_slow * (sq - ms_slow);
+        // Impulse 计权: 上升快、衰减慢
+        float alpha_impulse = (sq > ms_impulse) ? meter->alpha_impulse_rise : meter->alpha_impulse_fall;
+        ms_impulse += alpha_impulse * (sq - ms_impulse);
+
+        if (settle > 0)
+        {
+            settle--;
+            continue;
+        }
+        if (ms_fast > ms_max)
+            ms_max = ms_fast;
+        if (ms_fast < ms_min)
+            ms_min = ms_fast;
+    }
+
+    meter->ms_fast = ms_fast;
+    meter->ms_slow = ms_slow;
+    meter->ms_impulse = ms_impulse;
+    meter->ms_max = ms_max;
+    meter->ms_min = ms_min;
+    meter->settle_samples = settle;
+    // 块内用 float 累加，块间用 double 累加，避免长时间积分丢失精度
+    meter->energy_sum += (double)block_energy;
+    meter->sample_count += len;
+}
+
+/**
+ * @brief 读取当前声级，并清零上报间隔内的统计量。
+ */
+void level_meter_read_and_reset(level_meter_t *meter, level_meter_result_t *result)
+{
+    float ms_leq = (meter->sample_count > 0) ? (float)(meter->energy_sum / (double)meter->sample_count) : 0.0f;
+    result->leq = ms_to_db(ms_leq);
+    result->lmax = ms_to_db(meter->ms_max);
+    result->lmin = (meter->ms_min < FLT_MAX) ? ms_to_db(meter->ms_min) : ms_to_db(0.0f);
+    result->fast = ms_to_db(meter->ms_fast);
+    result->slow = ms_to_db(meter->ms_slow);
+    result->impulse = ms_to_db(meter->ms_impulse);
+
+    meter->energy_sum = 0.0;
+    meter->sample_count = 0;
+    meter->ms_max = 0.0f;
+    meter->ms_min = FLT_MAX;
+}
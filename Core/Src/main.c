@@ -18,12 +18,39 @@
 /* USER CODE END Header */
 /* Includes ------------------------------------------------------------------*/
 #include "main.h"
+#include "adc.h"
+#include "dma.h"
+#include "tim.h"
 // #include "usb_device.h"
 #include "gpio.h"
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
 #include "fft.h"              // 包含自定义的 FFT 头文件
+#include "gcc_phat.h"         // GCC-PHAT 时延估计
+#include "autocorr.h"         // 自相关与基音/周期检测
+#include "octave_bands.h"     // 分数倍频程频带分析
+#include "level_meter.h"      // 声级计 (Leq, Fast/Slow/Impulse)
+#include "mfcc.h"             // 梅尔滤波器组与 MFCC 特征
+#include "spectral_features.h" // 标量频谱描述符
+#include "envelope.h"         // 希尔伯特包络谱
+#include "multitaper.h"       // DPSS 多窗谱估计
+#include "ar_spectrum.h"      // AR 参数谱估计
+#include "wavelet.h"          // 提升格式离散小波变换
+#include "cqt.h"              // 常数 Q 变换
+#include "sparse_fft.h"       // 稀疏 FFT 峰值恢复
+#include "channelizer.h"      // 多相滤波器组信道化器
+#include "baseline.h"         // 逐频点基线与异常评分
+#include "flash_storage.h"    // Flash 参数存储
+#include "occupancy.h"        // 逐频点占用度统计
+#include "dds.h"              // DDS 相位累加正弦振荡器
+#include "siggen.h"           // 多波形测试信号发生器
+#include "spectrum_cache.h"   // 按参数缓存的频谱结果 (LRU)
+#include "sweep.h"            // 扫频 (Bode) 测量
+#include "ir_measure.h"       // MLS / 指数扫频冲激响应测量
+#include "acquisition.h"      // ADC 乒乓 DMA 采集
+#include "trigger.h"          // 电平/斜率触发
+#include "spectral_mask.h"    // 频率模板 (限值线) 比较
 #include <math.h>             // 包含数学库
 #include <stdio.h>            // 添加: 包含标准输入输出库 (用于 sprintf)
 #include <string.h>           // 添加: 包含字符串库 (用于 strlen)
@@ -32,6 +59,97 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* USER CODE BEGIN PTD */
+// 频谱结果的输出模式 (perform_fft_and_send 第 5 步)
+typedef enum
+{
+  SPECTRUM_OUTPUT_BINS = 0, // 逐个频点发送 N/2 个线性幅度
+  SPECTRUM_OUTPUT_OCTAVE,   // 发送分数倍频程频带声级
+  SPECTRUM_OUTPUT_MFCC,     // 连续发送 MFCC 二进制帧
+  SPECTRUM_OUTPUT_DESCRIPTORS, // 连续发送频谱描述符二进制帧
+  SPECTRUM_OUTPUT_CQT          // 发送对数频率间隔的常数 Q 频点幅度
+} spectrum_output_mode_t;
+
+// 频谱估计方法 (perform_fft_and_send 第 3、4 步)
+typedef enum
+{
+  SPECTRUM_ESTIMATOR_PERIODOGRAM = 0,     // 单次 FFT 周期图 (矩形窗)
+  SPECTRUM_ESTIMATOR_MULTITAPER,          // DPSS 多窗，等权平均
+  SPECTRUM_ESTIMATOR_MULTITAPER_ADAPTIVE, // DPSS 多窗，Thomson 自适应加权
+  SPECTRUM_ESTIMATOR_AR                   // AR/LPC 参数模型 (Levinson-Durbin)
+} spectrum_estimator_t;
+
+// 分析引擎 (perform_fft_and_send 第 3 步起)
+typedef enum
+{
+  ANALYSIS_ENGINE_FFT = 0, // 频谱估计 + 按输出模式发送
+  ANALYSIS_ENGINE_WAVELET, // 离散小波变换，连续发送各层统计二进制帧
+  ANALYSIS_ENGINE_SPARSE_FFT, // 稀疏 FFT，按需生成采样，发送峰值列表
+  ANALYSIS_ENGINE_CHANNELIZER, // 多相滤波器组，发送各信道功率或单个信道的复数样本
+  ANALYSIS_ENGINE_SCAN        // 多通道扫描采集，批量 FFT，发送各通道指标或频谱
+} analysis_engine_t;
+
+// 多通道扫描输出内容
+typedef enum
+{
+  SCAN_OUTPUT_METRICS = 0, // 各通道直流、交流有效值和峰值频点 (连续出帧)
+  SCAN_OUTPUT_SPECTRA      // 各通道幅度谱 (单次)
+} scan_output_t;
+
+// 触发捕获状态
+typedef enum
+{
+  TRIGGER_STATE_OFF = 0, // 未启用，按原方式出帧
+  TRIGGER_STATE_ARMED,   // 布防: 每块写入环形缓冲区并检查触发条件，不出帧
+  TRIGGER_STATE_POST,    // 已触发，等待下一块补齐触发后的采样
+  TRIGGER_STATE_READY    // 捕获窗口已放入 adc_samples，等待分析
+} trigger_state_t;
+
+// 信道化器输出内容
+typedef enum
+{
+  CHANNELIZER_OUTPUT_POWER = 0, // 各信道平均功率 (dB)
+  CHANNELIZER_OUTPUT_COMPLEX    // 选定信道在抽取后速率上的复数样本
+} channelizer_output_t;
+
+// 频谱异常检测状态
+typedef enum
+{
+  ANOMALY_MODE_OFF = 0, // 关闭，正常输出频谱
+  ANOMALY_MODE_LEARN,   // 学习基线 (Welford 更新各频点均值/方差)
+  ANOMALY_MODE_MONITOR  // 对照基线评分，只发送异常事件
+} anomaly_mode_t;
+
+// 异常判定使用的评分
+typedef enum
+{
+  ANOMALY_METRIC_MAX_Z = 0, // 单个频点的最大 |z| (窄带异常)
+  ANOMALY_METRIC_RMS_Z      // 各频点 z 的均方根，对角协方差下的简化马氏距离 (宽带异常)
+} anomaly_metric_t;
+
+// 按下标取样的测试信号 (相位累加形式，供稀疏 FFT 随机读取采样使用，只支持正弦)
+typedef struct
+{
+  uint32_t phase_step; // 每个采样的相位增量 (2^32 对应一个周期)
+  float amplitude;
+  float offset;
+  uint32_t reads; // 已读取的采样数
+} indexed_signal_t;
+
+// 二进制帧类型 (帧格式见 send_binary_frame)
+typedef enum
+{
+  BINARY_FRAME_MFCC = 0x01,       // 载荷: float[num_coeffs]
+  BINARY_FRAME_DESCRIPTORS = 0x02, // 载荷: spectral_descriptors_t (12 个 float)
+  BINARY_FRAME_WAVELET = 0x03      // 载荷: wavelet_frame_t (只发送 levels + 1 层)
+} binary_frame_type_t;
+
+// 小波帧载荷
+typedef struct
+{
+  uint32_t cycles;                                        // 变换 + 统计消耗的 CPU 周期数
+  uint32_t levels;                                        // 实际分解层数
+  wavelet_level_stats_t stats[WAVELET_MAX_LEVELS + 1];    // 各层细节统计，最后一项为近似系数
+} wavelet_frame_t;
 
 /* USER CODE END PTD */
 
@@ -42,8 +160,17 @@
 #define USB_RX_BUFFER_SIZE 256
 
 #define ADC_BUFFER_SIZE FFT_N // 假设 ADC 采样点数与 FFT 点数相同
-// --- 采样频率 (固定) ---
-#define SAMPLING_FREQ 48000.0f // 假设的采样频率 (Hz)
+// --- 采样频率 (运行时可调) ---
+#define DEFAULT_SAMPLING_FREQ 48000.0f // 上电时的采样频率 (Hz)，与 MX_TIM2_Init 中的 TIM2 分频一致
+#define SAMPLING_FREQ_MIN 100.0f       // RATE 命令允许的最低采样频率 (Hz)
+#define SAMPLING_FREQ_MAX 200000.0f    // RATE 命令允许的最高采样频率 (Hz，受 ADC 转换时间和处理速度限制)
+
+// --- 二进制帧 ---
+#define BINARY_FRAME_SYNC0 0xA5        // 帧头同步字节 0
+#define BINARY_FRAME_SYNC1 0x5A        // 帧头同步字节 1
+#define BINARY_FRAME_HEADER_SIZE 6     // 同步(2) + 类型(1) + 序号(1) + 长度(2)
+#define BINARY_FRAME_MAX_PAYLOAD 256   // 最大载荷字节数
+#define BINARY_FRAME_TX_TIMEOUT_MS 20  // 等待上一帧发送完成的超时时间
 /* USER CODE END PD */
 
 /* Private macro -------------------------------------------------------------*/
@@ -61,6 +188,40 @@ volatile float current_signal_freq = 1000.0f;   // 当前正弦波频率 (Hz)
 volatile float current_signal_amplitude = 1.0f; // 当前正弦波幅度
 volatile float current_signal_offset = 0.0f;    // 当前正弦波直流偏移
 volatile uint8_t new_parameters_received = 1;   // 标志位，指示是否收到新参数 (初始设为1，以便启动时计算一次)
+volatile uint8_t dds_benchmark_pending = 0;     // 标志位，指示需要执行一次 DDS 与 sinf 的对比测试
+
+// --- 采样频率 ---
+float sampling_freq = DEFAULT_SAMPLING_FREQ;       // 当前实际采样频率 (Hz)，只在主循环中修改
+volatile float sample_rate_request = 0.0f;         // RATE 命令请求的采样频率 (Hz)
+volatile uint8_t sample_rate_pending = 0;          // 标志位，指示需要重新设置采样频率
+
+// --- 扫频 (Bode) 测量 ---
+volatile uint8_t sweep_pending = 0;    // 标志位，指示需要执行一次扫频测量
+volatile float sweep_start_freq = 0.0f; // 起始频率 (Hz)
+volatile float sweep_stop_freq = 0.0f;  // 终止频率 (Hz)
+volatile uint32_t sweep_points = 0;     // 频点数
+volatile uint8_t sweep_logarithmic = 0; // 1: 对数间隔; 0: 线性间隔
+volatile uint32_t sweep_dwell_ms = 0;   // 每个频点测量前的稳定时间 (ms)
+
+// --- 冲激响应测量 ---
+#define IR_SWEEP_LENGTH (FFT_N / 2)      // 指数扫频激励长度 (其余一半为冲激响应尾部留出的空间)
+volatile uint8_t ir_request_pending = 0; // 标志位，指示需要执行一次冲激响应测量
+volatile char ir_method = 'M';           // 'M': MLS + 快速 Hadamard 变换; 'E': 指数扫频 + 逆滤波
+volatile uint32_t ir_taps = 64;          // 回传的冲激响应点数
+volatile float ir_sweep_low = 200.0f;    // 指数扫频起始频率 (Hz)
+volatile float ir_sweep_high = 20000.0f; // 指数扫频终止频率 (Hz)
+
+// --- 多波形测试信号发生器 ---
+siggen_t test_generator;                                        // 发生器状态 (相位和噪声状态跨帧连续)
+siggen_config_t generator_config = {.waveform = SIGGEN_SINE};   // 当前生效的配置
+siggen_config_t generator_request;                              // USB 命令写入的新配置，下一帧生效
+volatile uint8_t generator_config_pending = 0;                  // 标志位，指示有新的发生器配置
+uint32_t generator_cycles = 0;                                  // 最近一帧信号生成消耗的 CPU 周期数
+
+// --- 频谱结果缓存 ---
+spectrum_cache_t spectrum_cache;                // 最近使用的两组参数对应的幅度谱 (约 2 KB)
+volatile uint8_t spectrum_cache_enabled = 1;    // 是否启用缓存
+volatile uint8_t spectrum_cache_clear_pending = 0; // 标志位，指示需要清空缓存
 
 // --- USB 缓冲区 ---
 char usb_tx_buffer[128];                   // 用于格式化输出的缓冲区
@@ -71,6 +232,168 @@ float adc_samples[ADC_BUFFER_SIZE]; // 存储生成的采样数据的数组
 complex_t fft_input_output[FFT_N];  // FFT 输入/输出缓冲区 (复数形式)
 float fft_magnitudes[FFT_N / 2];    // 存储 FFT 幅度结果的数组
 
+// --- GCC-PHAT 时延估计 ---
+volatile uint8_t gcc_request_pending = 0; // 标志位，指示是否需要执行一次时延估计
+volatile float gcc_test_delay = 0.0f;     // 模拟第二通道相对第一通道的时延 (采样点)
+
+// --- 自相关基音/周期检测 ---
+#define PITCH_YIN_THRESHOLD 0.15f               // CMNDF 绝对阈值
+volatile uint8_t pitch_request_pending = 0;   // 标志位，指示是否需要执行一次周期检测
+volatile float pitch_min_freq = 100.0f;       // 搜索的最低基频 (Hz)
+volatile float pitch_max_freq = 4000.0f;      // 搜索的最高基频 (Hz)
+
+// --- 频谱输出模式与倍频程频带分析 ---
+volatile spectrum_output_mode_t spectrum_output_mode = SPECTRUM_OUTPUT_BINS;
+volatile uint32_t octave_fraction = 3;                         // 请求的倍频程分数 (1, 3, 6)
+volatile freq_weighting_t octave_weighting = FREQ_WEIGHTING_Z; // 请求的频率计权
+octave_plan_t octave_plan;                                     // 频带计划 (参数变化时在主循环中惰性重建)
+float octave_levels_db[OCTAVE_MAX_BANDS];                      // 频带声级输出
+
+// --- 声级计 ---
+volatile uint32_t slm_report_interval_ms = 0; // 声级上报间隔 (ms)，0 表示关闭
+volatile uint8_t slm_reset_pending = 0;       // 标志位，指示需要重新初始化声级计
+level_meter_t level_meter;                    // 声级计状态
+
+// --- 二进制帧发送缓冲区 (上一帧发送完成前不能改写) ---
+extern USBD_HandleTypeDef hUsbDeviceFS; // 定义于 usb_device.c，用于查询发送状态
+uint8_t binary_tx_buffer[BINARY_FRAME_HEADER_SIZE + BINARY_FRAME_MAX_PAYLOAD + 1];
+uint8_t binary_frame_sequence = 0; // 帧序号，主机可据此检测丢帧
+
+// --- MFCC 特征 ---
+volatile uint8_t mfcc_config_pending = 0;  // 标志位，指示需要重建 MFCC 计划
+volatile uint32_t mfcc_num_coeffs = 13;    // 请求的 MFCC 系数个数
+volatile uint32_t mfcc_num_filters = 26;   // 请求的梅尔滤波器个数
+volatile float mfcc_f_low = 0.0f;          // 请求的下限频率 (Hz)
+volatile float mfcc_f_high = 8000.0f;      // 请求的上限频率 (Hz)
+mfcc_plan_t mfcc_plan;                     // 梅尔滤波器组和 DCT 计划
+float mfcc_mel_energies[MFCC_MAX_FILTERS]; // 梅尔滤波器对数能量 (工作缓冲区)
+float mfcc_coeffs[MFCC_MAX_COEFFS];        // MFCC 输出
+
+// --- 标量频谱描述符 ---
+static const float descriptor_band_edges_hz[SPECTRAL_NUM_BANDS - 1] = {500.0f, 2000.0f, 8000.0f}; // 频带能量比分界
+volatile uint8_t descriptor_config_pending = 0; // 标志位，指示需要重新初始化描述符引擎
+volatile float descriptor_rolloff = 0.85f;      // 滚降点能量比例
+spectral_state_t descriptor_state;              // 描述符引擎状态 (含上一帧幅度谱)
+
+// --- 包络谱分析 ---
+#define ENVELOPE_MOD_DEPTH 0.5f                 // 合成信号源下模拟故障信号的调制深度
+volatile uint8_t envelope_request_pending = 0;  // 标志位，指示是否需要执行一次包络谱分析
+volatile float envelope_mod_freq = 100.0f;      // 故障特征频率 (调制频率，Hz)
+volatile uint32_t envelope_decimation = 8;      // 包络抽取因子
+
+// --- 频谱估计方法与计时 ---
+volatile spectrum_estimator_t spectrum_estimator = SPECTRUM_ESTIMATOR_PERIODOGRAM;
+complex_t multitaper_eigen_store[MULTITAPER_EIGEN_STORE_SIZE]; // 多窗特征谱暂存区
+uint32_t last_estimator_cycles = 0;                            // 最近一次频谱估计消耗的 CPU 周期数
+
+// --- AR 参数谱估计 ---
+volatile uint32_t ar_order = 16;      // AR 模型阶数
+volatile uint32_t ar_frame_len = 256; // 参与估计的采样点数 (取 adc_samples 末尾)
+uint32_t ar_stage_cycles[2] = {0};    // 最近一次 AR 估计各阶段的 CPU 周期数: 模型估计, 谱网格
+
+// --- 离散小波分析引擎 ---
+volatile analysis_engine_t analysis_engine = ANALYSIS_ENGINE_FFT;
+volatile wavelet_type_t wavelet_type = WAVELET_DB4; // 小波类型
+volatile uint32_t wavelet_levels = 6;               // 请求的分解层数
+volatile float wavelet_threshold = 0.5f;            // 细节系数瞬态检测阈值
+
+// --- 常数 Q 变换 ---
+volatile uint32_t cqt_first_bin = 0;            // 输出的第一个 CQ 频点
+volatile uint32_t cqt_num_bins = CQT_NUM_BINS;  // 输出的 CQ 频点个数
+float cqt_magnitudes[CQT_NUM_BINS];             // CQ 频点幅度输出
+
+// --- 稀疏 FFT ---
+#define SPARSE_FFT_BUCKETS 256                // 哈希桶数 (工作区占 fft_input_output 的前 2 * 256 点)
+volatile uint32_t sparse_fft_size = 65536;    // 等效 FFT 点数
+volatile uint32_t sparse_fft_max_peaks = 4;   // 最多输出的峰值个数
+
+// --- 多相滤波器组信道化器 ---
+#define CHANNELIZER_BLOCKS_PER_FRAME (ADC_BUFFER_SIZE / CHANNELIZER_CHANNELS) // 每帧的抽取后输出个数
+volatile channelizer_output_t channelizer_output = CHANNELIZER_OUTPUT_POWER;
+volatile uint32_t channelizer_channel = 0;      // 复数输出模式下选定的信道
+volatile uint8_t channelizer_reset_pending = 1; // 标志位，指示需要清空信道化器历史
+channelizer_t channelizer;                      // 信道化器状态 (含 M * N 点输入历史)
+
+// --- 频谱基线与异常检测 ---
+#define ANOMALY_CLEAR_RATIO 0.8f // 评分低于阈值的该比例时结束异常事件 (迟滞)
+volatile anomaly_mode_t anomaly_mode = ANOMALY_MODE_OFF;
+volatile anomaly_metric_t anomaly_metric = ANOMALY_METRIC_MAX_Z;
+volatile float anomaly_threshold = 6.0f;       // 异常判定阈值 (z 分数)
+volatile uint32_t anomaly_learn_frames = 64;   // 学习的帧数，达到后自动保存并进入监测
+volatile uint8_t baseline_reset_pending = 0;   // 标志位，指示需要清空基线重新学习
+volatile uint8_t baseline_save_pending = 0;    // 标志位，指示需要把基线写入 Flash
+volatile uint8_t baseline_load_pending = 0;    // 标志位，指示需要从 Flash 读回基线
+spectral_baseline_t spectral_baseline;         // 逐频点基线 (约 4 KB，可整体写入 Flash)
+anomaly_score_t anomaly_score;                 // 最近一帧的评分
+uint8_t anomaly_event_active = 0;              // 当前是否处于异常事件中
+uint32_t anomaly_event_frames = 0;             // 当前事件已持续的帧数
+float anomaly_event_peak = 0.0f;               // 当前事件的最高评分
+
+// --- 频谱占用度统计 ---
+volatile uint8_t occupancy_running = 0;          // 是否正在累计 (累计期间连续出帧，不发送频谱)
+volatile uint8_t occupancy_reset_pending = 0;    // 标志位，指示需要清空统计重新开始
+volatile float occupancy_threshold_db = -60.0f;  // 占用判定门限 (dB)
+volatile uint8_t occupancy_report_pending = 0;   // 标志位，指示需要发送一次统计摘要
+volatile float occupancy_report_min_duty = 0.0f; // 摘要中只列出占空比不低于该值 (%) 的频点
+occupancy_t occupancy;                           // 各频点超门限计数与最大电平
+uint32_t occupancy_start_tick = 0;               // 开始累计的时刻 (ms)
+uint32_t occupancy_elapsed_ms = 0;               // 累计时长 (停止后保持不变)
+
+// --- 采样数据来源 ---
+#define ACQ_WAIT_MARGIN_MS 100                                    // 等待 ADC 块的超时余量 (在 2 个块周期之外)
+acquisition_t acquisition;                                        // ADC 循环 DMA 缓冲区与块计数 (约 4 KB)
+volatile acq_source_t acquisition_source = ACQ_SOURCE_SYNTHETIC;  // 当前数据来源
+volatile acq_source_t acquisition_request = ACQ_SOURCE_SYNTHETIC; // 请求切换到的数据来源
+volatile uint8_t acquisition_source_pending = 0;                  // 标志位，指示需要切换数据来源
+uint32_t acquisition_timeouts = 0;                                // 等待 ADC 块超时的次数
+
+// --- 多通道扫描 ---
+volatile scan_output_t scan_output = SCAN_OUTPUT_METRICS;
+volatile uint32_t scan_channels_request = 1; // 请求的扫描通道数
+volatile uint8_t scan_config_pending = 0;    // 标志位，指示需要重新配置 ADC 规则组
+uint32_t scan_channels = 1;                  // ADC 当前的扫描通道数 (只在主循环中修改)
+
+// --- 电平触发捕获 ---
+#define TRIGGER_RING ((float *)fft_input_output) // 预触发环形缓冲区 (2 * ADC_BUFFER_SIZE 个 float，布防期间借用)
+volatile trigger_state_t trigger_state = TRIGGER_STATE_OFF;
+volatile uint8_t trigger_config_pending = 0;               // 标志位，指示需要按新条件布防或关闭
+volatile trigger_type_t trigger_type_request = TRIGGER_EDGE_RISING; // 请求的触发条件
+volatile float trigger_level_request = 0.0f;               // 请求的触发电平 (V) 或斜率门限 (V/采样)
+volatile uint32_t trigger_pre_request = 0;                 // 请求的预触发采样数
+volatile uint8_t trigger_enable_request = 0;               // 1: 布防; 0: 关闭
+volatile uint8_t trigger_single = 0;                       // 1: 单次触发; 0: 捕获分析后自动重新布防
+trigger_t trigger;                                         // 触发检测状态
+uint32_t trigger_block = 0;                                // 布防以来写入环形缓冲区的块序号
+uint32_t trigger_event_block = 0;                          // 触发点所在块
+uint32_t trigger_event_index = 0;                          // 触发点在块内的下标
+uint32_t trigger_count = 0;                                // 已捕获的事件数
+uint32_t acquire_sequence = 0;                             // acquire_frame 和借用 fft_input_output 的次数 (检查触发历史是否连续)
+uint32_t trigger_last_sequence = 0;                        // 触发任务上一次取帧后的 acquire_sequence
+uint32_t trigger_last_adc_block = 0;                       // 触发任务上一次取到的 ADC 块序号
+uint32_t trigger_last_timeouts = 0;                        // 触发任务上一次取帧后的 ADC 超时次数
+
+// --- 频率模板触发 ---
+#define MASK_SAMPLE_LSB (ACQ_ADC_VREF / ACQ_ADC_FULL_SCALE) // 前一帧历史的量化步长 (1 个 ADC 码值，ADC 采样无损)
+#define MASK_POST_BLOCK ((float *)fft_input_output)        // 超限帧之后的一块 (比较完成后 fft_input_output 空闲)
+#define MASK_STATUS_INTERVAL_MS 1000                       // 监测期间发送通过/超限计数的间隔
+volatile uint8_t mask_running = 0;       // 是否正在监测 (监测期间连续出帧，不发送频谱)
+volatile uint8_t mask_single = 0;        // 1: 捕获一次事件后停止; 0: 恢复通过后重新布防
+volatile uint8_t mask_reset_pending = 0; // 标志位，指示需要清空计数重新开始
+volatile uint8_t mask_status_pending = 0; // 标志位，指示需要立即发送一次计数
+spectral_mask_t spectral_mask;           // 限值线 (每频点 1 字节编码)
+mask_result_t mask_result;               // 最近一帧的比较结果
+uint8_t mask_latched = 0;                // 当前处于超限中 (恢复通过之前不重复捕获)
+uint32_t mask_frames = 0;                // 已比较的帧数
+uint32_t mask_passed = 0;                // 通过的帧数
+uint32_t mask_failed = 0;                // 超限的帧数
+uint32_t mask_events = 0;                // 已捕获的事件数
+uint32_t mask_status_tick = 0;           // 上一次发送计数的时刻 (ms)
+int16_t mask_history[ADC_BUFFER_SIZE];   // 前一帧时域采样 (ADC 码值单位，2 KB)
+uint8_t mask_history_valid = 0;          // mask_history 中是否已有一帧
+uint32_t mask_history_sequence = 0;      // 保存历史时的 acquire_sequence
+uint32_t mask_history_adc_block = 0;     // 保存历史时的 ADC 块序号
+uint32_t mask_history_timeouts = 0;      // 保存历史时的 ADC 超时次数
+
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -80,6 +403,12 @@ void SystemClock_Config(void);
 void perform_fft_and_send(void);
 // 函数声明：处理接收到的 USB 数据 (将在 CDC_Receive_FS 中调用)
 void process_usb_data(uint8_t *Buf, uint32_t Len);
+// 函数声明：生成双通道模拟信号，执行 GCC-PHAT 并发送时延
+void perform_gcc_phat_and_send(void);
+// 函数声明：执行自相关周期检测并发送基频
+void perform_pitch_and_send(void);
+// 函数声明：取一帧采样，执行包络谱分析并发送结果
+void perform_envelope_and_send(void);
 /* USER CODE END PFP */
 
 /* Private user code ---------------------------------------------------------*/
@@ -90,23 +419,23 @@ void process_usb_data(uint8_t *Buf, uint32_t Len);
  * @param freq: 新频率
  * @param amp: 新幅度
  * @param offset: 新偏移
+ * @retval 1: 参数有效; 0: 频率超出 1 Hz ~ 奈奎斯特频率 (不含) 或幅度为负，参数保持不变
  */
-void Update_Signal_Parameters(float freq, float amp, float offset)
+uint8_t Update_Signal_Parameters(float freq, float amp, float offset)
 {
   // 添加参数验证和调试输出
   sprintf(usb_tx_buffer, "DEBUG-U: Params: F=%.2f, A=%.2f, O=%.2f\r\n", freq, amp, offset);
   CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
   
-  // 增加范围限制，防止无效值
-  if (freq >= 1.0f && freq <= (SAMPLING_FREQ / 2.0f))
-  {
-    current_signal_freq = freq;
-  }
-  if (amp >= 0.0f)
+  // 增加范围限制，防止无效值 (与 siggen_configure 一致，频率必须低于奈奎斯特频率)
+  if (freq < 1.0f || freq >= (sampling_freq / 2.0f) || amp < 0.0f)
   {
-    current_signal_amplitude = amp;
+    return 0;
   }
+  current_signal_freq = freq;
+  current_signal_amplitude = amp;
   current_signal_offset = offset;
+  return 1;
 }
 
 /**
@@ -130,144 +459,2993 @@ void Trigger_FFT_Recalculation(void)
 }
 
 /**
- * @brief 生成正弦波，执行 FFT 并通过 USB 发送结果
+ * @brief 启用 DWT 周期计数器，用于测量各算法消耗的 CPU 周期
  */
-void perform_fft_and_send(void)
+static void cycle_counter_init(void)
 {
-  // ... perform_fft_and_send 函数的实现保持不变 ...
-  // --- 1. 使用当前参数生成模拟正弦波信号 ---
-  // 读取 volatile 变量到局部变量，避免在循环中重复读取
-  float freq = current_signal_freq;
-  float amp = current_signal_amplitude;
-  float offset = current_signal_offset;
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
 
-  for (int i = 0; i < ADC_BUFFER_SIZE; i++)
+/**
+ * @brief 把新的 GEN 配置和当前 PARAM 参数合并到 generator_config
+ * @note 幅度和偏移取自 PARAM 命令；周期波形和调制载波的频率也取自 PARAM，扫频和多音使用 GEN 命令给出的频率
+ */
+static void apply_generator_parameters(void)
+{
+  if (generator_config_pending)
   {
-    adc_samples[i] = amp * sinf(2.0f * M_PI * freq * (float)i / SAMPLING_FREQ) + offset;
+    generator_config_pending = 0;
+    generator_config = generator_request;
   }
 
-  // --- 2. 准备 FFT 输入缓冲区 ---
-  for (int i = 0; i < FFT_N; i++)
+  siggen_waveform_t waveform = generator_config.waveform;
+  if (waveform != SIGGEN_MULTITONE && waveform != SIGGEN_CHIRP_LINEAR && waveform != SIGGEN_CHIRP_LOG)
   {
-    if (i < ADC_BUFFER_SIZE)
-    {
-      fft_input_output[i].real = adc_samples[i];
-    }
-    else
-    {
-      fft_input_output[i].real = 0.0f; // 零填充
-    }
-    fft_input_output[i].imag = 0.0f; // 虚部初始化为 0
+    generator_config.freq = current_signal_freq;
   }
+  generator_config.amplitude = current_signal_amplitude;
+  generator_config.offset = current_signal_offset;
+}
 
-  // --- 3. 执行 FFT 计算 ---
-  fft_radix2(fft_input_output, FFT_N);
+/**
+ * @brief 使用当前参数生成模拟正弦波信号
+ * @param buffer: 输出采样缓冲区
+ * @param len: 采样点数
+ */
+static void generate_test_signal(float *buffer, uint32_t len)
+{
+  apply_generator_parameters();
 
-  // --- 4. 计算 FFT 结果的幅度 ---
-  fft_calculate_magnitudes(fft_input_output, fft_magnitudes, FFT_N);
+  // 参数变化时保持当前相位，帧与帧之间波形连续；配置无效 (如 FM 频偏超出范围) 时沿用上一次的配置
+  siggen_configure(&test_generator, &generator_config, sampling_freq);
+  uint32_t start = DWT->CYCCNT;
+  siggen_generate(&test_generator, buffer, len);
+  generator_cycles = DWT->CYCCNT - start;
+}
 
-  // --- 5. 通过 USB VCP 发送 FFT 幅度结果 ---
-  sprintf(usb_tx_buffer, "--- FFT Magnitudes (F:%.1fHz A:%.2f O:%.2f) ---\r\n", freq, amp, offset);
-  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
-  HAL_Delay(10); // 短暂延时
+/**
+ * @brief 选择采样数据来源 (供 usbd_cdc_if 调用)，实际启停 ADC/DMA/定时器在主循环中进行
+ * @param use_adc: 1: ADC1 (PA0)，定时器触发 + 循环 DMA; 0: 软件信号发生器
+ */
+void Set_Acquisition_Source(uint8_t use_adc)
+{
+  acquisition_request = use_adc ? ACQ_SOURCE_ADC : ACQ_SOURCE_SYNTHETIC;
+  acquisition_source_pending = 1;
+}
 
-  for (uint32_t i = 0; i < FFT_N / 2; i++)
+/**
+ * @brief 启动 ADC 采集: TIM2 更新事件触发 ADC1 (扫描时为整个序列)，DMA 在 2 * block_len 的缓冲区上循环
+ * @retval 1: 成功; 0: 启动失败 (已回退并上报错误)
+ */
+static uint8_t acquisition_start(void)
+{
+  acquisition_reset(&acquisition, scan_channels);
+  if (ADC1_Start_DMA(acquisition.dma_buffer, 2 * acquisition.block_len) != HAL_OK)
   {
-    int len = sprintf(usb_tx_buffer, "FFT[%lu]: %.4f\r\n", i, fft_magnitudes[i]);
-    uint8_t result = CDC_Transmit_FS((uint8_t *)usb_tx_buffer, len);
-    if (result != USBD_OK)
+    sprintf(usb_tx_buffer, "ERR:ADC start failed\r\n");
+    CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+    return 0;
+  }
+  TIM2_Start();
+  return 1;
+}
+
+/**
+ * @brief 停止 ADC 采集 (先停触发源，再停 DMA)
+ */
+static void acquisition_stop(void)
+{
+  TIM2_Stop();
+  ADC1_Stop_DMA();
+}
+
+/**
+ * @brief 按请求启动或停止 ADC 采集
+ */
+static void acquisition_source_task(void)
+{
+  acq_source_t source = acquisition_request;
+  if (source == acquisition_source)
+  {
+    return;
+  }
+
+  if (source == ACQ_SOURCE_ADC)
+  {
+    if (!acquisition_start())
     {
-      HAL_Delay(1); // 发送失败时短暂延时
-                    // 可以添加重试逻辑或错误计数
+      return;
     }
-    HAL_Delay(2); // 每行之间短暂延时，防止发送过快
   }
+  else
+  {
+    acquisition_stop();
+  }
+  acquisition_source = source;
+  new_parameters_received = 1;
+}
 
-  sprintf(usb_tx_buffer, "--- FFT Transmission Complete ---\r\n");
-  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
-  HAL_Delay(10); // 发送完成后的短暂延时
+/**
+ * @brief 设置采样频率 (供 usbd_cdc_if 调用)，定时器分频和依赖采样频率的计划在主循环中更新
+ * @param rate: 请求的采样频率 (Hz)，实际频率取最接近的可实现值
+ * @retval 1: 参数有效; 0: 超出 [SAMPLING_FREQ_MIN, SAMPLING_FREQ_MAX]，或乘以扫描通道数后超出 ADC 转换速率
+ */
+uint8_t Set_Sample_Rate(float rate)
+{
+  if (!(rate >= SAMPLING_FREQ_MIN && rate <= SAMPLING_FREQ_MAX) ||
+      rate * (float)scan_channels > ACQ_ADC_MAX_CONVERSION_RATE)
+  {
+    return 0;
+  }
+  sample_rate_request = rate;
+  sample_rate_pending = 1;
+  return 1;
+}
 
-  // --- 6. (可选) 计算并发送峰值频率 ---
-  float max_magnitude = 0;
-  uint32_t max_index = 0;
-  for (uint32_t i = 1; i < FFT_N / 2; i++) // 忽略直流分量
+/**
+ * @brief 返回 TIM2 的计数时钟 (Hz)
+ * @note APB1 分频系数不为 1 时定时器时钟为 PCLK1 的 2 倍 (当前时钟树下为 84 MHz)
+ */
+static uint32_t sample_timer_clock(void)
+{
+  uint32_t pclk1 = HAL_RCC_GetPCLK1Freq();
+  return ((RCC->CFGR & RCC_CFGR_PPRE1) == RCC_HCLK_DIV1) ? pclk1 : 2u * pclk1;
+}
+
+/**
+ * @brief 应用新的采样频率: 重新设置 TIM2 分频 (ADC 运行时先停后启)，
+ *        依赖采样频率的频带计划、滤波器和统计在下一次使用时惰性重建
+ */
+static void sample_rate_task(void)
+{
+  sample_rate_pending = 0;
+  float requested = sample_rate_request;
+
+  // --- 1. 计算最接近的分频 (TIM2 为 32 位计数器) ---
+  uint32_t prescaler, period;
+  float actual = acquisition_timer_divider(sample_timer_clock(), requested, 0xFFFFFFFFu, &prescaler, &period);
+
+  // --- 2. 重新初始化 TIM2，ADC 运行时先停止，改完后清空乒乓状态重新启动 ---
+  uint8_t running = (acquisition_source == ACQ_SOURCE_ADC);
+  if (running)
   {
-    if (fft_magnitudes[i] > max_magnitude)
+    acquisition_stop();
+  }
+  TIM2_Config_Rate(prescaler, period);
+  if (running && !acquisition_start())
+  {
+    acquisition_source = ACQ_SOURCE_SYNTHETIC;
+    acquisition_request = ACQ_SOURCE_SYNTHETIC;
+  }
+  sampling_freq = actual;
+
+  // --- 3. 依赖采样频率的状态失效: 计划在下一次使用时重建，统计重新开始 ---
+  octave_plan.num_bands = 0;
+  mfcc_config_pending = 1;
+  if (mfcc_f_high > actual / 2.0f)
+  {
+    mfcc_f_high = actual / 2.0f; // MFCC 上限频率超过新的奈奎斯特频率时截到奈奎斯特频率
+    if (mfcc_f_low >= mfcc_f_high)
     {
-      max_magnitude = fft_magnitudes[i];
-      max_index = i;
+      mfcc_f_low = 0.0f;
     }
   }
-  float fundamental_frequency = (float)max_index * SAMPLING_FREQ / FFT_N;
-  sprintf(usb_tx_buffer, "Peak Frequency Index: %lu (%.2f Hz)\r\n", max_index, fundamental_frequency);
+  descriptor_config_pending = 1;
+  slm_reset_pending = 1;
+  channelizer_reset_pending = 1;
+  trigger_restart(&trigger);
+  if (occupancy_running)
+  {
+    occupancy_reset_pending = 1;
+  }
+  anomaly_mode = ANOMALY_MODE_OFF; // 基线按旧采样频率的频点学习，需重新学习
+  mask_running = 0;                // 限值线按旧采样频率的频点上传，需重新上传
+  if (current_signal_freq >= actual / 2.0f)
+  {
+    current_signal_freq = actual / 4.0f; // 测试信号频率超过新的奈奎斯特频率时移到频带中部
+  }
+  new_parameters_received = 1;
+
+  sprintf(usb_tx_buffer, "RATE: requested=%.2f actual=%.3f Hz (PSC=%lu ARR=%lu)\r\n",
+          requested, actual, prescaler, period);
   CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
   HAL_Delay(10);
 }
-/* USER CODE END 0 */
 
 /**
- * @brief  The application entry point.
- * @retval int
+ * @brief ADC DMA 半传输回调: 前一半写完，交给分析流水线
  */
-int main(void)
+void ADC1_ConvHalfCpltCallback(void)
 {
+  acquisition_block_complete(&acquisition, 0);
+}
 
-  /* USER CODE BEGIN 1 */
+/**
+ * @brief ADC DMA 传输完成回调: 后一半写完，交给分析流水线 (DMA 随即回到前一半继续写)
+ */
+void ADC1_ConvCpltCallback(void)
+{
+  acquisition_block_complete(&acquisition, 1);
+}
 
-  /* USER CODE END 1 */
+/**
+ * @brief 等待并取走 ADC 最近写完的一半
+ * @retval 指向该块码值的指针 (不复制)；等待超时 (ADC 未运行) 时返回 NULL
+ * @note 处理速度跟得上时依次取相邻的块，否则丢弃过期块并等待下一块。
+ */
+static const uint16_t *wait_for_block(void)
+{
+  acquisition_drop_stale(&acquisition);
+  // 超时按块周期缩放: 低采样频率下一个块可能需要数秒
+  uint32_t timeout_ms = (uint32_t)(2000.0f * (float)acquisition.frame_len / sampling_freq) + ACQ_WAIT_MARGIN_MS;
+  uint32_t start = HAL_GetTick();
+  const uint16_t *block;
+  while ((block = acquisition_take_block(&acquisition)) == NULL)
+  {
+    if (HAL_GetTick() - start > timeout_ms)
+    {
+      acquisition_timeouts++;
+      return NULL;
+    }
+    __WFI(); // 睡眠到下一个中断 (DMA 半传输/传输完成或 SysTick)，空等时不占用 CPU
+  }
+  return block;
+}
 
-  /* MCU Configuration--------------------------------------------------------*/
+/**
+ * @brief 取一帧采样写入 buffer: 软件信号发生器，或 ADC 最近写完的一半 (码值就地转换为电压，不经中间缓冲区)
+ * @param buffer: 输出采样缓冲区
+ * @param len: 采样点数 (<= ACQ_BLOCK_SIZE)
+ * @note 等待超时时输出全零；多通道扫描时只取通道 0 (frame_len 点)，其余补零。
+ */
+static void acquire_frame(float *buffer, uint32_t len)
+{
+  acquire_sequence++;
+  if (acquisition_source != ACQ_SOURCE_ADC)
+  {
+    generate_test_signal(buffer, len);
+    return;
+  }
 
-  /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
-  HAL_Init();
+  generator_cycles = 0;
+  const uint16_t *block = wait_for_block();
+  if (block == NULL)
+  {
+    memset(buffer, 0, len * sizeof(float));
+    return;
+  }
+  if (acquisition.channels == 1)
+  {
+    acquisition_convert(block, buffer, len);
+    return;
+  }
+  uint32_t frame_len = acquisition.frame_len;
+  acquisition_convert_channel(&acquisition, block, 0, buffer);
+  if (len > frame_len)
+  {
+    memset(&buffer[frame_len], 0, (len - frame_len) * sizeof(float));
+  }
+}
 
-  /* USER CODE BEGIN Init */
+/**
+ * @brief 不经 acquire_frame 改写 fft_input_output 的功能 (GCC、DDS 测试、扫频、冲激响应) 在开始时调用:
+ *        触发环形缓冲区借用的正是这块内存，按取过帧处理，触发任务据此判定历史断开并重新积累
+ */
+static void fft_workspace_claimed(void)
+{
+  acquire_sequence++;
+}
 
-  /* USER CODE END Init */
+/**
+ * @brief 选择测试信号波形 (供 usbd_cdc_if 调用)
+ * @param waveform: 'S' 正弦, 'Q' 方波, 'T' 三角波, 'W' 锯齿波 (频率取自 PARAM)；
+ *                  'C' 线性扫频, 'L' 对数扫频 (params: 起点 Hz, 终点 Hz, 时长 s)；
+ *                  'A' 调幅 (params: 调制频率 Hz, 调制深度 0~1), 'F' 调频 (params: 调制频率 Hz, 频偏 Hz)；
+ *                  'M' 多音 (params: 频率 Hz, 相对幅度 成对给出，最多 SIGGEN_MAX_TONES 对)；
+ *                  'N' 均匀白噪声, 'P' 粉红噪声, 'G' 高斯白噪声
+ * @param params: 参数数组
+ * @param count: 参数个数
+ * @retval 1: 参数有效; 0: 参数无效
+ */
+uint8_t Set_Signal_Generator(char waveform, const float *params, uint32_t count)
+{
+  siggen_config_t config = {0};
+  uint32_t needed = 0;
 
-  /* Configure the system clock */
-  SystemClock_Config();
+  switch (waveform)
+  {
+  case 'S':
+    config.waveform = SIGGEN_SINE;
+    break;
+  case 'Q':
+    config.waveform = SIGGEN_SQUARE;
+    break;
+  case 'T':
+    config.waveform = SIGGEN_TRIANGLE;
+    break;
+  case 'W':
+    config.waveform = SIGGEN_SAW;
+    break;
+  case 'C':
+  case 'L':
+    config.waveform = (waveform == 'C') ? SIGGEN_CHIRP_LINEAR : SIGGEN_CHIRP_LOG;
+    needed = 3;
+    break;
+  case 'A':
+  case 'F':
+    config.waveform = (waveform == 'A') ? SIGGEN_AM : SIGGEN_FM;
+    needed = 2;
+    break;
+  case 'M':
+    if (count < 2 || (count & 1u) != 0 || count > 2 * SIGGEN_MAX_TONES)
+    {
+      return 0;
+    }
+    config.waveform = SIGGEN_MULTITONE;
+    config.num_tones = count / 2;
+    for (uint32_t k = 0; k < config.num_tones; k++)
+    {
+      config.tone_freqs[k] = params[2 * k];
+      config.tone_amps[k] = params[2 * k + 1];
+    }
+    break;
+  case 'N':
+    config.waveform = SIGGEN_NOISE_WHITE;
+    break;
+  case 'P':
+    config.waveform = SIGGEN_NOISE_PINK;
+    break;
+  case 'G':
+    config.waveform = SIGGEN_NOISE_GAUSSIAN;
+    break;
+  default:
+    return 0;
+  }
+  if (count < needed)
+  {
+    return 0;
+  }
 
-  /* USER CODE BEGIN SysInit */
+  if (config.waveform == SIGGEN_CHIRP_LINEAR || config.waveform == SIGGEN_CHIRP_LOG)
+  {
+    config.freq = params[0];
+    config.freq2 = params[1];
+    config.sweep_time = params[2];
+  }
+  else
+  {
+    config.freq = current_signal_freq;
+    config.freq2 = (needed > 0) ? params[0] : 0.0f;
+    config.depth = (needed > 0) ? params[1] : 0.0f;
+  }
+  config.amplitude = current_signal_amplitude;
+  config.offset = current_signal_offset;
 
-  /* USER CODE END SysInit */
+  // 用临时发生器检查参数，避免无效配置进入主循环
+  siggen_t scratch;
+  siggen_init(&scratch, 0);
+  if (!siggen_configure(&scratch, &config, sampling_freq))
+  {
+    return 0;
+  }
+  generator_request = config;
+  generator_config_pending = 1;
+  new_parameters_received = 1;
+  return 1;
+}
 
-  /* Initialize all configured peripherals */
-  MX_GPIO_Init();
-  MX_USB_DEVICE_Init();
-  /* USER CODE BEGIN 2 */
-  HAL_Delay(3000); // 等我插上USB
+/**
+ * @brief 请求执行一次 DDS 与逐点 sinf 生成方式的对比测试 (供 usbd_cdc_if 调用)
+ */
+void Request_DDS_Benchmark(void)
+{
+  dds_benchmark_pending = 1;
+}
 
-  /* USER CODE END 2 */
+/**
+ * @brief 以当前频率分别用逐点 sinf 和 DDS 生成 ADC_BUFFER_SIZE 个采样，发送两者的周期数和最大差值
+ * @note 两路输出分别写入 fft_input_output 的前后两半 (按 float 使用)，不影响 adc_samples
+ */
+static void perform_dds_benchmark_and_send(void)
+{
+  fft_workspace_claimed();
+  float *reference = (float *)fft_input_output;
+  float *synthesized = reference + ADC_BUFFER_SIZE;
+  float freq = current_signal_freq;
+  float amp = current_signal_amplitude;
+  float offset = current_signal_offset;
 
-  /* Infinite loop */
-  /* USER CODE BEGIN WHILE */
-  while (1)
+  uint32_t start = DWT->CYCCNT;
+  for (uint32_t i = 0; i < ADC_BUFFER_SIZE; i++)
   {
-    // 每隔几秒发送一次当前参数状态，以便诊断
-    static uint32_t lastDebugTime = 0;
-    uint32_t currentTime = HAL_GetTick();
-    
-    if (currentTime - lastDebugTime > 3000) // 每3秒发送一次
-    {
-      lastDebugTime = currentTime;
-      sprintf(usb_tx_buffer, "DEBUG: Flag=%d, F=%.1f, A=%.2f, O=%.2f\r\n", 
-              (int)new_parameters_received,
-              current_signal_freq,
-              current_signal_amplitude,
-              current_signal_offset);
-      CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
-    }
-    
-    if (new_parameters_received)
+    reference[i] = amp * sinf(2.0f * M_PI * freq * (float)i / sampling_freq) + offset;
+  }
+  uint32_t sinf_cycles = DWT->CYCCNT - start;
+
+  dds_oscillator_t osc;
+  start = DWT->CYCCNT;
+  dds_init(&osc, freq, sampling_freq, amp, offset);
+  dds_generate(&osc, synthesized, ADC_BUFFER_SIZE);
+  uint32_t dds_cycles = DWT->CYCCNT - start;
+
+  float max_diff = 0.0f;
+  for (uint32_t i = 0; i < ADC_BUFFER_SIZE; i++)
+  {
+    float diff = fabsf(reference[i] - synthesized[i]);
+    if (diff > max_diff)
     {
-      new_parameters_received = 0;                // 清除标志位
-      perform_fft_and_send();                     // 执行 FFT 计算和发送
-      HAL_GPIO_TogglePin(LED_GPIO_Port, LED_Pin); // 切换 LED 状态，指示处理完成
+      max_diff = diff;
     }
+  }
 
-    // 主循环可以执行其他低优先级任务
-    HAL_Delay(10); // 短暂延时，降低 CPU 占用率，但会影响响应速度
+  sprintf(usb_tx_buffer, "--- DDS Benchmark (N=%d, F=%.1fHz) ---\r\n", ADC_BUFFER_SIZE, freq);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+  sprintf(usb_tx_buffer, "sinf: cycles=%lu (%.1f us, %.1f cycles/sample)\r\n", sinf_cycles,
+          (float)sinf_cycles * 1.0e6f / (float)SystemCoreClock, (float)sinf_cycles / ADC_BUFFER_SIZE);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+  sprintf(usb_tx_buffer, "DDS: cycles=%lu (%.1f us, %.1f cycles/sample)\r\n", dds_cycles,
+          (float)dds_cycles * 1.0e6f / (float)SystemCoreClock, (float)dds_cycles / ADC_BUFFER_SIZE);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+  sprintf(usb_tx_buffer, "DDS: speedup=%.1fx max_diff=%.2e\r\n",
+          (float)sinf_cycles / (float)(dds_cycles ? dds_cycles : 1), max_diff);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+}
+
+/**
+ * @brief 请求执行一次扫频测量 (供 usbd_cdc_if 调用)
+ * @param start_freq: 起始频率 (Hz)
+ * @param stop_freq: 终止频率 (Hz)，可小于起始频率 (向下扫)
+ * @param points: 频点数 (1 ~ SWEEP_MAX_POINTS)
+ * @param logarithmic: 1: 对数间隔; 0: 线性间隔
+ * @param dwell_ms: 每个频点切换频率后、测量前的稳定时间 (ms，<= 10000)
+ * @retval 1: 参数有效; 0: 频率超出 [2 个频点间隔, sampling_freq / 2) 或其他参数无效
+ */
+uint8_t Request_Frequency_Sweep(float start_freq, float stop_freq, uint32_t points, uint8_t logarithmic,
+                                uint32_t dwell_ms)
+{
+  float min_freq = SWEEP_MIN_BINS_PER_FRAME * sampling_freq / (float)ADC_BUFFER_SIZE;
+  float max_freq = sampling_freq / 2.0f;
+  if (start_freq < min_freq || start_freq >= max_freq || stop_freq < min_freq || stop_freq >= max_freq ||
+      points < 1 || points > SWEEP_MAX_POINTS || dwell_ms > 10000)
+  {
+    return 0;
+  }
+  sweep_start_freq = start_freq;
+  sweep_stop_freq = stop_freq;
+  sweep_points = points;
+  sweep_logarithmic = logarithmic ? 1 : 0;
+  sweep_dwell_ms = dwell_ms;
+  sweep_pending = 1;
+  return 1;
+}
+
+/**
+ * @brief 逐点切换激励频率并测量响应的幅度和相位，全部完成后一次性发送结果表
+ * @note 激励为 DDS 正弦 (频率切换时相位连续，与真实的步进扫频源一致)，稳定时间内的采样照常生成后丢弃；
+ *       相位以分析帧第一个采样处的激励相位为参考。结果暂存在 fft_input_output 中 (按 sweep_point_t 使用)。
+ *       测试信号直接作为响应，理想情况下各点为 0 dB、0 度，接入被测系统后即为其频率响应。
+ */
+static void perform_sweep_and_send(void)
+{
+  fft_workspace_claimed();
+  sweep_point_t *results = (sweep_point_t *)fft_input_output;
+  float start_freq = sweep_start_freq;
+  float stop_freq = sweep_stop_freq;
+  uint32_t points = sweep_points;
+  uint8_t logarithmic = sweep_logarithmic;
+  uint32_t dwell_samples = (uint32_t)((float)sweep_dwell_ms * sampling_freq / 1000.0f);
+  float amp = current_signal_amplitude;
+  float offset = current_signal_offset;
+  float amp_ref = (amp > 1e-12f) ? amp : 1e-12f;
+
+  dds_oscillator_t stimulus;
+  dds_init(&stimulus, start_freq, sampling_freq, amp, offset);
+
+  uint32_t start = DWT->CYCCNT;
+  for (uint32_t i = 0; i < points; i++)
+  {
+    float freq = sweep_frequency(start_freq, stop_freq, points, i, logarithmic);
+    dds_set(&stimulus, freq, sampling_freq, amp, offset);
+
+    // --- 1. 稳定时间: 激励持续输出，采样丢弃 ---
+    uint32_t remaining = dwell_samples;
+    while (remaining > 0)
+    {
+      uint32_t chunk = (remaining < ADC_BUFFER_SIZE) ? remaining : ADC_BUFFER_SIZE;
+      dds_generate(&stimulus, adc_samples, chunk);
+      remaining -= chunk;
+    }
+
+    // --- 2. 采集一帧并记录帧起点的激励相位 (正弦相位换算为余弦相位需减去 90 度) ---
+    float stimulus_phase = (float)stimulus.phase * (float)(2.0 * M_PI / 4294967296.0) - (float)(M_PI / 2.0);
+    dds_generate(&stimulus, adc_samples, ADC_BUFFER_SIZE);
+
+    // --- 3. 单频点相关测量，换算为相对激励的幅度和相位 ---
+    float response_amp, response_phase;
+    sweep_measure_tone(adc_samples, ADC_BUFFER_SIZE, freq, sampling_freq, &response_amp, &response_phase);
+    float phase_deg = (response_phase - stimulus_phase) * (float)(180.0 / M_PI);
+    phase_deg = fmodf(phase_deg, 360.0f);
+    if (phase_deg > 180.0f)
+    {
+      phase_deg -= 360.0f;
+    }
+    else if (phase_deg <= -180.0f)
+    {
+      phase_deg += 360.0f;
+    }
+
+    results[i].freq = freq;
+    results[i].magnitude_db = 20.0f * log10f((response_amp + 1e-12f) / amp_ref);
+    results[i].phase_deg = phase_deg;
+  }
+  uint32_t cycles = DWT->CYCCNT - start;
+
+  // --- 4. 发送结果表 ---
+  sprintf(usb_tx_buffer, "--- Sweep (%lu points, %.1f-%.1fHz, %s) ---\r\n", (unsigned long)points, start_freq,
+          stop_freq, logarithmic ? "log" : "lin");
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+  for (uint32_t i = 0; i < points; i++)
+  {
+    sprintf(usb_tx_buffer, "SWP: %.2f,%.3f,%.2f\r\n", results[i].freq, results[i].magnitude_db,
+            results[i].phase_deg);
+    if (CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer)) == USBD_OK)
+    {
+      HAL_Delay(2);
+    }
+    else
+    {
+      HAL_Delay(1);
+    }
+  }
+  sprintf(usb_tx_buffer, "Sweep: points=%lu cycles=%lu (%.1f us)\r\n", (unsigned long)points,
+          (unsigned long)cycles, (float)cycles * 1.0e6f / (float)SystemCoreClock);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+}
+
+/**
+ * @brief 请求执行一次冲激响应测量 (供 usbd_cdc_if 调用)
+ * @param method: 'M': MLS; 'E': 指数扫频
+ * @param taps: 回传的冲激响应点数 (1 ~ MLS_LENGTH)
+ * @param f_low: 指数扫频起始频率 (Hz，仅 'E' 使用)
+ * @param f_high: 指数扫频终止频率 (Hz，仅 'E' 使用)
+ * @retval 1: 参数有效; 0: 参数无效
+ */
+uint8_t Request_Impulse_Response(char method, uint32_t taps, float f_low, float f_high)
+{
+  if ((method != 'M' && method != 'E') || taps < 1 || taps > MLS_LENGTH)
+  {
+    return 0;
+  }
+  if (method == 'E')
+  {
+    float min_freq = 2.0f * sampling_freq / (float)FFT_N;
+    if (f_low < min_freq || f_high <= f_low || f_high >= sampling_freq / 2.0f)
+    {
+      return 0;
+    }
+    ir_sweep_low = f_low;
+    ir_sweep_high = f_high;
+  }
+  ir_method = method;
+  ir_taps = taps;
+  ir_request_pending = 1;
+  return 1;
+}
+
+/**
+ * @brief 生成激励、采集响应并反卷积，只发送冲激响应的前 ir_taps 点和峰值摘要
+ * @note MLS: 先输出一个周期使系统进入稳态，第二个周期作为测量帧，快速 Hadamard 变换求循环相关。
+ *       指数扫频: IR_SWEEP_LENGTH 点扫频后补零，激励和响应打包进一次复数 FFT 做正则化逆滤波。
+ *       测试信号直接作为响应，理想情况下为 (带限的) 单位冲激，接入被测系统后即为其冲激响应。
+ *       两种方法都只使用 adc_samples 和 fft_input_output。
+ */
+static void perform_impulse_response_and_send(void)
+{
+  char method = ir_method;
+  uint32_t taps = ir_taps;
+  float f_low = ir_sweep_low;
+  float f_high = ir_sweep_high;
+  float amp = (current_signal_amplitude > 0.0f) ? current_signal_amplitude : 1.0f;
+  uint32_t length;
+  uint32_t cycles;
+  fft_workspace_claimed();
+
+  if (method == 'M')
+  {
+    // --- 1. 预激励一个周期 (丢弃)，再采集一个完整周期 (合成源: 响应即激励) ---
+    uint32_t state = MLS_SEED;
+    ir_mls_generate(&state, adc_samples, MLS_LENGTH, amp);
+    ir_mls_generate(&state, adc_samples, MLS_LENGTH, amp);
+
+    // --- 2. 置换 + FWHT 反卷积，冲激响应写回 adc_samples ---
+    uint32_t start = DWT->CYCCNT;
+    ir_mls_deconvolve(adc_samples, (float *)fft_input_output, adc_samples, amp);
+    cycles = DWT->CYCCNT - start;
+    length = MLS_LENGTH;
+  }
+  else
+  {
+    // --- 1. 生成指数扫频并补零 (合成源: 响应即激励) ---
+    siggen_t sweep_source;
+    siggen_config_t config;
+    memset(&config, 0, sizeof(config));
+    config.waveform = SIGGEN_CHIRP_LOG;
+    config.freq = f_low;
+    config.freq2 = f_high;
+    config.sweep_time = (float)IR_SWEEP_LENGTH / sampling_freq;
+    config.amplitude = amp;
+    siggen_init(&sweep_source, 0);
+    siggen_configure(&sweep_source, &config, sampling_freq);
+    siggen_generate(&sweep_source, adc_samples, IR_SWEEP_LENGTH);
+    for (uint32_t i = 0; i < FFT_N; i++)
+    {
+      float stimulus = (i < IR_SWEEP_LENGTH) ? adc_samples[i] : 0.0f;
+      fft_input_output[i].real = stimulus;
+      fft_input_output[i].imag = stimulus;
+    }
+
+    // --- 2. 频域逆滤波，冲激响应写回 adc_samples ---
+    uint32_t start = DWT->CYCCNT;
+    ir_sweep_deconvolve(fft_input_output, FFT_N, f_low, f_high, sampling_freq);
+    cycles = DWT->CYCCNT - start;
+    for (uint32_t i = 0; i < FFT_N; i++)
+    {
+      adc_samples[i] = fft_input_output[i].real;
+    }
+    length = FFT_N;
+  }
+
+  uint32_t peak = 0;
+  for (uint32_t i = 1; i < length; i++)
+  {
+    if (fabsf(adc_samples[i]) > fabsf(adc_samples[peak]))
+    {
+      peak = i;
+    }
+  }
+
+  // --- 3. 发送结果 ---
+  if (method == 'M')
+  {
+    sprintf(usb_tx_buffer, "--- Impulse Response (MLS, N=%lu) ---\r\n", (unsigned long)MLS_LENGTH);
+  }
+  else
+  {
+    sprintf(usb_tx_buffer, "--- Impulse Response (ESS, %.1f-%.1fHz, N=%d) ---\r\n", f_low, f_high, FFT_N);
+  }
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+  for (uint32_t i = 0; i < taps && i < length; i++)
+  {
+    sprintf(usb_tx_buffer, "IR[%lu]: %.6f\r\n", (unsigned long)i, adc_samples[i]);
+    if (CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer)) == USBD_OK)
+    {
+      HAL_Delay(2);
+    }
+    else
+    {
+      HAL_Delay(1);
+    }
+  }
+  sprintf(usb_tx_buffer, "IR: peak=%lu (%.3f ms) level=%.2f dB cycles=%lu (%.1f us)\r\n", (unsigned long)peak,
+          (float)peak * 1000.0f / sampling_freq, 20.0f * log10f(fabsf(adc_samples[peak]) + 1e-12f),
+          (unsigned long)cycles, (float)cycles * 1.0e6f / (float)SystemCoreClock);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+}
+
+/**
+ * @brief 请求执行一次 GCC-PHAT 时延估计 (供 usbd_cdc_if 调用)
+ * @param delay_samples: 模拟第二通道的时延 (采样点，可为小数或负数)
+ * @retval 1: 参数有效; 0: 参数无效 (|时延| >= FFT_N / 4)
+ */
+uint8_t Request_GCC_PHAT(float delay_samples)
+{
+  if (delay_samples <= -(float)(FFT_N / 4) || delay_samples >= (float)(FFT_N / 4))
+  {
+    return 0;
+  }
+  gcc_test_delay = delay_samples;
+  gcc_request_pending = 1;
+  return 1;
+}
+
+/**
+ * @brief 时延估计用的宽带测试源: 当前正弦波参数 + 确定性伪随机噪声
+ * @param t: 采样时刻 (采样点，可为小数，小数部分线性插值)
+ * @retval 信号值
+ */
+static float gcc_test_source(float t, float freq, float amp)
+{
+  int32_t i = (int32_t)floorf(t);
+  float frac = t - (float)i;
+  // 以采样序号为种子的整数哈希，保证两通道看到的是同一段噪声
+  uint32_t h0 = (uint32_t)i * 2654435761u;
+  uint32_t h1 = (uint32_t)(i + 1) * 2654435761u;
+  h0 ^= h0 >> 13;
+  h1 ^= h1 >> 13;
+  float n0 = (float)(h0 & 0xFFFF) / 32768.0f - 1.0f;
+  float n1 = (float)(h1 & 0xFFFF) / 32768.0f - 1.0f;
+  float noise = n0 + (n1 - n0) * frac;
+  return amp * (sinf(2.0f * M_PI * freq * t / sampling_freq) + noise);
+}
+
+/**
+ * @brief 生成双通道模拟信号，执行 GCC-PHAT 并通过 USB 只发送时延和置信度
+ */
+void perform_gcc_phat_and_send(void)
+{
+  float freq = current_signal_freq;
+  float amp = current_signal_amplitude;
+  float delay = gcc_test_delay;
+  fft_workspace_claimed();
+
+  // adc_samples 前半部分作为通道 A，后半部分作为通道 B，不需要额外缓冲区
+  uint32_t len = ADC_BUFFER_SIZE / 2;
+  float *channel_a = &adc_samples[0];
+  float *channel_b = &adc_samples[len];
+  for (uint32_t i = 0; i < len; i++)
+  {
+    channel_a[i] = gcc_test_source((float)i + (float)(FFT_N / 4), freq, amp);
+    channel_b[i] = gcc_test_source((float)i + (float)(FFT_N / 4) - delay, freq, amp);
+  }
+
+  gcc_phat_result_t result;
+  gcc_phat_estimate(channel_a, channel_b, len, fft_input_output, FFT_N, FFT_N / 4, &result);
+
+  sprintf(usb_tx_buffer, "GCC: Lag=%.3f samples (%.2f us) Conf=%.3f\r\n",
+          result.lag_samples,
+          result.lag_samples * 1.0e6f / sampling_freq,
+          result.confidence);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+}
+
+/**
+ * @brief 请求执行一次自相关周期检测 (供 usbd_cdc_if 调用)
+ * @param min_freq: 搜索的最低基频 (Hz)
+ * @param max_freq: 搜索的最高基频 (Hz)
+ */
+void Request_Pitch_Detection(float min_freq, float max_freq)
+{
+  if (min_freq > 0.0f && max_freq > min_freq && max_freq <= (sampling_freq / 2.0f))
+  {
+    pitch_min_freq = min_freq;
+    pitch_max_freq = max_freq;
+    pitch_request_pending = 1;
+  }
+}
+
+/**
+ * @brief 对当前模拟信号执行自相关周期检测，只发送基频、周期和清晰度
+ */
+void perform_pitch_and_send(void)
+{
+  // 线性自相关需要 2 倍零填充，因此取 FFT_N / 2 个采样点
+  uint32_t len = FFT_N / 2;
+  acquire_frame(adc_samples, len);
+
+  pitch_result_t result;
+  pitch_detect_yin(adc_samples, len, fft_input_output, FFT_N, sampling_freq,
+                   pitch_min_freq, pitch_max_freq, PITCH_YIN_THRESHOLD, &result);
+
+  sprintf(usb_tx_buffer, "PITCH: F0=%.2f Hz Period=%.3f samples Clarity=%.3f\r\n",
+          result.frequency, result.period_samples, result.clarity);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+}
+
+/**
+ * @brief 逐个频点发送 FFT 幅度结果
+ * @param freq: 当前信号频率 (用于标题行)
+ * @param amp: 当前信号幅度 (用于标题行)
+ * @param offset: 当前信号偏移 (用于标题行)
+ */
+static void send_fft_magnitudes(float freq, float amp, float offset)
+{
+  // 标题行带上实际采样频率，上位机据此刻度频率轴
+  sprintf(usb_tx_buffer, "--- FFT Magnitudes (F:%.1fHz A:%.2f O:%.2f Fs:%.3fHz) ---\r\n", freq, amp, offset,
+          sampling_freq);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10); // 短暂延时
+
+  for (uint32_t i = 0; i < FFT_N / 2; i++)
+  {
+    int len = sprintf(usb_tx_buffer, "FFT[%lu]: %.4f\r\n", i, fft_magnitudes[i]);
+    uint8_t result = CDC_Transmit_FS((uint8_t *)usb_tx_buffer, len);
+    if (result != USBD_OK)
+    {
+      HAL_Delay(1); // 发送失败时短暂延时
+                    // 可以添加重试逻辑或错误计数
+    }
+    HAL_Delay(2); // 每行之间短暂延时，防止发送过快
+  }
+
+  sprintf(usb_tx_buffer, "--- FFT Transmission Complete ---\r\n");
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10); // 发送完成后的短暂延时
+}
+
+/**
+ * @brief 设置倍频程频带输出模式 (供 usbd_cdc_if 调用)
+ * @param fraction: 倍频程分数 1, 3, 6；0 表示恢复逐频点输出
+ * @param weighting: 计权字符 'A', 'C' 或 'Z'
+ * @retval 1: 参数有效; 0: 参数无效
+ */
+uint8_t Set_Octave_Mode(uint32_t fraction, char weighting)
+{
+  if (fraction == 0)
+  {
+    spectrum_output_mode = SPECTRUM_OUTPUT_BINS;
+    new_parameters_received = 1;
+    return 1;
+  }
+  if (fraction != 1 && fraction != 3 && fraction != 6)
+  {
+    return 0;
+  }
+
+  switch (weighting)
+  {
+  case 'A':
+  case 'a':
+    octave_weighting = FREQ_WEIGHTING_A;
+    break;
+  case 'C':
+  case 'c':
+    octave_weighting = FREQ_WEIGHTING_C;
+    break;
+  case 'Z':
+  case 'z':
+    octave_weighting = FREQ_WEIGHTING_Z;
+    break;
+  default:
+    return 0;
+  }
+  octave_fraction = fraction;
+  spectrum_output_mode = SPECTRUM_OUTPUT_OCTAVE;
+  new_parameters_received = 1; // 立即按新模式重新计算一次
+  return 1;
+}
+
+/**
+ * @brief 将 fft_magnitudes 聚合为倍频程频带声级并发送
+ */
+static void send_octave_bands(void)
+{
+  static const char weighting_names[] = {'Z', 'A', 'C'};
+
+  // 频带计划只在参数变化时重建
+  if (octave_plan.num_bands == 0 ||
+      octave_plan.fraction != octave_fraction ||
+      octave_plan.weighting != octave_weighting)
+  {
+    octave_plan_init(&octave_plan, FFT_N, sampling_freq, octave_fraction, octave_weighting);
+  }
+
+  octave_bands_compute(&octave_plan, fft_magnitudes, octave_levels_db);
+
+  sprintf(usb_tx_buffer, "--- Octave Bands (1/%lu, %c-weighted, %lu bands) ---\r\n",
+          octave_plan.fraction, weighting_names[octave_plan.weighting], octave_plan.num_bands);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+
+  for (uint32_t i = 0; i < octave_plan.num_bands; i++)
+  {
+    int len = sprintf(usb_tx_buffer, "OCT[%lu]: %.1f Hz %.2f dB\r\n",
+                      i, octave_plan.center_freq[i], octave_levels_db[i]);
+    if (CDC_Transmit_FS((uint8_t *)usb_tx_buffer, len) != USBD_OK)
+    {
+      HAL_Delay(1); // 发送失败时短暂延时
+    }
+    HAL_Delay(2);
+  }
+
+  sprintf(usb_tx_buffer, "--- Octave Transmission Complete ---\r\n");
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+}
+
+/**
+ * @brief 设置常数 Q 输出模式 (供 usbd_cdc_if 调用)
+ * @param f_low: 输出范围下限 (Hz)；f_low 和 f_high 均为 0 表示恢复逐频点输出
+ * @param f_high: 输出范围上限 (Hz)
+ * @retval 1: 参数有效; 0: 参数无效 (范围内没有 CQ 频点)
+ */
+uint8_t Set_CQT_Mode(float f_low, float f_high)
+{
+  if (f_low == 0.0f && f_high == 0.0f)
+  {
+    spectrum_output_mode = SPECTRUM_OUTPUT_BINS;
+    new_parameters_received = 1;
+    return 1;
+  }
+
+  // 频域核在 Flash 中固定，运行时只选择落在 [f_low, f_high] 内的 CQ 频点
+  // 核按 FFT 频点定义，中心频率随采样频率等比例缩放
+  float scale = sampling_freq / CQT_SAMPLE_RATE;
+  uint32_t first = CQT_NUM_BINS;
+  uint32_t count = 0;
+  for (uint32_t k = 0; k < CQT_NUM_BINS; k++)
+  {
+    float center = cqt_center_freqs[k] * scale;
+    if (center >= f_low && center <= f_high)
+    {
+      if (count == 0)
+      {
+        first = k;
+      }
+      count++;
+    }
+  }
+  if (count == 0)
+  {
+    return 0;
+  }
+
+  cqt_first_bin = first;
+  cqt_num_bins = count;
+  spectrum_output_mode = SPECTRUM_OUTPUT_CQT;
+  new_parameters_received = 1;
+  return 1;
+}
+
+/**
+ * @brief 由本帧 FFT 结果计算常数 Q 频点幅度并发送
+ */
+static void send_cqt_bins(void)
+{
+  // 多窗和 AR 估计会改写 fft_input_output，此时对原始采样重新做一次矩形窗 FFT
+  if (spectrum_estimator != SPECTRUM_ESTIMATOR_PERIODOGRAM)
+  {
+    for (uint32_t i = 0; i < FFT_N; i++)
+    {
+      fft_input_output[i].real = (i < ADC_BUFFER_SIZE) ? adc_samples[i] : 0.0f;
+      fft_input_output[i].imag = 0.0f;
+    }
+    fft_radix2(fft_input_output, FFT_N);
+  }
+
+  uint32_t first = cqt_first_bin;
+  uint32_t count = cqt_num_bins;
+  float scale = sampling_freq / CQT_SAMPLE_RATE; // 中心频率表按 CQT_SAMPLE_RATE 生成
+  cqt_compute(fft_input_output, first, count, cqt_magnitudes);
+
+  sprintf(usb_tx_buffer, "--- Constant-Q (%d bins/octave, %lu bins) ---\r\n", CQT_BINS_PER_OCTAVE, count);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+
+  for (uint32_t k = 0; k < count; k++)
+  {
+    int len = sprintf(usb_tx_buffer, "CQT[%lu]: %.1f Hz %.4f\r\n",
+                      first + k, cqt_center_freqs[first + k] * scale, cqt_magnitudes[k]);
+    if (CDC_Transmit_FS((uint8_t *)usb_tx_buffer, len) != USBD_OK)
+    {
+      HAL_Delay(1); // 发送失败时短暂延时
+    }
+    HAL_Delay(2);
+  }
+
+  sprintf(usb_tx_buffer, "--- CQT Transmission Complete ---\r\n");
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+}
+
+/**
+ * @brief 将时域采样装入 FFT 输入缓冲区 (不足 FFT_N 部分零填充)
+ *        声级计开启时，同一批采样同时更新声级计，不需要额外缓存
+ * @param samples: 时域采样数据
+ * @param len: 采样点数
+ */
+static void prepare_fft_input(const float *samples, uint32_t len)
+{
+  for (uint32_t i = 0; i < FFT_N; i++)
+  {
+    if (i < len)
+    {
+      fft_input_output[i].real = samples[i];
+    }
+    else
+    {
+      fft_input_output[i].real = 0.0f; // 零填充
+    }
+    fft_input_output[i].imag = 0.0f; // 虚部初始化为 0
+  }
+
+  if (slm_report_interval_ms > 0)
+  {
+    level_meter_process(&level_meter, samples, len);
+  }
+}
+
+/**
+ * @brief 设置声级计上报间隔 (供 usbd_cdc_if 调用)
+ * @param interval_ms: 上报间隔 (ms)，0 表示关闭声级计
+ */
+void Set_Level_Meter_Interval(uint32_t interval_ms)
+{
+  if (interval_ms > 0 && slm_report_interval_ms == 0)
+  {
+    slm_reset_pending = 1; // 从关闭到开启时重新开始积分
+  }
+  slm_report_interval_ms = interval_ms;
+}
+
+/**
+ * @brief 声级计周期任务: 持续驱动输入通路并按间隔上报声级
+ */
+static void level_meter_task(void)
+{
+  static uint32_t last_report_time = 0;
+
+  if (slm_reset_pending)
+  {
+    slm_reset_pending = 0;
+    level_meter_init(&level_meter, sampling_freq);
+    last_report_time = HAL_GetTick();
+  }
+
+  // ADC 采集或模拟信号持续驱动输入通路
+  acquire_frame(adc_samples, ADC_BUFFER_SIZE);
+  prepare_fft_input(adc_samples, ADC_BUFFER_SIZE);
+
+  uint32_t now = HAL_GetTick();
+  if (now - last_report_time >= slm_report_interval_ms)
+  {
+    last_report_time = now;
+    level_meter_result_t levels;
+    level_meter_read_and_reset(&level_meter, &levels);
+    sprintf(usb_tx_buffer, "SLM: Leq=%.2f Lmax=%.2f Lmin=%.2f F=%.2f S=%.2f I=%.2f dB\r\n",
+            levels.leq, levels.lmax, levels.lmin, levels.fast, levels.slow, levels.impulse);
+    CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  }
+}
+
+/**
+ * @brief 判断输出模式是否为二进制帧 (二进制模式连续出帧，且不夹杂文本行)
+ */
+static uint8_t output_mode_is_binary(spectrum_output_mode_t mode)
+{
+  return (mode == SPECTRUM_OUTPUT_MFCC || mode == SPECTRUM_OUTPUT_DESCRIPTORS);
+}
+
+/**
+ * @brief 当前是否连续出帧 (二进制输出模式、小波引擎、异常检测、占用度统计或频率模板监测)
+ */
+static uint8_t streaming_is_active(void)
+{
+  return output_mode_is_binary(spectrum_output_mode) || analysis_engine == ANALYSIS_ENGINE_WAVELET ||
+         anomaly_mode != ANOMALY_MODE_OFF || occupancy_running || mask_running ||
+         (analysis_engine == ANALYSIS_ENGINE_SCAN && scan_output == SCAN_OUTPUT_METRICS);
+}
+
+/**
+ * @brief 发送一个二进制帧
+ *        帧格式: 0xA5 0x5A | 类型 | 序号 | 载荷长度 (uint16 小端) | 载荷 | 校验和
+ *        校验和为类型到载荷末尾所有字节之和的低 8 位
+ * @param type: 帧类型 (binary_frame_type_t)
+ * @param payload: 载荷数据 (小端，float 为 IEEE-754)
+ * @param len: 载荷字节数 (<= BINARY_FRAME_MAX_PAYLOAD)
+ */
+static void send_binary_frame(uint8_t type, const void *payload, uint16_t len)
+{
+  if (len > BINARY_FRAME_MAX_PAYLOAD)
+  {
+    return;
+  }
+
+  // 等待上一帧发送完成后再改写发送缓冲区
+  USBD_CDC_HandleTypeDef *hcdc = (USBD_CDC_HandleTypeDef *)hUsbDeviceFS.pClassData;
+  uint32_t start = HAL_GetTick();
+  while (hcdc != NULL && hcdc->TxState != 0)
+  {
+    if (HAL_GetTick() - start > BINARY_FRAME_TX_TIMEOUT_MS)
+    {
+      return; // 主机未读取，丢弃本帧
+    }
+  }
+
+  binary_tx_buffer[0] = BINARY_FRAME_SYNC0;
+  binary_tx_buffer[1] = BINARY_FRAME_SYNC1;
+  binary_tx_buffer[2] = type;
+  binary_tx_buffer[3] = binary_frame_sequence++;
+  binary_tx_buffer[4] = (uint8_t)(len & 0xFF);
+  binary_tx_buffer[5] = (uint8_t)(len >> 8);
+  memcpy(&binary_tx_buffer[BINARY_FRAME_HEADER_SIZE], payload, len);
+
+  uint8_t checksum = 0;
+  for (uint32_t i = 2; i < (uint32_t)BINARY_FRAME_HEADER_SIZE + len; i++)
+  {
+    checksum += binary_tx_buffer[i];
+  }
+  binary_tx_buffer[BINARY_FRAME_HEADER_SIZE + len] = checksum;
+
+  CDC_Transmit_FS(binary_tx_buffer, BINARY_FRAME_HEADER_SIZE + len + 1);
+}
+
+/**
+ * @brief 设置 MFCC 二进制输出模式 (供 usbd_cdc_if 调用)
+ * @param num_coeffs: MFCC 系数个数，0 表示恢复逐频点输出
+ * @param num_filters: 梅尔滤波器个数
+ * @param f_low: 下限频率 (Hz)
+ * @param f_high: 上限频率 (Hz)
+ * @retval 1: 参数有效; 0: 参数无效
+ */
+uint8_t Set_MFCC_Mode(uint32_t num_coeffs, uint32_t num_filters, float f_low, float f_high)
+{
+  if (num_coeffs == 0)
+  {
+    spectrum_output_mode = SPECTRUM_OUTPUT_BINS;
+    return 1;
+  }
+  if (num_filters < 2 || num_filters > MFCC_MAX_FILTERS ||
+      num_coeffs > num_filters || num_coeffs > MFCC_MAX_COEFFS ||
+      f_low < 0.0f || f_high <= f_low || f_high > (sampling_freq / 2.0f))
+  {
+    return 0;
+  }
+
+  mfcc_num_coeffs = num_coeffs;
+  mfcc_num_filters = num_filters;
+  mfcc_f_low = f_low;
+  mfcc_f_high = f_high;
+  mfcc_config_pending = 1; // 计划在主循环中重建，避免在中断中做大量计算
+  spectrum_output_mode = SPECTRUM_OUTPUT_MFCC;
+  return 1;
+}
+
+/**
+ * @brief 由 fft_magnitudes 计算 MFCC 并发送一个二进制帧
+ */
+static void send_mfcc_frame(void)
+{
+  if (mfcc_config_pending || mfcc_plan.num_filters == 0)
+  {
+    mfcc_config_pending = 0;
+    if (!mfcc_plan_init(&mfcc_plan, FFT_N, sampling_freq, mfcc_num_filters, mfcc_num_coeffs,
+                        mfcc_f_low, mfcc_f_high))
+    {
+      // 旧计划的滤波器频点按旧参数建立，不能继续使用: 恢复逐频点输出并报错
+      mfcc_plan.num_filters = 0;
+      spectrum_output_mode = SPECTRUM_OUTPUT_BINS;
+      sprintf(usb_tx_buffer, "ERR:MFCC plan invalid (%.1f ~ %.1f Hz at Fs %.1f Hz), back to bins\r\n",
+              mfcc_f_low, mfcc_f_high, sampling_freq);
+      CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+      HAL_Delay(10);
+      return;
+    }
+  }
+
+  mfcc_compute(&mfcc_plan, fft_magnitudes, mfcc_mel_energies, mfcc_coeffs);
+  send_binary_frame(BINARY_FRAME_MFCC, mfcc_coeffs, (uint16_t)(mfcc_plan.num_coeffs * sizeof(float)));
+}
+
+/**
+ * @brief 设置频谱描述符二进制输出模式 (供 usbd_cdc_if 调用)
+ * @param rolloff_fraction: 滚降点能量比例 (0 ~ 1)，0 表示恢复逐频点输出
+ * @retval 1: 参数有效; 0: 参数无效
+ */
+uint8_t Set_Descriptor_Mode(float rolloff_fraction)
+{
+  if (rolloff_fraction == 0.0f)
+  {
+    spectrum_output_mode = SPECTRUM_OUTPUT_BINS;
+    return 1;
+  }
+  if (rolloff_fraction < 0.0f || rolloff_fraction >= 1.0f)
+  {
+    return 0;
+  }
+
+  descriptor_rolloff = rolloff_fraction;
+  descriptor_config_pending = 1; // 重新开始，第一帧通量为 0
+  spectrum_output_mode = SPECTRUM_OUTPUT_DESCRIPTORS;
+  return 1;
+}
+
+/**
+ * @brief 由 fft_magnitudes 计算频谱描述符并发送一个二进制帧
+ */
+static void send_descriptor_frame(void)
+{
+  if (descriptor_config_pending)
+  {
+    descriptor_config_pending = 0;
+    spectral_descriptors_init(&descriptor_state, FFT_N, sampling_freq,
+                              descriptor_rolloff, descriptor_band_edges_hz);
+  }
+
+  spectral_descriptors_t descriptors;
+  spectral_descriptors_compute(&descriptor_state, fft_magnitudes, &descriptors);
+  send_binary_frame(BINARY_FRAME_DESCRIPTORS, &descriptors, sizeof(descriptors));
+}
+
+/**
+ * @brief 请求执行一次包络谱分析 (供 usbd_cdc_if 调用)
+ * @param mod_freq: 故障特征频率 (Hz)；合成信号源下分析的一帧为以当前频率为载波、按此频率调制的调幅信号
+ * @param decimation: 包络抽取因子 (2 的幂)
+ * @retval 1: 参数有效; 0: 参数无效
+ */
+uint8_t Request_Envelope_Spectrum(float mod_freq, uint32_t decimation)
+{
+  if (decimation == 0 || (decimation & (decimation - 1)) != 0 || decimation > FFT_N / 4 ||
+      mod_freq <= 0.0f || mod_freq >= sampling_freq / (2.0f * (float)decimation))
+  {
+    return 0; // 调制频率必须低于抽取后的奈奎斯特频率
+  }
+  envelope_mod_freq = mod_freq;
+  envelope_decimation = decimation;
+  envelope_request_pending = 1;
+  return 1;
+}
+
+/**
+ * @brief 取一帧采样 (ADC 或信号发生器的调幅信号，模拟轴承故障冲击调制)，
+ *        执行包络谱分析，只发送包络谱和峰值
+ */
+void perform_envelope_and_send(void)
+{
+  float mod_freq = envelope_mod_freq;
+  uint32_t decimation = envelope_decimation;
+
+  // 合成信号源: 只在这一帧把信号发生器切换为调幅 (等同 GEN:A,<调制频率>,0.5)，取帧后恢复原来的配置
+  uint8_t synthetic = (acquisition_source != ACQ_SOURCE_ADC);
+  siggen_config_t saved_config = generator_config;
+  if (synthetic)
+  {
+    apply_generator_parameters(); // 先合并挂起的 GEN 请求，恢复时不会丢失
+    saved_config = generator_config;
+    generator_config.waveform = SIGGEN_AM;
+    generator_config.freq2 = mod_freq;
+    generator_config.depth = ENVELOPE_MOD_DEPTH;
+  }
+  acquire_frame(adc_samples, ADC_BUFFER_SIZE);
+  if (synthetic)
+  {
+    generator_config = saved_config; // 下一次取帧时 siggen_configure 按原配置继续 (相位连续)
+  }
+  prepare_fft_input(adc_samples, ADC_BUFFER_SIZE);
+
+  // 包络谱复用 fft_input_output 和 fft_magnitudes，不占用额外内存
+  uint32_t num_bins = envelope_spectrum(fft_input_output, FFT_N, decimation, fft_magnitudes);
+  float bin_spacing = sampling_freq / FFT_N;
+
+  sprintf(usb_tx_buffer, "--- Envelope Spectrum (Fm:%.1fHz D:%lu, %lu bins) ---\r\n",
+          mod_freq, decimation, num_bins);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+
+  float max_magnitude = 0.0f;
+  uint32_t max_index = 0;
+  for (uint32_t i = 0; i < num_bins; i++)
+  {
+    if (i > 0 && fft_magnitudes[i] > max_magnitude)
+    {
+      max_magnitude = fft_magnitudes[i];
+      max_index = i;
+    }
+    int len = sprintf(usb_tx_buffer, "ENV[%lu]: %.2f Hz %.4f\r\n", i, (float)i * bin_spacing, fft_magnitudes[i]);
+    if (CDC_Transmit_FS((uint8_t *)usb_tx_buffer, len) != USBD_OK)
+    {
+      HAL_Delay(1); // 发送失败时短暂延时
+    }
+    HAL_Delay(2);
+  }
+
+  sprintf(usb_tx_buffer, "--- Envelope Transmission Complete ---\r\n");
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+
+  sprintf(usb_tx_buffer, "Envelope Peak: %.2f Hz (%.4f)\r\n", (float)max_index * bin_spacing, max_magnitude);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+}
+
+/**
+ * @brief 选择频谱估计方法 (供 usbd_cdc_if 调用)
+ * @param estimator: 0 周期图, 1 多窗等权, 2 多窗自适应, 3 AR (使用当前阶数和帧长)
+ * @retval 1: 参数有效; 0: 参数无效
+ */
+uint8_t Set_Spectrum_Estimator(uint32_t estimator)
+{
+  if (estimator > SPECTRUM_ESTIMATOR_AR)
+  {
+    return 0;
+  }
+  spectrum_estimator = (spectrum_estimator_t)estimator;
+  new_parameters_received = 1; // 立即用新方法重新计算一次
+  return 1;
+}
+
+/**
+ * @brief 选择 AR 参数谱估计并设置模型参数 (供 usbd_cdc_if 调用)
+ * @param order: 模型阶数 (1 ~ AR_MAX_ORDER)
+ * @param frame_len: 参与估计的采样点数 (order < frame_len <= FFT_N / 2)
+ * @retval 1: 参数有效; 0: 参数无效
+ */
+uint8_t Set_AR_Estimator(uint32_t order, uint32_t frame_len)
+{
+  if (order == 0 || order > AR_MAX_ORDER || frame_len <= order || frame_len > FFT_N / 2)
+  {
+    return 0;
+  }
+  ar_order = order;
+  ar_frame_len = frame_len;
+  return Set_Spectrum_Estimator(SPECTRUM_ESTIMATOR_AR);
+}
+
+/**
+ * @brief AR 参数谱估计: 由 adc_samples 末尾 ar_frame_len 个采样求模型，在 FFT_N 点网格上求谱
+ * @note 分阶段记录周期数到 ar_stage_cycles；模型估计失败 (如全零输入) 时输出全零谱
+ */
+static void estimate_ar_spectrum(void)
+{
+  ar_model_t model;
+  uint32_t len = ar_frame_len;
+  uint32_t stage_start = DWT->CYCCNT;
+
+  uint8_t ok = ar_estimate(&adc_samples[ADC_BUFFER_SIZE - len], len, ar_order,
+                           fft_input_output, FFT_N, &model);
+  uint32_t model_done = DWT->CYCCNT;
+
+  if (ok)
+  {
+    ar_spectrum(&model, fft_input_output, FFT_N, fft_magnitudes);
+  }
+  else
+  {
+    memset(fft_magnitudes, 0, sizeof(fft_magnitudes));
+  }
+  uint32_t grid_done = DWT->CYCCNT;
+
+  ar_stage_cycles[0] = model_done - stage_start;
+  ar_stage_cycles[1] = grid_done - model_done;
+}
+
+/**
+ * @brief 选择离散小波分析引擎 (供 usbd_cdc_if 调用)
+ * @param levels: 分解层数 (1 ~ WAVELET_MAX_LEVELS)；0 表示切回 FFT 引擎
+ * @param wavelet: 小波类型字符 'H' (Haar), 'D' (Daubechies-4) 或 'C' (CDF 9/7)
+ * @param threshold: 细节系数瞬态检测阈值 (> 0)
+ * @retval 1: 参数有效; 0: 参数无效，或频率模板监测正在运行
+ */
+uint8_t Set_Wavelet_Engine(uint32_t levels, char wavelet, float threshold)
+{
+  if (levels == 0)
+  {
+    analysis_engine = ANALYSIS_ENGINE_FFT;
+    new_parameters_received = 1;
+    return 1;
+  }
+  if (levels > WAVELET_MAX_LEVELS || threshold <= 0.0f || mask_running)
+  {
+    return 0;
+  }
+
+  switch (wavelet)
+  {
+  case 'H':
+  case 'h':
+    wavelet_type = WAVELET_HAAR;
+    break;
+  case 'D':
+  case 'd':
+    wavelet_type = WAVELET_DB4;
+    break;
+  case 'C':
+  case 'c':
+    wavelet_type = WAVELET_CDF97;
+    break;
+  default:
+    return 0;
+  }
+  wavelet_levels = levels;
+  wavelet_threshold = threshold;
+  analysis_engine = ANALYSIS_ENGINE_WAVELET;
+  return 1;
+}
+
+/**
+ * @brief 在 adc_samples 上原地执行小波变换，发送各层能量、峰值和瞬态计数
+ */
+static void perform_wavelet_and_send(void)
+{
+  wavelet_frame_t frame;
+  uint32_t start = DWT->CYCCNT;
+
+  frame.levels = wavelet_forward(adc_samples, ADC_BUFFER_SIZE, wavelet_type, wavelet_levels);
+  wavelet_analyze(adc_samples, ADC_BUFFER_SIZE, frame.levels, wavelet_threshold, frame.stats);
+
+  frame.cycles = DWT->CYCCNT - start;
+  send_binary_frame(BINARY_FRAME_WAVELET, &frame,
+                    2 * sizeof(uint32_t) + (frame.levels + 1) * sizeof(wavelet_level_stats_t));
+}
+
+/**
+ * @brief 选择稀疏 FFT 引擎 (供 usbd_cdc_if 调用)
+ * @param n_eff: 等效 FFT 点数 (2 的幂，4096 ~ 65536)；0 表示切回 FFT 引擎
+ * @param max_peaks: 最多输出的峰值个数 (1 ~ SPARSE_FFT_MAX_PEAKS)
+ * @retval 1: 参数有效; 0: 参数无效，或触发模式、频率模板监测已打开 (稀疏 FFT 引擎不分析捕获帧)
+ */
+uint8_t Set_Sparse_FFT_Mode(uint32_t n_eff, uint32_t max_peaks)
+{
+  if (n_eff == 0)
+  {
+    analysis_engine = ANALYSIS_ENGINE_FFT;
+    new_parameters_received = 1;
+    return 1;
+  }
+  if (n_eff < 4096 || n_eff > 65536 || (n_eff & (n_eff - 1)) != 0 ||
+      max_peaks == 0 || max_peaks > SPARSE_FFT_MAX_PEAKS || trigger_enable_request || mask_running)
+  {
+    return 0;
+  }
+  sparse_fft_size = n_eff;
+  sparse_fft_max_peaks = max_peaks;
+  analysis_engine = ANALYSIS_ENGINE_SPARSE_FFT;
+  new_parameters_received = 1;
+  return 1;
+}
+
+/**
+ * @brief 用当前信号参数初始化按下标取样的测试信号
+ */
+static void indexed_signal_init(indexed_signal_t *signal)
+{
+  signal->phase_step = dds_phase_step(current_signal_freq, sampling_freq);
+  signal->amplitude = current_signal_amplitude;
+  signal->offset = current_signal_offset;
+  signal->reads = 0;
+}
+
+/**
+ * @brief 按下标直接计算测试信号的一个采样
+ * @note 相位用 32 位整数累加，下标达到数万点时也不会损失相位精度
+ */
+static float indexed_signal_sample(uint32_t n, void *context)
+{
+  indexed_signal_t *signal = (indexed_signal_t *)context;
+  signal->reads++;
+  uint32_t phase = signal->phase_step * n; // 按 2^32 自然回绕
+  return signal->amplitude * dds_sin(phase) + signal->offset;
+}
+
+/**
+ * @brief 以 sparse_fft_size 点的分辨率恢复测试信号的主要频率分量并发送峰值列表
+ */
+static void perform_sparse_fft_and_send(void)
+{
+  indexed_signal_t signal;
+  indexed_signal_init(&signal);
+
+  uint32_t n_eff = sparse_fft_size;
+  sparse_fft_peak_t peaks[SPARSE_FFT_MAX_PEAKS];
+  uint32_t start = DWT->CYCCNT;
+  uint32_t count = sparse_fft_find_peaks(indexed_signal_sample, &signal, n_eff, SPARSE_FFT_BUCKETS,
+                                         fft_input_output, sparse_fft_max_peaks, peaks);
+  uint32_t cycles = DWT->CYCCNT - start;
+
+  sprintf(usb_tx_buffer, "--- Sparse FFT (N=%lu, %.3f Hz/bin) ---\r\n", n_eff, sampling_freq / (float)n_eff);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+
+  for (uint32_t i = 0; i < count; i++)
+  {
+    sprintf(usb_tx_buffer, "SFFT[%lu]: %.3f Hz %.4f\r\n", i, peaks[i].frequency * sampling_freq, peaks[i].amplitude);
+    CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+    HAL_Delay(10);
+  }
+
+  sprintf(usb_tx_buffer, "Sparse FFT: peaks=%lu samples=%lu cycles=%lu (%.1f us)\r\n",
+          count, signal.reads, cycles, (float)cycles * 1.0e6f / (float)SystemCoreClock);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+}
+
+/**
+ * @brief 选择多相滤波器组信道化器引擎 (供 usbd_cdc_if 调用)
+ * @param mode: 'P' 输出各信道功率，'C' 输出选定信道的复数样本；'0' 切回 FFT 引擎
+ * @param channel: 复数输出模式下的信道号 (0 ~ CHANNELIZER_CHANNELS / 2)
+ * @retval 1: 参数有效; 0: 参数无效，或触发模式、频率模板监测已打开 (信道化器引擎不分析捕获帧)
+ */
+uint8_t Set_Channelizer_Mode(char mode, uint32_t channel)
+{
+  switch (mode)
+  {
+  case '0':
+    analysis_engine = ANALYSIS_ENGINE_FFT;
+    new_parameters_received = 1;
+    return 1;
+  case 'P':
+  case 'p':
+    channelizer_output = CHANNELIZER_OUTPUT_POWER;
+    break;
+  case 'C':
+  case 'c':
+    if (channel > CHANNELIZER_CHANNELS / 2)
+    {
+      return 0;
+    }
+    channelizer_channel = channel;
+    channelizer_output = CHANNELIZER_OUTPUT_COMPLEX;
+    break;
+  default:
+    return 0;
+  }
+  if (trigger_enable_request || mask_running)
+  {
+    return 0;
+  }
+  if (analysis_engine != ANALYSIS_ENGINE_CHANNELIZER)
+  {
+    channelizer_reset_pending = 1;
+  }
+  analysis_engine = ANALYSIS_ENGINE_CHANNELIZER;
+  new_parameters_received = 1;
+  return 1;
+}
+
+/**
+ * @brief 一帧采样经多相滤波器组得到 CHANNELIZER_BLOCKS_PER_FRAME 组信道输出，发送功率或复数样本
+ */
+static void perform_channelizer_and_send(void)
+{
+  const uint32_t n = CHANNELIZER_CHANNELS;
+
+  // 首次进入时清空历史并先灌入一帧，避免输出包含零历史造成的过渡过程
+  if (channelizer_reset_pending)
+  {
+    channelizer_reset_pending = 0;
+    channelizer_init(&channelizer);
+    acquire_frame(adc_samples, ADC_BUFFER_SIZE);
+    for (uint32_t b = 0; b < CHANNELIZER_BLOCKS_PER_FRAME; b++)
+    {
+      channelizer_process(&channelizer, &adc_samples[b * n], fft_input_output);
+    }
+  }
+
+  acquire_frame(adc_samples, ADC_BUFFER_SIZE);
+
+  // 功率累加复用 fft_magnitudes，复数样本直接保存在栈上 (每帧只有几个)
+  complex_t channel_samples[CHANNELIZER_BLOCKS_PER_FRAME];
+  uint32_t channel = channelizer_channel;
+  for (uint32_t k = 0; k <= n / 2; k++)
+  {
+    fft_magnitudes[k] = 0.0f;
+  }
+
+  uint32_t start = DWT->CYCCNT;
+  for (uint32_t b = 0; b < CHANNELIZER_BLOCKS_PER_FRAME; b++)
+  {
+    channelizer_process(&channelizer, &adc_samples[b * n], fft_input_output);
+    for (uint32_t k = 0; k <= n / 2; k++)
+    {
+      fft_magnitudes[k] += fft_input_output[k].real * fft_input_output[k].real +
+                           fft_input_output[k].imag * fft_input_output[k].imag;
+    }
+    channel_samples[b] = fft_input_output[channel];
+  }
+  uint32_t cycles = (DWT->CYCCNT - start) / CHANNELIZER_BLOCKS_PER_FRAME;
+
+  float spacing = sampling_freq / (float)n;
+  if (channelizer_output == CHANNELIZER_OUTPUT_COMPLEX)
+  {
+    sprintf(usb_tx_buffer, "--- Channelizer ch %lu (%.1f Hz, %.1f samples/s) ---\r\n",
+            channel, (float)channel * spacing, spacing);
+    CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+    HAL_Delay(10);
+    for (uint32_t b = 0; b < CHANNELIZER_BLOCKS_PER_FRAME; b++)
+    {
+      sprintf(usb_tx_buffer, "PFBC[%lu]: %.6f %.6f\r\n", b, channel_samples[b].real, channel_samples[b].imag);
+      CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+      HAL_Delay(2);
+    }
+  }
+  else
+  {
+    sprintf(usb_tx_buffer, "--- Channelizer (%d ch, %.1f Hz spacing, %d outputs) ---\r\n",
+            CHANNELIZER_CHANNELS, spacing, CHANNELIZER_BLOCKS_PER_FRAME);
+    CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+    HAL_Delay(10);
+    for (uint32_t k = 0; k <= n / 2; k++)
+    {
+      float power = fft_magnitudes[k] / (float)CHANNELIZER_BLOCKS_PER_FRAME;
+      int len = sprintf(usb_tx_buffer, "PFB[%lu]: %.1f Hz %.2f dB\r\n",
+                        k, (float)k * spacing, 10.0f * log10f(power + 1e-20f));
+      if (CDC_Transmit_FS((uint8_t *)usb_tx_buffer, len) != USBD_OK)
+      {
+        HAL_Delay(1); // 发送失败时短暂延时
+      }
+      HAL_Delay(2);
+    }
+  }
+
+  sprintf(usb_tx_buffer, "Channelizer: cycles/output=%lu (%.1f us)\r\n",
+          cycles, (float)cycles * 1.0e6f / (float)SystemCoreClock);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+}
+
+/**
+ * @brief 设置多通道扫描模式 (供 usbd_cdc_if 调用)，ADC 规则组在主循环中重新配置
+ * @param channels: 通道数 (2 ~ ACQ_MAX_CHANNELS，PA0 起依次)；0 或 1 表示恢复单通道 FFT 引擎
+ * @param output: 'M' 各通道指标 (连续出帧), 'S' 各通道幅度谱 (单次)
+ * @retval 1: 参数有效; 0: 参数无效，采样频率乘以通道数超出 ADC 转换速率，或触发、频率模板监测已打开
+ */
+uint8_t Set_Scan_Mode(uint32_t channels, char output)
+{
+  if (channels <= 1)
+  {
+    scan_channels_request = 1;
+    scan_config_pending = 1;
+    analysis_engine = ANALYSIS_ENGINE_FFT;
+    new_parameters_received = 1;
+    return 1;
+  }
+  if (channels > ACQ_MAX_CHANNELS || sampling_freq * (float)channels > ACQ_ADC_MAX_CONVERSION_RATE ||
+      trigger_enable_request || mask_running)
+  {
+    return 0;
+  }
+  switch (output)
+  {
+  case 'M':
+  case 'm':
+    scan_output = SCAN_OUTPUT_METRICS;
+    break;
+  case 'S':
+  case 's':
+    scan_output = SCAN_OUTPUT_SPECTRA;
+    break;
+  default:
+    return 0;
+  }
+  scan_channels_request = channels;
+  scan_config_pending = 1;
+  analysis_engine = ANALYSIS_ENGINE_SCAN;
+  new_parameters_received = 1;
+  return 1;
+}
+
+/**
+ * @brief 按请求重新配置 ADC 扫描通道数 (ADC 运行时先停止，改完后按新的交织布局重新启动)
+ */
+static void scan_config_task(void)
+{
+  scan_config_pending = 0;
+  uint32_t channels = scan_channels_request;
+  if (channels == scan_channels)
+  {
+    return;
+  }
+
+  uint8_t running = (acquisition_source == ACQ_SOURCE_ADC);
+  if (running)
+  {
+    acquisition_stop();
+  }
+  if (ADC1_Config_Scan(channels) != HAL_OK)
+  {
+    Error_Handler();
+  }
+  scan_channels = channels;
+  if (!running)
+  {
+    acquisition_reset(&acquisition, channels); // 只更新布局，下次启动时再清空
+  }
+  else if (!acquisition_start())
+  {
+    acquisition_source = ACQ_SOURCE_SYNTHETIC;
+    acquisition_request = ACQ_SOURCE_SYNTHETIC;
+  }
+  new_parameters_received = 1;
+}
+
+/**
+ * @brief 多通道扫描: 取一个交织块，按通道拆分后一次批量 FFT，发送各通道指标或幅度谱
+ * @note 每通道 frame_len 点 (1024 / 通道数向下取 2 的幂)，所有通道共用 fft_input_output 和 fft_magnitudes；
+ *       软件信号发生器作为来源时各通道为同一信号。
+ */
+static void perform_scan_and_send(void)
+{
+  const uint32_t channels = acquisition.channels;
+  const uint32_t len = acquisition.frame_len;
+
+  // --- 1. 按通道拆分到 adc_samples (第 c 个通道位于 [c * len, (c + 1) * len)) ---
+  if (acquisition_source == ACQ_SOURCE_ADC)
+  {
+    generator_cycles = 0;
+    const uint16_t *block = wait_for_block();
+    if (block == NULL)
+    {
+      memset(adc_samples, 0, channels * len * sizeof(float));
+    }
+    else
+    {
+      for (uint32_t c = 0; c < channels; c++)
+      {
+        acquisition_convert_channel(&acquisition, block, c, &adc_samples[c * len]);
+      }
+    }
+  }
+  else
+  {
+    generate_test_signal(adc_samples, len);
+    for (uint32_t c = 1; c < channels; c++)
+    {
+      memcpy(&adc_samples[c * len], adc_samples, len * sizeof(float));
+    }
+  }
+
+  // --- 2. 一次批量 FFT 处理所有通道 ---
+  for (uint32_t i = 0; i < channels * len; i++)
+  {
+    fft_input_output[i].real = adc_samples[i];
+    fft_input_output[i].imag = 0.0f;
+  }
+  uint32_t start = DWT->CYCCNT;
+  fft_radix2_batch(fft_input_output, len, channels);
+  uint32_t cycles = DWT->CYCCNT - start;
+  for (uint32_t c = 0; c < channels; c++)
+  {
+    fft_calculate_magnitudes(&fft_input_output[c * len], &fft_magnitudes[c * len / 2], len);
+  }
+
+  // --- 3. 发送结果 ---
+  float bin_spacing = sampling_freq / (float)len;
+  sprintf(usb_tx_buffer, "--- Scan (%lu ch, %lu points/ch, %.3f Hz/bin) ---\r\n", channels, len, bin_spacing);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+
+  for (uint32_t c = 0; c < channels; c++)
+  {
+    const float *samples = &adc_samples[c * len];
+    const float *magnitudes = &fft_magnitudes[c * len / 2];
+    if (scan_output == SCAN_OUTPUT_SPECTRA)
+    {
+      for (uint32_t k = 0; k < len / 2; k++)
+      {
+        int n = sprintf(usb_tx_buffer, "CH%lu[%lu]: %.6f\r\n", c, k, magnitudes[k]);
+        if (CDC_Transmit_FS((uint8_t *)usb_tx_buffer, n) != USBD_OK)
+        {
+          HAL_Delay(1); // 发送失败时短暂延时
+        }
+        HAL_Delay(2);
+      }
+      continue;
+    }
+
+    // 直流、交流有效值和峰值频点 (跳过直流频点)
+    float sum = 0.0f;
+    float sum_sq = 0.0f;
+    for (uint32_t i = 0; i < len; i++)
+    {
+      sum += samples[i];
+      sum_sq += samples[i] * samples[i];
+    }
+    float dc = sum / (float)len;
+    float ac_power = sum_sq / (float)len - dc * dc;
+    uint32_t peak = 1;
+    for (uint32_t k = 2; k < len / 2; k++)
+    {
+      if (magnitudes[k] > magnitudes[peak])
+      {
+        peak = k;
+      }
+    }
+    sprintf(usb_tx_buffer, "SCAN[%lu]: dc=%.4f rms=%.4f peak=%.2f Hz mag=%.4f\r\n", c, dc,
+            sqrtf(ac_power > 0.0f ? ac_power : 0.0f), (float)peak * bin_spacing, magnitudes[peak]);
+    if (CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer)) == USBD_OK)
+    {
+      HAL_Delay(2);
+    }
+    else
+    {
+      HAL_Delay(1);
+    }
+  }
+
+  sprintf(usb_tx_buffer, "Scan: batch FFT cycles=%lu (%.1f us, %.1f us/ch)\r\n", cycles,
+          (float)cycles * 1.0e6f / (float)SystemCoreClock,
+          (float)cycles * 1.0e6f / (float)SystemCoreClock / (float)channels);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+}
+
+/**
+ * @brief 设置电平/斜率触发 (供 usbd_cdc_if 调用)，布防在主循环中进行
+ * @param type: 'R' 上升沿, 'F' 下降沿, 'P' 正斜率, 'N' 负斜率, '0' 关闭触发
+ * @param level: 触发电平 (V)；斜率触发时为门限 (V/采样，> 0)
+ * @param pre_percent: 预触发比例 (0 ~ 100，捕获窗口中位于触发点之前的部分)
+ * @param mode: 'A' 捕获分析后自动重新布防, 'S' 单次
+ * @retval 1: 参数有效; 0: 参数无效 (只有 FFT 和小波引擎分析捕获帧，其他引擎和多通道扫描时不支持触发)
+ */
+uint8_t Set_Trigger_Mode(char type, float level, float pre_percent, char mode)
+{
+  trigger_type_t trigger_type;
+  switch (type)
+  {
+  case '0':
+    trigger_enable_request = 0;
+    trigger_config_pending = 1;
+    return 1;
+  case 'R':
+  case 'r':
+    trigger_type = TRIGGER_EDGE_RISING;
+    break;
+  case 'F':
+  case 'f':
+    trigger_type = TRIGGER_EDGE_FALLING;
+    break;
+  case 'P':
+  case 'p':
+    trigger_type = TRIGGER_SLOPE_RISING;
+    break;
+  case 'N':
+  case 'n':
+    trigger_type = TRIGGER_SLOPE_FALLING;
+    break;
+  default:
+    return 0;
+  }
+  if (pre_percent < 0.0f || pre_percent > 100.0f || (trigger_type >= TRIGGER_SLOPE_RISING && level <= 0.0f) ||
+      (mode != 'A' && mode != 'a' && mode != 'S' && mode != 's') || scan_channels_request > 1 ||
+      (analysis_engine != ANALYSIS_ENGINE_FFT && analysis_engine != ANALYSIS_ENGINE_WAVELET))
+  {
+    return 0;
+  }
+
+  uint32_t pre = (uint32_t)(pre_percent * (float)ADC_BUFFER_SIZE / 100.0f + 0.5f);
+  trigger_pre_request = (pre < ADC_BUFFER_SIZE) ? pre : ADC_BUFFER_SIZE - 1;
+  trigger_type_request = trigger_type;
+  trigger_level_request = level;
+  trigger_single = (mode == 'S' || mode == 's');
+  trigger_enable_request = 1;
+  trigger_config_pending = 1;
+  return 1;
+}
+
+/**
+ * @brief 清空环形缓冲区历史重新布防
+ */
+static void trigger_rearm(void)
+{
+  trigger_restart(&trigger);
+  trigger_block = 0;
+  trigger_last_sequence = acquire_sequence;
+  trigger_last_adc_block = acquisition.last_taken;
+  trigger_last_timeouts = acquisition_timeouts;
+  trigger_state = TRIGGER_STATE_ARMED;
+}
+
+/**
+ * @brief 触发任务: 布防期间每次取一块写入环形缓冲区并检查触发条件，触发后取出捕获窗口交给 perform_fft_and_send
+ * @note 环形缓冲区借用 fft_input_output (2 块 float)，捕获窗口最多跨越相邻两块。
+ *       两次取帧之间有其他功能取过帧或借用过 fft_input_output、ADC 丢块或超时时，历史不连续，重新积累预触发历史。
+ */
+static void trigger_task(void)
+{
+  if (trigger_config_pending)
+  {
+    trigger_config_pending = 0;
+    if (!trigger_enable_request)
+    {
+      trigger_state = TRIGGER_STATE_OFF;
+      new_parameters_received = 1;
+      return;
+    }
+    trigger_arm(&trigger, trigger_type_request, trigger_level_request, trigger_pre_request);
+    trigger_rearm();
+  }
+  if (trigger_state != TRIGGER_STATE_ARMED && trigger_state != TRIGGER_STATE_POST)
+  {
+    return;
+  }
+
+  // --- 1. 取一块写入环形缓冲区的一半 ---
+  uint8_t contiguous = (acquire_sequence == trigger_last_sequence);
+  float *half = &TRIGGER_RING[(trigger_block & 1u) * ADC_BUFFER_SIZE];
+  acquire_frame(half, ADC_BUFFER_SIZE);
+  if (acquisition_source == ACQ_SOURCE_ADC)
+  {
+    contiguous = contiguous && acquisition.last_taken == trigger_last_adc_block + 1 &&
+                 acquisition_timeouts == trigger_last_timeouts;
+  }
+  trigger_last_sequence = acquire_sequence;
+  trigger_last_adc_block = acquisition.last_taken;
+  trigger_last_timeouts = acquisition_timeouts;
+
+  if (!contiguous && trigger_block > 0)
+  {
+    // 历史断开: 把这一块当作布防后的第一块
+    trigger_restart(&trigger);
+    trigger_block = (trigger_block & 1u); // 保持写入位置与块序号一致
+    trigger_state = TRIGGER_STATE_ARMED;
+  }
+
+  // --- 2. 布防: 检查触发条件；触发点之后的采样不够时等下一块 ---
+  if (trigger_state == TRIGGER_STATE_ARMED)
+  {
+    int32_t index = trigger_scan(&trigger, half, ADC_BUFFER_SIZE);
+    if (index < 0)
+    {
+      trigger_block++;
+      return;
+    }
+    trigger_event_block = trigger_block;
+    trigger_event_index = (uint32_t)index;
+    if (trigger_needs_next_block(trigger_event_index, trigger.pre_samples))
+    {
+      trigger_state = TRIGGER_STATE_POST;
+      trigger_block++;
+      return;
+    }
+  }
+
+  // --- 3. 取出捕获窗口 (触发点位于 adc_samples[pre_samples])，下一次主循环做 FFT ---
+  trigger_extract(TRIGGER_RING, ADC_BUFFER_SIZE, trigger_event_block, trigger_event_index, trigger.pre_samples,
+                  adc_samples);
+  trigger_count++;
+  trigger_state = TRIGGER_STATE_READY;
+  new_parameters_received = 1;
+}
+
+/**
+ * @brief 捕获帧分析完成后: 自动模式重新布防，单次模式关闭触发
+ */
+static void trigger_capture_done(void)
+{
+  if (trigger_single)
+  {
+    trigger_state = TRIGGER_STATE_OFF;
+  }
+  else
+  {
+    trigger_rearm(); // fft_input_output 已被 FFT 改写，历史从头积累
+  }
+}
+
+/**
+ * @brief 开始学习频谱基线 (供 usbd_cdc_if 调用)
+ * @param frames: 学习的帧数 (>= 2)，学完后自动写入 Flash 并进入监测；0 表示关闭异常检测
+ * @retval 1: 参数有效; 0: 参数无效，或频率模板监测正在运行
+ */
+uint8_t Set_Anomaly_Learning(uint32_t frames)
+{
+  if (frames == 0)
+  {
+    anomaly_mode = ANOMALY_MODE_OFF;
+    new_parameters_received = 1;
+    return 1;
+  }
+  if (frames < 2 || mask_running)
+  {
+    return 0;
+  }
+  anomaly_learn_frames = frames;
+  baseline_reset_pending = 1;
+  anomaly_mode = ANOMALY_MODE_LEARN;
+  return 1;
+}
+
+/**
+ * @brief 用当前基线开始异常监测 (供 usbd_cdc_if 调用)
+ * @param threshold: 判定阈值 (z 分数，> 0)
+ * @param metric: 'Z' 最大单频点 |z|，'M' 各频点 z 的均方根 (简化马氏距离)
+ * @retval 1: 成功; 0: 参数无效，尚无有效基线或基线的采样频率与当前不同，或频率模板监测正在运行
+ */
+uint8_t Set_Anomaly_Monitor(float threshold, char metric)
+{
+  if (threshold <= 0.0f || anomaly_mode == ANOMALY_MODE_LEARN || !baseline_is_valid(&spectral_baseline) ||
+      spectral_baseline.sample_rate != sampling_freq || mask_running)
+  {
+    return 0;
+  }
+  switch (metric)
+  {
+  case 'Z':
+  case 'z':
+    anomaly_metric = ANOMALY_METRIC_MAX_Z;
+    break;
+  case 'M':
+  case 'm':
+    anomaly_metric = ANOMALY_METRIC_RMS_Z;
+    break;
+  default:
+    return 0;
+  }
+  anomaly_threshold = threshold;
+  anomaly_event_active = 0;
+  anomaly_mode = ANOMALY_MODE_MONITOR;
+  return 1;
+}
+
+/**
+ * @brief 请求把基线写入 Flash 或从 Flash 读回 (供 usbd_cdc_if 调用，擦写在主循环中进行)
+ * @param operation: 'S' 保存, 'L' 读取
+ * @retval 1: 参数有效; 0: 参数无效
+ */
+uint8_t Request_Baseline_Storage(char operation)
+{
+  switch (operation)
+  {
+  case 'S':
+    baseline_save_pending = 1;
+    return 1;
+  case 'L':
+    baseline_load_pending = 1;
+    return 1;
+  default:
+    return 0;
+  }
+}
+
+/**
+ * @brief 把基线封装 (标识 + 校验和) 后写入 Flash 存储扇区
+ * @retval 1: 成功; 0: 基线无效或擦写失败
+ */
+static uint8_t baseline_save(void)
+{
+  if (spectral_baseline.count < 2)
+  {
+    return 0;
+  }
+  baseline_seal(&spectral_baseline);
+  return flash_storage_write(&spectral_baseline, sizeof(spectral_baseline));
+}
+
+/**
+ * @brief 从 Flash 读回基线 (校验失败或采样频率不符时保持 RAM 中的基线不变)
+ * @retval 1: 成功; 0: Flash 中没有有效基线，或基线按其他采样频率学习
+ */
+static uint8_t baseline_load(void)
+{
+  const spectral_baseline_t *stored = (const spectral_baseline_t *)flash_storage_read();
+  if (!baseline_is_valid(stored) || stored->sample_rate != sampling_freq)
+  {
+    return 0;
+  }
+  memcpy(&spectral_baseline, stored, sizeof(spectral_baseline));
+  return 1;
+}
+
+/**
+ * @brief 处理基线保存/读取请求 (Flash 扇区擦除需要数百毫秒，只在主循环中执行)
+ */
+static void baseline_storage_task(void)
+{
+  if (baseline_save_pending)
+  {
+    baseline_save_pending = 0;
+    uint8_t ok = baseline_save();
+    sprintf(usb_tx_buffer, "BASELINE: save %s (%lu frames)\r\n", ok ? "OK" : "FAILED", spectral_baseline.count);
+    CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+    HAL_Delay(10);
+  }
+  if (baseline_load_pending)
+  {
+    baseline_load_pending = 0;
+    uint8_t ok = (anomaly_mode != ANOMALY_MODE_LEARN) && baseline_load();
+    sprintf(usb_tx_buffer, "BASELINE: load %s (%lu frames)\r\n", ok ? "OK" : "FAILED", spectral_baseline.count);
+    CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+    HAL_Delay(10);
+  }
+}
+
+/**
+ * @brief 用已算好的 fft_magnitudes 更新基线或评分 (多窗、AR 等不经过融合路径的估计方法)
+ */
+static void anomaly_process_magnitudes(void)
+{
+  if (anomaly_mode == ANOMALY_MODE_LEARN)
+  {
+    baseline_learn(&spectral_baseline, fft_magnitudes);
+  }
+  else if (anomaly_mode == ANOMALY_MODE_MONITOR)
+  {
+    baseline_score(&spectral_baseline, fft_magnitudes, &anomaly_score);
+  }
+}
+
+/**
+ * @brief 异常检测模式下代替频谱输出: 学习完成时请求保存基线并切换到监测，监测时只发送事件开始/结束
+ */
+static void anomaly_report(void)
+{
+  if (anomaly_mode == ANOMALY_MODE_LEARN)
+  {
+    if (spectral_baseline.count < anomaly_learn_frames)
+    {
+      return;
+    }
+    sprintf(usb_tx_buffer, "BASELINE: learned %lu frames\r\n", spectral_baseline.count);
+    CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+    HAL_Delay(10);
+    baseline_save_pending = 1; // 扇区擦除耗时数百毫秒，交给 baseline_storage_task 写入，不占用本帧
+    anomaly_event_active = 0;
+    anomaly_mode = ANOMALY_MODE_MONITOR;
+    return;
+  }
+
+  float score = (anomaly_metric == ANOMALY_METRIC_RMS_Z) ? anomaly_score.rms_z : anomaly_score.max_z;
+  float threshold = anomaly_threshold;
+  if (!anomaly_event_active)
+  {
+    if (score <= threshold)
+    {
+      return;
+    }
+    anomaly_event_active = 1;
+    anomaly_event_frames = 0;
+    anomaly_event_peak = 0.0f;
+    sprintf(usb_tx_buffer, "ANOM: start score=%.2f bin=%lu (%.1f Hz) z=%.2f rms=%.2f\r\n",
+            score, anomaly_score.max_bin, (float)anomaly_score.max_bin * sampling_freq / FFT_N,
+            anomaly_score.max_z, anomaly_score.rms_z);
+    CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+    HAL_Delay(10);
+  }
+
+  anomaly_event_frames++;
+  if (score > anomaly_event_peak)
+  {
+    anomaly_event_peak = score;
+  }
+  if (score < threshold * ANOMALY_CLEAR_RATIO)
+  {
+    anomaly_event_active = 0;
+    sprintf(usb_tx_buffer, "ANOM: end frames=%lu peak=%.2f\r\n", anomaly_event_frames, anomaly_event_peak);
+    CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+    HAL_Delay(10);
+  }
+}
+
+/**
+ * @brief 开始或停止频谱占用度统计 (供 usbd_cdc_if 调用)
+ * @param enable: 1 清空统计并开始累计; 0 停止累计 (保留统计，仍可读取摘要)
+ * @param threshold_db: 占用判定门限 (dB，-160 ~ 20)
+ * @retval 1: 参数有效; 0: 参数无效
+ */
+uint8_t Set_Occupancy_Survey(uint8_t enable, float threshold_db)
+{
+  if (!enable)
+  {
+    occupancy_running = 0;
+    new_parameters_received = 1;
+    return 1;
+  }
+  if (threshold_db < -160.0f || threshold_db > 20.0f)
+  {
+    return 0;
+  }
+  occupancy_threshold_db = threshold_db;
+  occupancy_reset_pending = 1;
+  occupancy_running = 1;
+  return 1;
+}
+
+/**
+ * @brief 请求发送一次占用度统计摘要 (供 usbd_cdc_if 调用)
+ * @param min_duty_percent: 只列出占空比不低于该值的频点 (0 ~ 100，0 表示所有出现过超门限的频点)
+ * @retval 1: 参数有效; 0: 参数无效
+ */
+uint8_t Request_Occupancy_Report(float min_duty_percent)
+{
+  if (min_duty_percent < 0.0f || min_duty_percent > 100.0f)
+  {
+    return 0;
+  }
+  occupancy_report_min_duty = min_duty_percent;
+  occupancy_report_pending = 1;
+  return 1;
+}
+
+/**
+ * @brief 用当前帧的 fft_magnitudes 更新占用度统计
+ */
+static void occupancy_task(void)
+{
+  if (occupancy_reset_pending)
+  {
+    occupancy_reset_pending = 0;
+    occupancy_reset(&occupancy, occupancy_threshold_db);
+    occupancy_start_tick = HAL_GetTick();
+  }
+  occupancy_update(&occupancy, fft_magnitudes);
+  occupancy_elapsed_ms = HAL_GetTick() - occupancy_start_tick;
+}
+
+/**
+ * @brief 发送占用度统计摘要: 只列出达到最低占空比的频点，末尾附带总体统计
+ */
+static void send_occupancy_report(void)
+{
+  float elapsed_s = (float)occupancy_elapsed_ms * 1.0e-3f;
+  float min_duty = occupancy_report_min_duty * 0.01f;
+
+  sprintf(usb_tx_buffer, "--- Occupancy (frames=%lu, %.1f s, thr=%.1f dB) ---\r\n",
+          occupancy.frames, elapsed_s, occupancy_threshold_db);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+
+  uint32_t occupied = 0;
+  float duty_sum = 0.0f;
+  for (uint32_t k = 0; k < OCCUPANCY_BINS; k++)
+  {
+    float duty = occupancy_duty_cycle(&occupancy, k);
+    duty_sum += duty;
+    if (occupancy.above_count[k] == 0)
+    {
+      continue;
+    }
+    occupied++;
+    if (duty < min_duty)
+    {
+      continue;
+    }
+    int len = sprintf(usb_tx_buffer, "OCC[%lu]: %.1f Hz duty=%.2f%% time=%.1f s max=%.1f dB\r\n",
+                      k, (float)k * sampling_freq / FFT_N, duty * 100.0f, duty * elapsed_s,
+                      occupancy_max_db(&occupancy, k));
+    if (CDC_Transmit_FS((uint8_t *)usb_tx_buffer, len) != USBD_OK)
+    {
+      HAL_Delay(1); // 发送失败时短暂延时
+    }
+    HAL_Delay(2);
+  }
+
+  sprintf(usb_tx_buffer, "Occupancy: occupied=%lu/%d mean duty=%.2f%%\r\n",
+          occupied, OCCUPANCY_BINS, duty_sum * 100.0f / (float)OCCUPANCY_BINS);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+}
+
+/**
+ * @brief 按频率区间写入限值线 (供 usbd_cdc_if 调用)，区间内按 dB 线性插值
+ * @param f_start: 起始频率 (Hz，>= 0)
+ * @param f_end: 终止频率 (Hz，>= f_start，不超过当前奈奎斯特频率)
+ * @param db_start: 起始频率处的限值 (dB，MASK_DB_FLOOR ~ +7)
+ * @param db_end: 终止频率处的限值 (dB)
+ * @retval 1: 参数有效; 0: 参数无效
+ * @note 频率按当前采样频率换算为频点，改变采样频率后需重新上传
+ */
+uint8_t Set_Mask_Segment(float f_start, float f_end, float db_start, float db_end)
+{
+  float db_max = MASK_DB_FLOOR + (float)MASK_CODE_MAX * MASK_DB_STEP;
+  if (f_start < 0.0f || f_end < f_start || f_end > sampling_freq / 2.0f || db_start < MASK_DB_FLOOR ||
+      db_start > db_max || db_end < MASK_DB_FLOOR || db_end > db_max)
+  {
+    return 0;
+  }
+  float bin_width = sampling_freq / FFT_N;
+  spectral_mask_set_segment(&spectral_mask, (uint32_t)(f_start / bin_width + 0.5f), (uint32_t)(f_end / bin_width + 0.5f),
+                            db_start, db_end);
+  return 1;
+}
+
+/**
+ * @brief 直接写入一段限值编码 (供 usbd_cdc_if 调用)，主机逐频点上传任意限值线
+ * @param first_bin: 起始频点 (< MASK_BINS)
+ * @param codes: 编码 (dB = MASK_DB_FLOOR + code * MASK_DB_STEP，MASK_CODE_NONE 表示不检查)
+ * @param count: 编码个数 (first_bin + count <= MASK_BINS)
+ * @retval 1: 参数有效; 0: 参数无效
+ */
+uint8_t Set_Mask_Codes(uint32_t first_bin, const uint8_t *codes, uint32_t count)
+{
+  if (count == 0 || first_bin >= MASK_BINS || count > MASK_BINS - first_bin)
+  {
+    return 0;
+  }
+  spectral_mask_set_codes(&spectral_mask, first_bin, codes, count);
+  return 1;
+}
+
+/**
+ * @brief 清空限值线 (供 usbd_cdc_if 调用)，所有频点不检查
+ */
+void Clear_Mask(void)
+{
+  memset(spectral_mask.codes, MASK_CODE_NONE, sizeof(spectral_mask.codes));
+}
+
+/**
+ * @brief 开始或停止频率模板监测 (供 usbd_cdc_if 调用)
+ * @param mode: 'A' 恢复通过后自动重新布防, 'S' 捕获一次事件后停止, '0' 停止 (保留计数)
+ * @retval 1: 参数有效; 0: 参数无效，异常检测正在运行，或未选择 FFT 引擎 (只有 FFT 引擎逐帧检查限值线)
+ */
+uint8_t Set_Mask_Monitor(char mode)
+{
+  switch (mode)
+  {
+  case '0':
+    mask_running = 0;
+    new_parameters_received = 1;
+    return 1;
+  case 'A':
+  case 'a':
+    mask_single = 0;
+    break;
+  case 'S':
+  case 's':
+    mask_single = 1;
+    break;
+  default:
+    return 0;
+  }
+  if (anomaly_mode != ANOMALY_MODE_OFF || analysis_engine != ANALYSIS_ENGINE_FFT)
+  {
+    return 0;
+  }
+  mask_reset_pending = 1;
+  mask_running = 1;
+  return 1;
+}
+
+/**
+ * @brief 请求立即发送一次通过/超限计数 (供 usbd_cdc_if 调用)
+ */
+void Request_Mask_Status(void)
+{
+  mask_status_pending = 1;
+}
+
+/**
+ * @brief 发送通过/超限计数
+ */
+static void send_mask_status(void)
+{
+  sprintf(usb_tx_buffer, "Mask: frames=%lu pass=%lu fail=%lu events=%lu %s\r\n", mask_frames, mask_passed,
+          mask_failed, mask_events, mask_running ? (mask_latched ? "FAIL" : "PASS") : "STOPPED");
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+  mask_status_tick = HAL_GetTick();
+}
+
+/**
+ * @brief 当前帧 (adc_samples) 是否紧接在 mask_history 之后采集
+ */
+static uint8_t mask_history_contiguous(void)
+{
+  if (!mask_history_valid || acquire_sequence != mask_history_sequence + 1)
+  {
+    return 0;
+  }
+  return acquisition_source != ACQ_SOURCE_ADC ||
+         (acquisition.last_taken == mask_history_adc_block + 1 && acquisition_timeouts == mask_history_timeouts);
+}
+
+/**
+ * @brief 把当前帧量化保存为下一帧的前一帧历史
+ */
+static void mask_save_history(void)
+{
+  const float inv_lsb = 1.0f / MASK_SAMPLE_LSB;
+  for (uint32_t i = 0; i < ADC_BUFFER_SIZE; i++)
+  {
+    float code = adc_samples[i] * inv_lsb;
+    code += (code >= 0.0f) ? 0.5f : -0.5f;
+    if (code > 32767.0f)
+    {
+      code = 32767.0f;
+    }
+    else if (code < -32768.0f)
+    {
+      code = -32768.0f;
+    }
+    mask_history[i] = (int16_t)code;
+  }
+  mask_history_valid = 1;
+  mask_history_sequence = acquire_sequence;
+  mask_history_adc_block = acquisition.last_taken;
+  mask_history_timeouts = acquisition_timeouts;
+}
+
+/**
+ * @brief 捕获的时域采样: 下标 0 为超限帧第一个采样，负下标为前一帧，>= ADC_BUFFER_SIZE 为后一块
+ */
+static float mask_capture_sample(int32_t index)
+{
+  if (index < 0)
+  {
+    return (float)mask_history[index + ADC_BUFFER_SIZE] * MASK_SAMPLE_LSB;
+  }
+  if (index < ADC_BUFFER_SIZE)
+  {
+    return adc_samples[index];
+  }
+  return MASK_POST_BLOCK[index - ADC_BUFFER_SIZE];
+}
+
+/**
+ * @brief 发送捕获的事件: 超限摘要、整帧幅度谱和前后相邻块的时域采样 (每行 8 个值)
+ * @param pre_ok: 前一帧历史是否与超限帧连续
+ * @param post_ok: 后一块是否与超限帧连续
+ */
+static void send_mask_event(uint8_t pre_ok, uint8_t post_ok)
+{
+  // --- 1. 事件头和最严重的超限频点 ---
+  uint8_t enabled;
+  uint32_t worst = mask_result.worst_bin;
+  float limit_db = spectral_mask_limit_db(&spectral_mask, worst, &enabled);
+  float over_db = 20.0f * log10f(mask_result.worst_ratio);
+  sprintf(usb_tx_buffer, "--- Mask Event #%lu (frame %lu, %lu bins over limit) ---\r\n", mask_events, mask_frames,
+          mask_result.violations);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+  sprintf(usb_tx_buffer, "MASK: worst bin=%lu (%.1f Hz) level=%.1f dB limit=%.1f dB over=%.1f dB\r\n", worst,
+          (float)worst * sampling_freq / FFT_N, limit_db + over_db, limit_db, over_db);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+
+  // --- 2. 超限帧的幅度谱 ---
+  for (uint32_t k = 0; k < MASK_BINS; k += 8)
+  {
+    int len = sprintf(usb_tx_buffer, "MSPEC[%lu]:", k);
+    for (uint32_t j = 0; j < 8; j++)
+    {
+      len += sprintf(usb_tx_buffer + len, " %.3e", fft_magnitudes[k + j]);
+    }
+    len += sprintf(usb_tx_buffer + len, "\r\n");
+    if (CDC_Transmit_FS((uint8_t *)usb_tx_buffer, len) != USBD_OK)
+    {
+      HAL_Delay(1); // 发送失败时短暂延时
+    }
+    HAL_Delay(2);
+  }
+
+  // --- 3. 时域采样: 前一帧 (连续时) + 超限帧 + 后一块 (连续时) ---
+  int32_t first = pre_ok ? -(int32_t)ADC_BUFFER_SIZE : 0;
+  int32_t last = post_ok ? 2 * (int32_t)ADC_BUFFER_SIZE : (int32_t)ADC_BUFFER_SIZE;
+  for (int32_t i = first; i < last; i += 8)
+  {
+    int len = sprintf(usb_tx_buffer, "MTIME[%ld]:", (long)i);
+    for (int32_t j = 0; j < 8; j++)
+    {
+      len += sprintf(usb_tx_buffer + len, " %.4f", mask_capture_sample(i + j));
+    }
+    len += sprintf(usb_tx_buffer + len, "\r\n");
+    if (CDC_Transmit_FS((uint8_t *)usb_tx_buffer, len) != USBD_OK)
+    {
+      HAL_Delay(1); // 发送失败时短暂延时
+    }
+    HAL_Delay(2);
+  }
+
+  sprintf(usb_tx_buffer, "Mask: event #%lu pre=%s post=%s\r\n", mask_events, pre_ok ? "OK" : "GAP",
+          post_ok ? "OK" : "GAP");
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+}
+
+/**
+ * @brief 频率模板监测模式下代替频谱输出: 统计通过/超限帧，首次超限时捕获事件，定期发送计数
+ * @note 比较已在 estimate_spectrum 中与幅度计算同一次遍历完成。超限后锁定，恢复通过之前的超限帧只计数不重复捕获。
+ */
+static void mask_report(void)
+{
+  if (mask_reset_pending)
+  {
+    mask_reset_pending = 0;
+    mask_frames = 0;
+    mask_passed = 0;
+    mask_failed = 0;
+    mask_events = 0;
+    mask_latched = 0;
+    mask_history_valid = 0;
+    mask_status_tick = HAL_GetTick();
+  }
+
+  mask_frames++;
+  if (mask_result.violations == 0)
+  {
+    mask_passed++;
+    mask_latched = 0;
+  }
+  else
+  {
+    mask_failed++;
+    if (!mask_latched)
+    {
+      // --- 立即取紧接超限帧的一块，再发送事件 (发送期间的采样不连续) ---
+      mask_latched = 1;
+      mask_events++;
+      uint8_t pre_ok = mask_history_contiguous();
+      uint32_t event_block = acquisition.last_taken;
+      uint32_t event_timeouts = acquisition_timeouts;
+      acquire_frame(MASK_POST_BLOCK, ADC_BUFFER_SIZE);
+      uint8_t post_ok = acquisition_source != ACQ_SOURCE_ADC ||
+                        (acquisition.last_taken == event_block + 1 && acquisition_timeouts == event_timeouts);
+      send_mask_event(pre_ok, post_ok);
+      mask_history_valid = 0;
+      if (mask_single)
+      {
+        mask_running = 0;
+        send_mask_status();
+      }
+      return;
+    }
+  }
+  mask_save_history();
+
+  if (HAL_GetTick() - mask_status_tick >= MASK_STATUS_INTERVAL_MS)
+  {
+    send_mask_status();
+  }
+}
+
+/**
+ * @brief 启用或停用频谱结果缓存 (供 usbd_cdc_if 调用)，两种情况下都清空已有条目
+ * @param enable: 1 启用; 0 停用
+ */
+void Set_Spectrum_Cache(uint8_t enable)
+{
+  spectrum_cache_enabled = enable ? 1 : 0;
+  spectrum_cache_clear_pending = 1;
+}
+
+/**
+ * @brief 当前帧能否使用缓存: 信号必须只由参数决定 (ADC 采集、扫频和噪声随时间变化)，输出只依赖 fft_magnitudes，
+ *        且异常检测、占用度统计等需要逐帧新数据的功能未启用
+ */
+static uint8_t spectrum_cache_usable(void)
+{
+  siggen_waveform_t waveform = generator_config.waveform;
+  uint8_t deterministic = (waveform != SIGGEN_CHIRP_LINEAR && waveform != SIGGEN_CHIRP_LOG &&
+                           waveform != SIGGEN_NOISE_WHITE && waveform != SIGGEN_NOISE_PINK &&
+                           waveform != SIGGEN_NOISE_GAUSSIAN);
+  return spectrum_cache_enabled && deterministic && acquisition_source == ACQ_SOURCE_SYNTHETIC &&
+         analysis_engine == ANALYSIS_ENGINE_FFT &&
+         (spectrum_output_mode == SPECTRUM_OUTPUT_BINS || spectrum_output_mode == SPECTRUM_OUTPUT_OCTAVE) &&
+         anomaly_mode == ANOMALY_MODE_OFF && !occupancy_running && trigger_state == TRIGGER_STATE_OFF && !mask_running;
+}
+
+/**
+ * @brief 由当前发生器配置和频谱估计方法构造缓存键 (FFT_N 固定，窗函数由估计方法决定)
+ */
+static void build_spectrum_cache_key(spectrum_cache_key_t *key)
+{
+  memset(key, 0, sizeof(*key));
+  key->freq = generator_config.freq;
+  key->amplitude = generator_config.amplitude;
+  key->offset = generator_config.offset;
+  key->sample_rate = sampling_freq;
+  key->waveform = (uint32_t)generator_config.waveform;
+  key->config_hash = spectrum_cache_hash(&generator_config, sizeof(generator_config));
+  key->estimator = (uint32_t)spectrum_estimator | (ar_order << 8) | (ar_frame_len << 16);
+}
+
+/**
+ * @brief 按当前选择的方法由 adc_samples 估计幅度谱，写入 fft_magnitudes
+ * @retval 本次估计消耗的 CPU 周期数
+ */
+static uint32_t estimate_spectrum(void)
+{
+  uint32_t start = DWT->CYCCNT;
+
+  switch (spectrum_estimator)
+  {
+  case SPECTRUM_ESTIMATOR_MULTITAPER:
+  case SPECTRUM_ESTIMATOR_MULTITAPER_ADAPTIVE:
+    multitaper_estimate(adc_samples, fft_input_output, multitaper_eigen_store,
+                        (spectrum_estimator == SPECTRUM_ESTIMATOR_MULTITAPER_ADAPTIVE)
+                            ? MULTITAPER_WEIGHTS_ADAPTIVE
+                            : MULTITAPER_WEIGHTS_EQUAL,
+                        fft_magnitudes);
+    break;
+  case SPECTRUM_ESTIMATOR_AR:
+    estimate_ar_spectrum();
+    break;
+  case SPECTRUM_ESTIMATOR_PERIODOGRAM:
+  default:
+    fft_radix2(fft_input_output, FFT_N);
+    // 异常检测时幅度计算与基线更新/评分在同一次遍历中完成
+    if (anomaly_mode == ANOMALY_MODE_LEARN)
+    {
+      baseline_learn_spectrum(&spectral_baseline, fft_input_output, fft_magnitudes);
+    }
+    else if (anomaly_mode == ANOMALY_MODE_MONITOR)
+    {
+      baseline_score_spectrum(&spectral_baseline, fft_input_output, fft_magnitudes, &anomaly_score);
+    }
+    else if (mask_running)
+    {
+      spectral_mask_check_spectrum(&spectral_mask, fft_input_output, fft_magnitudes, &mask_result);
+    }
+    else
+    {
+      fft_calculate_magnitudes(fft_input_output, fft_magnitudes, FFT_N);
+    }
+    return DWT->CYCCNT - start;
+  }
+
+  anomaly_process_magnitudes();
+  if (mask_running)
+  {
+    spectral_mask_check(&spectral_mask, fft_magnitudes, &mask_result);
+  }
+  return DWT->CYCCNT - start;
+}
+
+/**
+ * @brief 生成正弦波，执行 FFT 并通过 USB 发送结果
+ */
+void perform_fft_and_send(void)
+{
+  // 稀疏 FFT 引擎按需取样，不需要生成整帧采样
+  if (analysis_engine == ANALYSIS_ENGINE_SPARSE_FFT)
+  {
+    perform_sparse_fft_and_send();
+    return;
+  }
+
+  // 信道化器引擎使用跨帧连续的采样流
+  if (analysis_engine == ANALYSIS_ENGINE_CHANNELIZER)
+  {
+    perform_channelizer_and_send();
+    return;
+  }
+
+  // 多通道扫描引擎: 所有通道一次批量 FFT
+  if (analysis_engine == ANALYSIS_ENGINE_SCAN)
+  {
+    perform_scan_and_send();
+    return;
+  }
+
+  // 触发模式: 只分析捕获到的帧，布防期间不出帧
+  uint8_t triggered = 0;
+  if (trigger_state != TRIGGER_STATE_OFF)
+  {
+    if (trigger_state != TRIGGER_STATE_READY)
+    {
+      return;
+    }
+    triggered = 1;
+  }
+
+  if (spectrum_cache_clear_pending)
+  {
+    spectrum_cache_clear_pending = 0;
+    spectrum_cache_clear(&spectrum_cache);
+  }
+
+  // --- 1. 使用当前参数生成模拟信号 (参数已缓存时跳过 1~4 步，直接取出幅度谱) ---
+  float freq = current_signal_freq;
+  float amp = current_signal_amplitude;
+  float offset = current_signal_offset;
+  apply_generator_parameters();
+  spectrum_cache_key_t cache_key;
+  uint8_t use_cache = spectrum_cache_usable();
+  uint8_t cache_hit = 0;
+  if (use_cache)
+  {
+    build_spectrum_cache_key(&cache_key);
+    cache_hit = spectrum_cache_lookup(&spectrum_cache, &cache_key, fft_magnitudes);
+  }
+
+  if (!cache_hit)
+  {
+    if (!triggered)
+    {
+      acquire_frame(adc_samples, ADC_BUFFER_SIZE);
+    }
+
+    // --- 2. 准备 FFT 输入缓冲区 ---
+    prepare_fft_input(adc_samples, ADC_BUFFER_SIZE);
+  }
+
+  // 小波引擎: O(N) 变换直接改写 adc_samples，不再做频谱估计
+  if (analysis_engine == ANALYSIS_ENGINE_WAVELET)
+  {
+    perform_wavelet_and_send();
+    return;
+  }
+
+  // --- 3/4. 按选择的方法估计幅度谱 (周期图或多窗)，并记录耗时 ---
+  if (baseline_reset_pending)
+  {
+    baseline_reset_pending = 0;
+    baseline_reset(&spectral_baseline, sampling_freq);
+  }
+  if (cache_hit)
+  {
+    last_estimator_cycles = 0;
+    generator_cycles = 0;
+  }
+  else
+  {
+    last_estimator_cycles = estimate_spectrum();
+    if (use_cache)
+    {
+      spectrum_cache_store(&spectrum_cache, &cache_key, fft_magnitudes);
+    }
+  }
+  if (occupancy_running)
+  {
+    occupancy_task();
+  }
+
+  // 异常检测: 不发送频谱，只发送学习完成和异常事件
+  if (anomaly_mode != ANOMALY_MODE_OFF)
+  {
+    anomaly_report();
+    return;
+  }
+  // 频率模板监测: 不发送频谱，只发送计数和捕获的事件
+  if (mask_running)
+  {
+    mask_report();
+    return;
+  }
+  // 占用度统计: 只累计，摘要按需读取
+  if (occupancy_running)
+  {
+    return;
+  }
+
+  // --- 5. 通过 USB VCP 发送结果 (按输出模式) ---
+  switch (spectrum_output_mode)
+  {
+  case SPECTRUM_OUTPUT_OCTAVE:
+    send_octave_bands();
+    break;
+  case SPECTRUM_OUTPUT_MFCC:
+    send_mfcc_frame();
+    break;
+  case SPECTRUM_OUTPUT_DESCRIPTORS:
+    send_descriptor_frame();
+    break;
+  case SPECTRUM_OUTPUT_CQT:
+    send_cqt_bins();
+    break;
+  case SPECTRUM_OUTPUT_BINS:
+  default:
+    send_fft_magnitudes(freq, amp, offset);
+    break;
+  }
+
+  // --- 6. (可选) 计算并发送峰值频率 (二进制模式下不发送文本行) ---
+  if (output_mode_is_binary(spectrum_output_mode))
+  {
+    return;
+  }
+  float max_magnitude = 0;
+  uint32_t max_index = 0;
+  for (uint32_t i = 1; i < FFT_N / 2; i++) // 忽略直流分量
+  {
+    if (fft_magnitudes[i] > max_magnitude)
+    {
+      max_magnitude = fft_magnitudes[i];
+      max_index = i;
+    }
+  }
+  float fundamental_frequency = (float)max_index * sampling_freq / FFT_N;
+  sprintf(usb_tx_buffer, "Peak Frequency Index: %lu (%.2f Hz)\r\n", max_index, fundamental_frequency);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+
+  // --- 7. 发送频谱估计耗时，便于比较不同估计方法的代价 ---
+  static const char *const estimator_names[] = {"PG", "MT", "MTA", "AR"};
+  sprintf(usb_tx_buffer, "Estimator: %s cycles=%lu (%.1f us)\r\n",
+          estimator_names[spectrum_estimator], last_estimator_cycles,
+          (float)last_estimator_cycles * 1.0e6f / (float)SystemCoreClock);
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+
+  // 信号生成耗时 (应远小于频谱估计耗时)，ADC 采集时改为报告块计数
+  static const char *const generator_names[] = {"SINE", "SQUARE", "TRI", "SAW", "TONES", "LCHIRP",
+                                                "XCHIRP", "AM", "FM", "WHITE", "PINK", "GAUSS"};
+  if (acquisition_source == ACQ_SOURCE_ADC)
+  {
+    sprintf(usb_tx_buffer, "Source: ADC blocks=%lu dropped=%lu timeouts=%lu\r\n",
+            (unsigned long)acquisition.blocks_completed,
+            (unsigned long)(acquisition.blocks_completed - acquisition.blocks_taken),
+            (unsigned long)acquisition_timeouts);
+  }
+  else
+  {
+    sprintf(usb_tx_buffer, "Generator: %s cycles=%lu (%.1f us)\r\n", generator_names[test_generator.waveform],
+            generator_cycles, (float)generator_cycles * 1.0e6f / (float)SystemCoreClock);
+  }
+  CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+  HAL_Delay(10);
+
+  if (triggered)
+  {
+    static const char trigger_names[] = {'R', 'F', 'P', 'N'};
+    // 触发点位于帧内第 pre 个采样，t 为布防到触发的时间
+    float elapsed = (float)(trigger_event_block * ADC_BUFFER_SIZE + trigger_event_index) / sampling_freq;
+    sprintf(usb_tx_buffer, "Trigger: #%lu %c level=%.4f pre=%lu t=%.3f s\r\n", (unsigned long)trigger_count,
+            trigger_names[trigger.type], trigger.level, (unsigned long)trigger.pre_samples, elapsed);
+    CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+    HAL_Delay(10);
+  }
+
+  if (use_cache)
+  {
+    sprintf(usb_tx_buffer, "Cache: %s (hits=%lu misses=%lu)\r\n", cache_hit ? "hit" : "miss",
+            (unsigned long)spectrum_cache.hits, (unsigned long)spectrum_cache.misses);
+    CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+    HAL_Delay(10);
+  }
+
+  if (spectrum_estimator == SPECTRUM_ESTIMATOR_AR && !cache_hit)
+  {
+    // AR 各阶段耗时: 模型 (加窗+自相关+Levinson) 与谱网格 (一次 FFT_N 点 FFT)
+    sprintf(usb_tx_buffer, "AR: order=%lu len=%lu model=%lu grid=%lu cycles\r\n",
+            ar_order, ar_frame_len, ar_stage_cycles[0], ar_stage_cycles[1]);
+    CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+    HAL_Delay(10);
+  }
+}
+/* USER CODE END 0 */
+
+/**
+ * @brief  The application entry point.
+ * @retval int
+ */
+int main(void)
+{
+
+  /* USER CODE BEGIN 1 */
+
+  /* USER CODE END 1 */
+
+  /* MCU Configuration--------------------------------------------------------*/
+
+  /* Reset of all peripherals, Initializes the Flash interface and the Systick. */
+  HAL_Init();
+
+  /* USER CODE BEGIN Init */
+
+  /* USER CODE END Init */
+
+  /* Configure the system clock */
+  SystemClock_Config();
+
+  /* USER CODE BEGIN SysInit */
+
+  /* USER CODE END SysInit */
+
+  /* Initialize all configured peripherals */
+  MX_GPIO_Init();
+  MX_DMA_Init();
+  MX_USB_DEVICE_Init();
+  MX_ADC1_Init();
+  MX_TIM2_Init();
+  /* USER CODE BEGIN 2 */
+  HAL_Delay(3000); // 等我插上USB
+  cycle_counter_init();
+  baseline_load(); // 上电时读回 Flash 中保存的基线 (如有)，可直接 ANOM:RUN
+  siggen_init(&test_generator, 0);
+  acquisition_reset(&acquisition, 1);
+  spectral_mask_init(&spectral_mask);
+
+  /* USER CODE END 2 */
+
+  /* Infinite loop */
+  /* USER CODE BEGIN WHILE */
+  while (1)
+  {
+    // 每隔几秒发送一次当前参数状态，以便诊断
+    static uint32_t lastDebugTime = 0;
+    uint32_t currentTime = HAL_GetTick();
+    
+    if (currentTime - lastDebugTime > 3000) // 每3秒发送一次
+    {
+      lastDebugTime = currentTime;
+      sprintf(usb_tx_buffer, "DEBUG: Flag=%d, F=%.1f, A=%.2f, O=%.2f\r\n", 
+              (int)new_parameters_received,
+              current_signal_freq,
+              current_signal_amplitude,
+              current_signal_offset);
+      CDC_Transmit_FS((uint8_t *)usb_tx_buffer, strlen(usb_tx_buffer));
+    }
+    
+    // 触发模式: 布防期间只取块检查触发条件
+    if (trigger_config_pending || trigger_state == TRIGGER_STATE_ARMED || trigger_state == TRIGGER_STATE_POST)
+    {
+      trigger_task();
+    }
+
+    // 二进制特征模式和小波引擎下连续出帧
+    if (new_parameters_received || streaming_is_active())
+    {
+      new_parameters_received = 0;                // 清除标志位
+      perform_fft_and_send();                     // 执行 FFT 计算和发送
+      HAL_GPIO_TogglePin(LED_GPIO_Port, LED_Pin); // 切换 LED 状态，指示处理完成
+      if (trigger_state == TRIGGER_STATE_READY)
+      {
+        trigger_capture_done();
+      }
+    }
+
+    if (gcc_request_pending)
+    {
+      gcc_request_pending = 0;
+      perform_gcc_phat_and_send();
+    }
+
+    if (pitch_request_pending)
+    {
+      pitch_request_pending = 0;
+      perform_pitch_and_send();
+    }
+
+    if (envelope_request_pending)
+    {
+      envelope_request_pending = 0;
+      perform_envelope_and_send();
+    }
+
+    if (slm_report_interval_ms > 0 && trigger_state == TRIGGER_STATE_OFF) // 布防期间采样流归触发任务
+    {
+      level_meter_task();
+    }
+
+    if (baseline_save_pending || baseline_load_pending)
+    {
+      baseline_storage_task();
+    }
+
+    if (occupancy_report_pending)
+    {
+      occupancy_report_pending = 0;
+      send_occupancy_report();
+    }
+
+    if (mask_status_pending)
+    {
+      mask_status_pending = 0;
+      send_mask_status();
+    }
+
+    if (dds_benchmark_pending)
+    {
+      dds_benchmark_pending = 0;
+      perform_dds_benchmark_and_send();
+    }
+
+    if (sweep_pending)
+    {
+      sweep_pending = 0;
+      perform_sweep_and_send();
+    }
+
+    if (ir_request_pending)
+    {
+      ir_request_pending = 0;
+      perform_impulse_response_and_send();
+    }
+
+    if (sample_rate_pending)
+    {
+      sample_rate_task();
+    }
+
+    if (acquisition_source_pending)
+    {
+      acquisition_source_pending = 0;
+      acquisition_source_task();
+    }
+
+    if (scan_config_pending)
+    {
+      scan_config_task();
+    }
+
+    // 主循环可以执行其他低优先级任务
+    // 二进制流模式和触发布防期间不延时 (布防时在等待 ADC 块时睡眠)，帧率只受计算和 USB 带宽限制
+    if (!streaming_is_active() && trigger_state == TRIGGER_STATE_OFF)
+    {
+      HAL_Delay(10); // 短暂延时，降低 CPU 占用率，但会影响响应速度
+    }
   }
   /* USER CODE END WHILE */
 
@@ -0,0 +1,145 @@
+#include "mfcc.h"
+#include <math.h> // log10f, powf, logf, cosf, sqrtf
+
+// 对数压缩前的能量下限，防止对 0 取对数
+#define MFCC_ENERGY_FLOOR 1e-12f
+
+// --- 私有辅助函数 ---
+
+/**
+ * @brief 频率 (Hz) 转换为梅尔刻度 (HTK 公式)。
+ */
+static float hz_to_mel(float hz)
+{
+    return 2595.0f * log10f(1.0f + hz / 700.0f);
+}
+
+/**
+ * @brief 梅尔刻度转换为频率 (Hz)。
+ */
+static float mel_to_hz(float mel)
+{
+    return 700.0f * (powf(10.0f, mel / 2595.0f) - 1.0f);
+}
+
+// --- 公共函数 ---
+
+/**
+ * @brief 构建梅尔滤波器组和 DCT-II 系数表。
+ */
+uint8_t mfcc_plan_init(mfcc_plan_t *plan, uint32_t n, float sample_rate,
+                       uint32_t num_filters, uint32_t num_coeffs,
+                       float f_low, float f_high)
+{
+    if (n == 0 || n > FFT_N || (n & (n - 1)) != 0 || sample_rate <= 0.0f ||
+        num_filters < 2 || num_filters > MFCC_MAX_FILTERS ||
+        num_coeffs == 0 || num_coeffs > num_filters || num_coeffs > MFCC_MAX_COEFFS ||
+        f_low < 0.0f || f_high <= f_low || f_high > sample_rate / 2.0f)
+    {
+        return 0;
+    }
+
+    plan->n = n;
+    plan->sample_rate = sample_rate;
+    plan->num_filters = num_filters;
+    plan->num_coeffs = num_coeffs;
+    plan->f_low = f_low;
+    plan->f_high = f_high;
+
+    // --- 1. 稀疏滤波器组: 梅尔刻度上等间隔的 M+2 个端点 ---
+    float bin_spacing = sample_rate / (float)n;
+    float mel_low = hz_to_mel(f_low);
+    float mel_step = (hz_to_mel(f_high) - mel_low) / (float)(num_filters + 1);
+
+    plan->first_bin = (uint16_t)ceilf(f_low / bin_spacing);
+    plan->last_bin = (uint16_t)ceilf(f_high / bin_spacing);
+    if (plan->last_bin > n / 2)
+    {
+        plan->last_bin = (uint16_t)(n / 2);
+    }
+
+    uint32_t segment = 0;
+    float seg_low = f_low;
+    float seg_high = mel_to_hz(mel_low + mel_step);
+    for (uint32_t k = 0; k < n / 2; k++)
+    {
+        plan->bin_segment[k] = 0;
+        plan->bin_weight[k] = 0.0f;
+        if (k < plan->first_bin || k >= plan->last_bin)
+        {
+            continue;
+        }
+
+        float f = (float)k * bin_spacing;
+        while (f >= seg_high && segment < num_filters)
+        {
+            segment++;
+            seg_low = seg_high;
+            seg_high = mel_to_hz(mel_low + mel_step * (float)(segment + 1));
+        }
+        plan->bin_segment[k] = (uint8_t)segment;
+        plan->bin_weight[k] = (f - seg_low) / (seg_high - seg_low);
+    }
+
+    // --- 2. 正交归一化 DCT-II 系数表 ---
+    float scale0 = sqrtf(1.0f / (float)num_filters);
+    float scale = sqrtf(2.0f / (float)num_filters);
+    for (uint32_t c = 0; c < num_coeffs; c++)
+    {
+        for (uint32_t m = 0; m < num_filters; m++)
+        {
+            float angle = (float)M_PI * (float)c * ((float)m + 0.5f) / (float)num_filters;
+            plan->dct[c * num_filters + m] = ((c == 0) ? scale0 : scale) * cosf(angle);
+        }
+    }
+
+    return 1;
+}
+
+/**
+ * @brief 由 FFT 幅度计算 MFCC。
+ */
+void mfcc_compute(const mfcc_plan_t *plan, const float *magnitudes,
+                  float *mel_energies, float *coeffs)
+{
+    uint32_t num_filters = plan->num_filters;
+
+    for (uint32_t m = 0; m < num_filters; m++)
+    {
+        mel_energies[m] = 0.0f;
+    }
+
+    // --- 1. 滤波器组: 每个频点一次乘加写入相邻两个滤波器 ---
+    for (uint32_t k = plan->first_bin; k < plan->last_bin; k++)
+    {
+        float power = magnitudes[k] * magnitudes[k];
+        uint32_t segment = plan->bin_segment[k];
+        float rising = plan->bin_weight[k] * power;
+        if (segment > 0)
+        {
+            mel_energies[segment - 1] += power - rising; // 滤波器 p-1 的下降沿
+        }
+        if (segment < num_filters)
+        {
+            mel_energies[segment] += rising; // 滤波器 p 的上升沿
+        }
+    }
+
+    // --- 2. 对数压缩 ---
+    for (uint32_t m = 0; m < num_filters; m++)
+    {
+        mel_energies[m] = logf(mel_energies[m] + MFCC_ENERGY_FLOOR);
+    }
+
+    // --- 3. DCT-II ---
+    for (uint32_t c = 0; c < plan->num_coeffs; c++)
+    {
+        const float *basis = &plan->dct[c * num_filters];
+        float sum = 0.0f;
+        for (uint32_t m = 0; m < num_filters; m++)
+        {
+            sum += basis[m] * mel_energies[m];
+        }
+        coeffs[c] = sum;
+    }
+}
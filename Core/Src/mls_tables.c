@@ -0,0 +1,139 @@
+/**
+ * @description: MLS 快速 Hadamard 反卷积的置换表，由 gen_mls_tables.py 自动生成，请勿手动修改。
+ * @note: m = 10，N = 1023，反馈抽头掩码 0x009，初始状态 1。
+ */
+#include "ir_measure.h"
+
+const uint16_t mls_input_perm[MLS_LENGTH] = {
+    1, 512, 256, 128, 64, 32, 16, 8, 516, 258, 129, 576, 288, 144, 72, 548,
+    274, 137, 68, 34, 17, 520, 772, 386, 193, 608, 304, 152, 588, 806, 403, 713,
+    356, 178, 89, 44, 534, 267, 133, 578, 289, 656, 328, 676, 338, 169, 84, 42,
+    533, 778, 901, 962, 481, 752, 376, 700, 862, 943, 471, 747, 373, 698, 861, 430,
+    727, 875, 437, 730, 877, 438, 219, 109, 54, 27, 13, 6, 3, 513, 768, 384,
+    192, 96, 48, 24, 524, 774, 387, 705, 864, 432, 216, 620, 822, 411, 205, 102,
+    51, 537, 268, 646, 323, 673, 848, 424, 724, 362, 693, 858, 941, 470, 235, 117,
+    570, 797, 398, 711, 867, 945, 984, 1004, 1014, 507, 253, 126, 575, 287, 143, 71,
+    547, 785, 904, 964, 482, 241, 632, 828, 926, 975, 487, 755, 889, 444, 734, 879,
+    439, 731, 365, 182, 91, 45, 22, 11, 5, 514, 257, 640, 320, 160, 80, 40,
+    532, 266, 645, 834, 417, 720, 360, 692, 346, 685, 342, 171, 85, 554, 789, 906,
+    965, 994, 497, 760, 892, 958, 991, 495, 247, 635, 317, 158, 591, 295, 659, 841,
+    420, 210, 105, 52, 26, 525, 262, 131, 577, 800, 400, 200, 612, 306, 153, 76,
+    550, 275, 649, 324, 162, 81, 552, 788, 394, 709, 866, 433, 728, 876, 950, 475,
+    237, 118, 59, 29, 14, 519, 771, 897, 960, 480, 240, 120, 572, 798, 911, 455,
+    739, 881, 952, 988, 1006, 1015, 1019, 509, 254, 639, 319, 159, 79, 39, 531, 777,
+    388, 194, 97, 560, 280, 652, 838, 419, 721, 872, 948, 474, 749, 374, 187, 93,
+    46, 535, 779, 389, 706, 353, 688, 344, 684, 854, 427, 213, 618, 821, 922, 973,
+    486, 243, 633, 316, 670, 847, 423, 723, 873, 436, 218, 621, 310, 155, 77, 38,
+    19, 521, 260, 130, 65, 544, 272, 136, 580, 290, 145, 584, 804, 402, 201, 100,
+    50, 25, 12, 518, 259, 641, 832, 416, 208, 104, 564, 282, 653, 326, 163, 593,
+    808, 916, 458, 741, 882, 441, 220, 622, 823, 923, 461, 230, 115, 569, 284, 654,
+    839, 931, 977, 1000, 1012, 506, 765, 382, 703, 351, 175, 87, 555, 277, 650, 837,
+    930, 465, 744, 884, 442, 733, 366, 695, 859, 429, 214, 107, 53, 538, 781, 390,
+    195, 609, 816, 408, 716, 870, 435, 729, 364, 694, 347, 173, 86, 43, 21, 522,
+    773, 898, 449, 736, 368, 184, 604, 814, 919, 971, 485, 754, 377, 188, 606, 815,
+    407, 715, 357, 690, 345, 172, 598, 299, 149, 586, 805, 914, 457, 228, 114, 57,
+    28, 526, 775, 899, 961, 992, 496, 248, 636, 830, 927, 463, 231, 627, 825, 412,
+    718, 871, 947, 985, 492, 758, 379, 189, 94, 559, 279, 651, 325, 674, 337, 680,
+    852, 426, 725, 874, 949, 986, 1005, 502, 251, 125, 62, 543, 271, 135, 579, 801,
+    912, 456, 740, 370, 185, 92, 558, 791, 907, 453, 738, 369, 696, 860, 942, 983,
+    1003, 501, 762, 893, 446, 735, 367, 183, 603, 301, 150, 75, 37, 530, 265, 132,
+    66, 33, 528, 264, 644, 322, 161, 592, 296, 660, 330, 677, 850, 425, 212, 106,
+    565, 794, 909, 454, 227, 625, 824, 924, 974, 999, 1011, 1017, 508, 766, 895, 447,
+    223, 111, 55, 539, 269, 134, 67, 545, 784, 392, 708, 354, 177, 600, 812, 918,
+    459, 229, 626, 313, 156, 590, 807, 915, 969, 484, 242, 121, 60, 542, 783, 391,
+    707, 865, 944, 472, 748, 886, 443, 221, 110, 567, 795, 397, 198, 99, 561, 792,
+    908, 966, 483, 753, 888, 956, 990, 1007, 503, 763, 381, 190, 607, 303, 151, 587,
+    293, 658, 329, 164, 82, 41, 20, 10, 517, 770, 385, 704, 352, 176, 88, 556,
+    790, 395, 197, 610, 305, 664, 844, 934, 467, 745, 372, 186, 605, 302, 663, 843,
+    421, 722, 361, 180, 90, 557, 278, 139, 69, 546, 273, 648, 836, 418, 209, 616,
+    820, 410, 717, 358, 179, 601, 300, 662, 331, 165, 594, 297, 148, 74, 549, 786,
+    393, 196, 98, 49, 536, 780, 902, 451, 737, 880, 440, 732, 878, 951, 987, 493,
+    246, 123, 61, 30, 527, 263, 643, 833, 928, 464, 232, 628, 314, 669, 334, 679,
+    851, 937, 468, 234, 629, 826, 925, 462, 743, 883, 953, 476, 750, 887, 955, 477,
+    238, 631, 827, 413, 206, 615, 819, 921, 460, 742, 371, 697, 348, 686, 855, 939,
+    469, 746, 885, 954, 989, 494, 759, 891, 445, 222, 623, 311, 667, 333, 166, 83,
+    553, 276, 138, 581, 802, 401, 712, 868, 434, 217, 108, 566, 283, 141, 70, 35,
+    529, 776, 900, 450, 225, 624, 312, 668, 846, 935, 979, 1001, 500, 250, 637, 318,
+    671, 335, 167, 595, 809, 404, 202, 613, 818, 409, 204, 614, 307, 665, 332, 678,
+    339, 681, 340, 170, 597, 810, 917, 970, 997, 1010, 505, 252, 638, 831, 415, 207,
+    103, 563, 793, 396, 710, 355, 689, 856, 940, 982, 491, 245, 634, 829, 414, 719,
+    359, 691, 857, 428, 726, 363, 181, 602, 813, 406, 203, 101, 562, 281, 140, 582,
+    291, 657, 840, 932, 466, 233, 116, 58, 541, 270, 647, 835, 929, 976, 488, 756,
+    378, 701, 350, 687, 343, 683, 341, 682, 853, 938, 981, 1002, 1013, 1018, 1021, 510,
+    767, 383, 191, 95, 47, 23, 523, 261, 642, 321, 672, 336, 168, 596, 298, 661,
+    842, 933, 978, 489, 244, 122, 573, 286, 655, 327, 675, 849, 936, 980, 490, 757,
+    890, 957, 478, 751, 375, 699, 349, 174, 599, 811, 405, 714, 869, 946, 473, 236,
+    630, 315, 157, 78, 551, 787, 905, 452, 226, 113, 568, 796, 910, 967, 995, 1009,
+    1016, 1020, 1022, 1023, 511, 255, 127, 63, 31, 15, 7, 515, 769, 896, 448, 224,
+    112, 56, 540, 782, 903, 963, 993, 1008, 504, 764, 894, 959, 479, 239, 119, 571,
+    285, 142, 583, 803, 913, 968, 996, 498, 249, 124, 574, 799, 399, 199, 611, 817,
+    920, 972, 998, 499, 761, 380, 702, 863, 431, 215, 619, 309, 666, 845, 422, 211,
+    617, 308, 154, 589, 294, 147, 585, 292, 146, 73, 36, 18, 9, 4, 2,
+};
+
+const uint16_t mls_output_perm[MLS_LENGTH] = {
+    1, 516, 258, 129, 580, 290, 145, 588, 294, 147, 589, 802, 401, 716, 358, 179,
+    605, 810, 405, 718, 359, 695, 863, 939, 977, 1004, 502, 251, 633, 824, 412, 206,
+    103, 567, 799, 907, 961, 996, 498, 249, 632, 316, 158, 79, 547, 789, 910, 455,
+    743, 887, 959, 987, 1001, 1008, 504, 252, 126, 63, 539, 777, 896, 448, 224, 112,
+    56, 28, 14, 7, 519, 775, 903, 967, 999, 1015, 1023, 1019, 1017, 1016, 508, 254,
+    127, 571, 793, 904, 452, 226, 113, 572, 286, 143, 579, 805, 918, 459, 737, 884,
+    442, 221, 618, 309, 670, 335, 675, 853, 942, 471, 751, 883, 957, 986, 493, 754,
+    377, 696, 348, 174, 87, 559, 787, 909, 962, 481, 756, 378, 189, 602, 301, 658,
+    329, 672, 336, 168, 84, 42, 21, 526, 263, 647, 839, 935, 983, 1007, 1011, 1021,
+    1018, 509, 762, 381, 698, 349, 682, 341, 686, 343, 687, 851, 941, 978, 489, 752,
+    376, 188, 94, 47, 531, 781, 898, 449, 740, 370, 185, 600, 300, 150, 75, 545,
+    788, 394, 197, 614, 307, 669, 842, 421, 726, 363, 689, 860, 430, 215, 623, 819,
+    925, 970, 485, 758, 379, 697, 856, 428, 214, 107, 561, 796, 398, 199, 615, 823,
+    927, 971, 993, 1012, 506, 253, 634, 317, 666, 333, 674, 337, 684, 342, 171, 593,
+    812, 406, 203, 609, 820, 410, 205, 610, 305, 668, 334, 167, 599, 815, 915, 973,
+    994, 497, 764, 382, 191, 603, 809, 912, 456, 228, 114, 57, 536, 268, 134, 67,
+    549, 790, 395, 705, 868, 434, 217, 616, 308, 154, 77, 546, 273, 652, 326, 163,
+    597, 814, 407, 719, 867, 949, 990, 495, 755, 893, 954, 477, 746, 373, 702, 351,
+    683, 849, 940, 470, 235, 625, 828, 414, 207, 611, 821, 926, 463, 739, 885, 958,
+    479, 747, 881, 956, 478, 239, 627, 829, 922, 461, 738, 369, 700, 350, 175, 595,
+    813, 914, 457, 736, 368, 184, 92, 46, 23, 527, 771, 901, 966, 483, 757, 894,
+    447, 731, 873, 944, 472, 236, 118, 59, 537, 776, 388, 194, 97, 564, 282, 141,
+    578, 289, 660, 330, 165, 598, 299, 657, 844, 422, 211, 621, 818, 409, 712, 356,
+    178, 89, 552, 276, 138, 69, 550, 275, 653, 834, 417, 724, 362, 181, 606, 303,
+    659, 845, 930, 465, 748, 374, 187, 601, 808, 404, 202, 101, 566, 283, 649, 832,
+    416, 208, 104, 52, 26, 13, 514, 257, 644, 322, 161, 596, 298, 149, 590, 295,
+    663, 847, 931, 981, 1006, 503, 767, 891, 953, 984, 492, 246, 123, 569, 792, 396,
+    198, 99, 565, 798, 399, 707, 869, 950, 475, 745, 880, 440, 220, 110, 55, 543,
+    779, 897, 964, 482, 241, 636, 318, 159, 587, 801, 916, 458, 229, 630, 315, 665,
+    840, 420, 210, 105, 560, 280, 140, 70, 35, 533, 782, 391, 711, 871, 951, 991,
+    1003, 1009, 1020, 510, 255, 635, 825, 920, 460, 230, 115, 573, 794, 397, 706, 353,
+    692, 346, 173, 594, 297, 656, 328, 164, 82, 41, 528, 264, 132, 66, 33, 532,
+    266, 133, 582, 291, 661, 846, 423, 727, 879, 947, 989, 1002, 501, 766, 383, 699,
+    857, 936, 468, 234, 117, 574, 287, 651, 833, 932, 466, 233, 624, 312, 156, 78,
+    39, 535, 783, 899, 965, 998, 499, 765, 890, 445, 730, 365, 690, 345, 680, 340,
+    170, 85, 558, 279, 655, 835, 933, 982, 491, 753, 892, 446, 223, 619, 817, 924,
+    462, 231, 631, 831, 923, 969, 992, 496, 248, 124, 62, 31, 523, 769, 900, 450,
+    225, 628, 314, 157, 586, 293, 662, 331, 673, 852, 426, 213, 622, 311, 671, 843,
+    929, 980, 490, 245, 638, 319, 667, 841, 928, 464, 232, 116, 58, 29, 522, 261,
+    646, 323, 677, 854, 427, 721, 876, 438, 219, 617, 816, 408, 204, 102, 51, 541,
+    778, 389, 710, 355, 693, 862, 431, 723, 877, 946, 473, 744, 372, 186, 93, 554,
+    277, 654, 327, 679, 855, 943, 979, 1005, 1010, 505, 760, 380, 190, 95, 555, 785,
+    908, 454, 227, 629, 830, 415, 715, 865, 948, 474, 237, 626, 313, 664, 332, 166,
+    83, 557, 786, 393, 704, 352, 176, 88, 44, 22, 11, 513, 772, 386, 193, 612,
+    306, 153, 584, 292, 146, 73, 544, 272, 136, 68, 34, 17, 524, 262, 131, 581,
+    806, 403, 717, 866, 433, 732, 366, 183, 607, 811, 913, 972, 486, 243, 637, 826,
+    413, 714, 357, 694, 347, 681, 848, 424, 212, 106, 53, 542, 271, 643, 837, 934,
+    467, 749, 882, 441, 728, 364, 182, 91, 553, 784, 392, 196, 98, 49, 540, 270,
+    135, 583, 807, 919, 975, 995, 1013, 1022, 511, 763, 889, 952, 476, 238, 119, 575,
+    795, 905, 960, 480, 240, 120, 60, 30, 15, 515, 773, 902, 451, 741, 886, 443,
+    729, 872, 436, 218, 109, 562, 281, 648, 324, 162, 81, 556, 278, 139, 577, 804,
+    402, 201, 608, 304, 152, 76, 38, 19, 525, 770, 385, 708, 354, 177, 604, 302,
+    151, 591, 803, 917, 974, 487, 759, 895, 955, 985, 1000, 500, 250, 125, 570, 285,
+    650, 325, 678, 339, 685, 850, 425, 720, 360, 180, 90, 45, 530, 265, 640, 320,
+    160, 80, 40, 20, 10, 5, 518, 259, 645, 838, 419, 725, 878, 439, 735, 875,
+    945, 988, 494, 247, 639, 827, 921, 968, 484, 242, 121, 568, 284, 142, 71, 551,
+    791, 911, 963, 997, 1014, 507, 761, 888, 444, 222, 111, 563, 797, 906, 453, 742,
+    371, 701, 858, 429, 722, 361, 688, 344, 172, 86, 43, 529, 780, 390, 195, 613,
+    822, 411, 713, 864, 432, 216, 108, 54, 27, 521, 768, 384, 192, 96, 48, 24,
+    12, 6, 3, 517, 774, 387, 709, 870, 435, 733, 874, 437, 734, 367, 691, 861,
+    938, 469, 750, 375, 703, 859, 937, 976, 488, 244, 122, 61, 538, 269, 642, 321,
+    676, 338, 169, 592, 296, 148, 74, 37, 534, 267, 641, 836, 418, 209, 620, 310,
+    155, 585, 800, 400, 200, 100, 50, 25, 520, 260, 130, 65, 548, 274, 137, 576,
+    288, 144, 72, 36, 18, 9, 512, 256, 128, 64, 32, 16, 8, 4, 2,
+};
@@ -0,0 +1,136 @@
+#include "multitaper.h"
+#include <math.h> // sqrtf
+
+#if (MULTITAPER_K % 2) != 0 || MULTITAPER_K < 2
+#error "MULTITAPER_K 必须为不小于 2 的偶数"
+#endif
+
+// 自适应加权的迭代次数 (通常 2~3 次即收敛)
+#define MULTITAPER_ADAPTIVE_ITERATIONS 3
+
+// --- 私有辅助函数 ---
+
+/**
+ * @brief 由表中的前半部分还原第 k 个窗函数在位置 i 的值 (偶数窗对称，奇数窗反对称)。
+ */
+static float dpss_value(uint32_t k, uint32_t i)
+{
+    const uint32_t n = MULTITAPER_N;
+    if (i < n / 2)
+    {
+        return dpss_half_tapers[k][i];
+    }
+    float mirror = dpss_half_tapers[k][n - 1 - i];
+    return (k & 1) ? -mirror : mirror;
+}
+
+/**
+ * @brief 读取第 k 个窗在频点 bin 的特征谱。
+ */
+static float eigen_spectrum(const complex_t *work, const complex_t *eigen_store, uint32_t k, uint32_t bin)
+{
+    uint32_t pair = k / 2;
+    const complex_t *slot = (pair < MULTITAPER_K / 2 - 1)
+                                ? &eigen_store[pair * (MULTITAPER_N / 2) + bin]
+                                : &work[bin]; // 最后一对留在 work 中
+    return (k & 1) ? slot->imag : slot->real;
+}
+
+// --- 公共函数 ---
+
+/**
+ * @brief Thomson 多窗谱估计。
+ */
+void multitaper_estimate(const float *x, complex_t *work, complex_t *eigen_store,
+                         multitaper_weighting_t weighting, float *magnitudes)
+{
+    const uint32_t n = MULTITAPER_N;
+
+    // --- 1. 每次复数 FFT 处理一对窗: z = v_a * x + j * v_b * x ---
+    for (uint32_t pair = 0; pair < MULTITAPER_K / 2; pair++)
+    {
+        uint32_t ka = 2 * pair;
+        uint32_t kb = 2 * pair + 1;
+        for (uint32_t i = 0; i < n; i++)
+        {
+            work[i].real = dpss_value(ka, i) * x[i];
+            work[i].imag = dpss_value(kb, i) * x[i];
+        }
+
+        fft_radix2(work, n);
+
+        // 分离两路频谱: A = (Z[k] + conj(Z[n-k])) / 2, B = (Z[k] - conj(Z[n-k])) / 2j
+        // 只写入 k < n/2 的位置，而读取的 Z[n-k] 位于后半部分，因此可以原地写回
+        int last_pair = (pair == MULTITAPER_K / 2 - 1);
+        complex_t *dest = last_pair ? work : &eigen_store[pair * (n / 2)];
+        for (uint32_t k = 0; k < n / 2; k++)
+        {
+            complex_t a = work[k];
+            complex_t b = work[(n - k) & (n - 1)];
+            float ar = 0.5f * (a.real + b.real);
+            float ai = 0.5f * (a.imag - b.imag);
+            float br = 0.5f * (a.imag + b.imag);
+            float bi = 0.5f * (b.real - a.real);
+            dest[k].real = ar * ar + ai * ai;
+            dest[k].imag = br * br + bi * bi;
+        }
+    }
+
+    // --- 2. 自适应加权需要的数据方差 (白噪声下各特征谱的期望值) ---
+    float variance = 0.0f;
+    if (weighting == MULTITAPER_WEIGHTS_ADAPTIVE)
+    {
+        float mean = 0.0f;
+        for (uint32_t i = 0; i < n; i++)
+        {
+            mean += x[i];
+        }
+        mean /= (float)n;
+        for (uint32_t i = 0; i < n; i++)
+        {
+            float d = x[i] - mean;
+            variance += d * d;
+        }
+        variance /= (float)n;
+    }
+
+    // --- 3. 合成特征谱 ---
+    float inv_n = 1.0f / (float)n;
+    for (uint32_t bin = 0; bin < n / 2; bin++)
+    {
+        float spectra[MULTITAPER_K];
+        float estimate = 0.0f;
+        for (uint32_t k = 0; k < MULTITAPER_K; k++)
+        {
+            spectra[k] = eigen_spectrum(work, eigen_store, k, bin);
+            estimate += spectra[k];
+        }
+        estimate /= (float)MULTITAPER_K;
+
+        if (weighting == MULTITAPER_WEIGHTS_ADAPTIVE)
+        {
+            // Thomson 自适应权重: d_k = sqrt(l_k) S / (l_k S + (1 - l_k) sigma^2)
+            estimate = 0.5f * (spectra[0] + spectra[1]);
+            for (uint32_t iter = 0; iter < MULTITAPER_ADAPTIVE_ITERATIONS; iter++)
+            {
+                float numerator = 0.0f;
+                float denominator = 0.0f;
+                for (uint32_t k = 0; k < MULTITAPER_K; k++)
+                {
+                    float lambda = dpss_eigenvalues[k];
+                    float d = lambda * estimate + (1.0f - lambda) * variance;
+                    float weight_sq = (d > 0.0f) ? lambda * estimate * estimate / (d * d) : 0.0f;
+                    numerator += weight_sq * spectra[k];
+                    denominator += weight_sq;
+                }
+                if (denominator <= 0.0f)
+                {
+                    break;
+                }
+                estimate = numerator / denominator;
+            }
+        }
+
+        magnitudes[bin] = sqrtf(estimate * inv_n);
+    }
+}
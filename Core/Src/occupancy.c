@@ -0,0 +1,52 @@
+#include "occupancy.h"
+#include <math.h>   // powf, log10f
+#include <string.h> // memset
+
+#define OCCUPANCY_LEVEL_FLOOR 1e-9f // 转换为 dB 时的幅度下限
+
+/**
+ * @brief 清空统计并设置门限。
+ */
+void occupancy_reset(occupancy_t *occupancy, float threshold_db)
+{
+    memset(occupancy, 0, sizeof(*occupancy));
+    occupancy->threshold = powf(10.0f, threshold_db / 20.0f);
+}
+
+/**
+ * @brief 用一帧幅度谱更新计数和最大值。
+ */
+void occupancy_update(occupancy_t *occupancy, const float *magnitudes)
+{
+    float threshold = occupancy->threshold;
+    for (uint32_t k = 0; k < OCCUPANCY_BINS; k++)
+    {
+        float level = magnitudes[k];
+        occupancy->above_count[k] += (level > threshold);
+        if (level > occupancy->max_level[k])
+        {
+            occupancy->max_level[k] = level;
+        }
+    }
+    occupancy->frames++;
+}
+
+/**
+ * @brief 频点的占空比。
+ */
+float occupancy_duty_cycle(const occupancy_t *occupancy, uint32_t bin)
+{
+    if (occupancy->frames == 0)
+    {
+        return 0.0f;
+    }
+    return (float)occupancy->above_count[bin] / (float)occupancy->frames;
+}
+
+/**
+ * @brief 频点的最大电平 (dB)。
+ */
+float occupancy_max_db(const occupancy_t *occupancy, uint32_t bin)
+{
+    return 20.0f * log10f(occupancy->max_level[bin] + OCCUPANCY_LEVEL_FLOOR);
+}
@@ -0,0 +1,130 @@
+#include "octave_bands.h"
+#include <math.h> // powf, log10f, sqrtf, ceilf
+
+// IEC 61260 以 10 为底的倍频程比 G = 10^(3/10)
+#define OCTAVE_RATIO_BASE10 1.99526231f
+// 频带声级的下限，防止对 0 取对数
+#define OCTAVE_POWER_FLOOR 1e-20f
+
+// --- 私有辅助函数 ---
+
+/**
+ * @brief 计算 IEC 61672 频率计权的功率系数 (|H(f)|^2，已含 1 kHz 归一化)。
+ * @param weighting: 计权类型。
+ * @param f: 频率 (Hz)。
+ * @return 线性功率计权系数。
+ */
+static float weighting_power_gain(freq_weighting_t weighting, float f)
+{
+    const float f1_sq = 20.598997f * 20.598997f;
+    const float f2_sq = 107.65265f * 107.65265f;
+    const float f3_sq = 737.86223f * 737.86223f;
+    const float f4_sq = 12194.217f * 12194.217f;
+    float f_sq = f * f;
+
+    switch (weighting)
+    {
+    case FREQ_WEIGHTING_A:
+    {
+        // R_A(f) = f4^2 f^4 / ((f^2+f1^2) sqrt((f^2+f2^2)(f^2+f3^2)) (f^2+f4^2))，A(1k) 偏移 +2.00 dB
+        float r = f4_sq * f_sq * f_sq /
+                  ((f_sq + f1_sq) * sqrtf((f_sq + f2_sq) * (f_sq + f3_sq)) * (f_sq + f4_sq));
+        return r * r * 1.58489319f;
+    }
+    case FREQ_WEIGHTING_C:
+    {
+        // R_C(f) = f4^2 f^2 / ((f^2+f1^2)(f^2+f4^2))，C(1k) 偏移 +0.06 dB
+        float r = f4_sq * f_sq / ((f_sq + f1_sq) * (f_sq + f4_sq));
+        return r * r * 1.01391139f;
+    }
+    case FREQ_WEIGHTING_Z:
+    default:
+        return 1.0f;
+    }
+}
+
+// --- 公共函数 ---
+
+/**
+ * @brief 构建分数倍频程频带计划。
+ */
+uint32_t octave_plan_init(octave_plan_t *plan, uint32_t n, float sample_rate,
+                          uint32_t fraction, freq_weighting_t weighting)
+{
+    plan->num_bands = 0;
+    if (n == 0 || n > FFT_N || (n & (n - 1)) != 0 || sample_rate <= 0.0f ||
+        (fraction != 1 && fraction != 3 && fraction != 6))
+    {
+        return 0;
+    }
+
+    plan->n = n;
+    plan->sample_rate = sample_rate;
+    plan->fraction = fraction;
+    plan->weighting = weighting;
+
+    float bin_spacing = sample_rate / (float)n;
+    float nyquist = sample_rate / 2.0f;
+    float half_band = powf(OCTAVE_RATIO_BASE10, 1.0f / (2.0f * (float)fraction));
+
+    // --- 1. 频点 -> 频带索引表 ---
+    // 奇数分数的中心频率为 1k * G^(k/b)，偶数分数为 1k * G^((2k+1)/2b)
+    float upper_edge = 0.0f;
+    for (int32_t k = -10 * (int32_t)fraction; plan->num_bands < OCTAVE_MAX_BANDS; k++)
+    {
+        float exponent = (fraction & 1) ? (float)k / (float)fraction
+                                        : (float)(2 * k + 1) / (2.0f * (float)fraction);
+        float center = 1000.0f * powf(OCTAVE_RATIO_BASE10, exponent);
+        float lower = center / half_band;
+        float upper = center * half_band;
+
+        if (upper > nyquist)
+        {
+            break; // 上边界超出奈奎斯特频率
+        }
+        if (upper - lower < bin_spacing)
+        {
+            continue; // 频带比频点间隔还窄，无法用 FFT 频点表示
+        }
+
+        plan->band_start[plan->num_bands] = (uint16_t)ceilf(lower / bin_spacing);
+        plan->center_freq[plan->num_bands] = center;
+        plan->num_bands++;
+        upper_edge = upper;
+    }
+    if (plan->num_bands == 0)
+    {
+        return 0;
+    }
+    plan->band_start[plan->num_bands] = (uint16_t)ceilf(upper_edge / bin_spacing);
+    if (plan->band_start[plan->num_bands] > n / 2)
+    {
+        plan->band_start[plan->num_bands] = (uint16_t)(n / 2);
+    }
+
+    // --- 2. 每个频点的计权系数 ---
+    for (uint32_t i = 0; i < n / 2; i++)
+    {
+        plan->bin_weight[i] = weighting_power_gain(weighting, (float)i * bin_spacing);
+    }
+
+    return plan->num_bands;
+}
+
+/**
+ * @brief 将 FFT 幅度聚合为分数倍频程频带声级。
+ */
+void octave_bands_compute(const octave_plan_t *plan, const float *magnitudes, float *band_levels_db)
+{
+    for (uint32_t band = 0; band < plan->num_bands; band++)
+    {
+        float power = 0.0f;
+        for (uint32_t i = plan->band_start[band]; i < plan->band_start[band + 1]; i++)
+        {
+            power += magnitudes[i] * magnitudes[i] * plan->bin_weight[i];
+        }
+        // 单边幅度谱: 幅度为 A 的正弦在对应频点的值为 A/2，有效值平方为 A^2/2 = 2 * (A/2)^2
+        power *= 2.0f;
+        band_levels_db[band] = 10.0f * log10f(power + OCTAVE_POWER_FLOOR);
+    }
+}
@@ -0,0 +1,486 @@
+#include "siggen.h"
+#include <math.h>   // powf, logf, expf, fabsf, sinf, cosf
+#include <string.h> // memset
+
+#define SIGGEN_DEFAULT_SEED 2463534242u
+#define SIGGEN_PHASE_SCALE (1.0f / 4294967296.0f) // 相位 (2^32 一周) 转换为 0 ~ 1
+#define SIGGEN_ZIGGURAT_R 3.442620f               // 最底层右边界
+#define SIGGEN_ROTATOR_BLOCK 64                   // 多音递推每隔多少采样由 DDS 相位重新取初值 (限制舍入误差累积)
+#define SIGGEN_QUARTER_CYCLE 0x40000000u          // 90 度相位 (sin 查表取 cos)
+#define SIGGEN_PINK_GAIN 0.329f                   // 粉红噪声滤波器输出归一化 (单位方差输入时滤波器输出 RMS 约 3.04)
+
+// --- 私有辅助函数 ---
+
+/**
+ * @brief (0, 1) 均匀分布随机数。
+ */
+static float uniform_open(uint32_t *state)
+{
+    return ((float)(siggen_xorshift32(state) >> 8) + 0.5f) * (1.0f / 16777216.0f);
+}
+
+/**
+ * @brief PolyBLEP 残差 (幅度为 2 的阶跃): 在跳变前后各一个采样内平滑阶跃，抑制混叠。
+ * @param t: 当前相位 (0 ~ 1，跳变位于 t = 0)。
+ * @param dt: 每个采样的相位增量 (f / fs)。
+ */
+static float poly_blep(float t, float dt)
+{
+    if (t < dt)
+    {
+        t /= dt;
+        return t + t - t * t - 1.0f;
+    }
+    if (t > 1.0f - dt)
+    {
+        t = (t - 1.0f) / dt;
+        return t * t + t + t + 1.0f;
+    }
+    return 0.0f;
+}
+
+/**
+ * @brief PolyBLAMP 残差 (每采样斜率变化 2，即 PolyBLEP 的积分): 平滑斜率跳变 (三角波的拐点)。
+ */
+static float poly_blamp(float t, float dt)
+{
+    if (t < dt)
+    {
+        t = t / dt - 1.0f;
+        return -(1.0f / 3.0f) * t * t * t;
+    }
+    if (t > 1.0f - dt)
+    {
+        t = (t - 1.0f) / dt + 1.0f;
+        return (1.0f / 3.0f) * t * t * t;
+    }
+    return 0.0f;
+}
+
+/**
+ * @brief Ziggurat 的慢速路径: 楔形区域内拒绝采样，最底层落入尾部时按指数分布采样。
+ */
+static float gaussian_slow_path(uint32_t *state, int32_t hz, uint32_t iz)
+{
+    for (;;)
+    {
+        float x = (float)hz * siggen_ziggurat_w[iz];
+        if (iz == 0)
+        {
+            float y;
+            do
+            {
+                x = -logf(uniform_open(state)) * (1.0f / SIGGEN_ZIGGURAT_R);
+                y = -logf(uniform_open(state));
+            } while (y + y < x * x);
+            return (hz > 0) ? SIGGEN_ZIGGURAT_R + x : -SIGGEN_ZIGGURAT_R - x;
+        }
+        float f_hi = siggen_ziggurat_f[iz - 1];
+        float f_lo = siggen_ziggurat_f[iz];
+        if (f_lo + uniform_open(state) * (f_hi - f_lo) < expf(-0.5f * x * x))
+        {
+            return x;
+        }
+
+        hz = (int32_t)siggen_xorshift32(state);
+        iz = (uint32_t)hz & (SIGGEN_ZIGGURAT_LAYERS - 1);
+        uint32_t magnitude = (hz < 0) ? 0u - (uint32_t)hz : (uint32_t)hz;
+        if (magnitude < siggen_ziggurat_k[iz])
+        {
+            return (float)hz * siggen_ziggurat_w[iz];
+        }
+    }
+}
+
+/**
+ * @brief 限带方波、三角波、锯齿波。
+ */
+static void generate_blep(siggen_t *gen, float *buffer, uint32_t len)
+{
+    uint32_t phase = gen->carrier.phase;
+    uint32_t step = gen->carrier.phase_step;
+    float dt = (float)step * SIGGEN_PHASE_SCALE;
+    float amplitude = gen->amplitude;
+    float offset = gen->offset;
+
+    switch (gen->waveform)
+    {
+    case SIGGEN_SQUARE:
+        for (uint32_t i = 0; i < len; i++)
+        {
+            float t = (float)phase * SIGGEN_PHASE_SCALE;
+            float t_half = (float)(phase + 0x80000000u) * SIGGEN_PHASE_SCALE;
+            float v = (phase < 0x80000000u) ? 1.0f : -1.0f;
+            v += poly_blep(t, dt) - poly_blep(t_half, dt);
+            buffer[i] = amplitude * v + offset;
+            phase += step;
+        }
+        break;
+    case SIGGEN_TRIANGLE:
+        for (uint32_t i = 0; i < len; i++)
+        {
+            // 拐点位于 t = 0.25 (正峰) 和 t = 0.75 (负峰)，与正弦同相
+            float t_peak = (float)(phase - SIGGEN_QUARTER_CYCLE) * SIGGEN_PHASE_SCALE;
+            float t_trough = (float)(phase + SIGGEN_QUARTER_CYCLE) * SIGGEN_PHASE_SCALE;
+            float v = 4.0f * fabsf(t_peak - 0.5f) - 1.0f;
+            // 拐点处斜率变化 ±8 dt (每采样)，poly_blamp 按斜率变化 2 归一化
+            v += 4.0f * dt * (poly_blamp(t_trough, dt) - poly_blamp(t_peak, dt));
+            buffer[i] = amplitude * v + offset;
+            phase += step;
+        }
+        break;
+    case SIGGEN_SAW:
+    default:
+        for (uint32_t i = 0; i < len; i++)
+        {
+            float t = (float)(phase + 0x80000000u) * SIGGEN_PHASE_SCALE; // 从 0 开始上升，跳变在半周期处
+            buffer[i] = amplitude * (2.0f * t - 1.0f - poly_blep(t, dt)) + offset;
+            phase += step;
+        }
+        break;
+    }
+    gen->carrier.phase = phase;
+}
+
+/**
+ * @brief 多音叠加: 每个分量用复数旋转递推 (每采样 4 次乘法，无查表)，
+ *        每 SIGGEN_ROTATOR_BLOCK 个采样由 DDS 相位重新取初值，误差不随帧长累积。
+ */
+static void generate_multitone(siggen_t *gen, float *buffer, uint32_t len)
+{
+    for (uint32_t i = 0; i < len; i++)
+    {
+        buffer[i] = gen->offset;
+    }
+    for (uint32_t k = 0; k < gen->num_tones; k++)
+    {
+        uint32_t phase = gen->tone_phase[k];
+        uint32_t step = gen->tone_step[k];
+        float amplitude = gen->amplitude * gen->tone_amp[k];
+        float c = gen->tone_cos[k];
+        float s = gen->tone_sin[k];
+
+        for (uint32_t start = 0; start < len; start += SIGGEN_ROTATOR_BLOCK)
+        {
+            uint32_t count = (len - start < SIGGEN_ROTATOR_BLOCK) ? len - start : SIGGEN_ROTATOR_BLOCK;
+            float x = amplitude * dds_sin(phase + SIGGEN_QUARTER_CYCLE); // A cos(phase)
+            float y = amplitude * dds_sin(phase);                        // A sin(phase)
+            float *out = &buffer[start];
+            for (uint32_t i = 0; i < count; i++)
+            {
+                out[i] += y;
+                float x_next = x * c - y * s;
+                y = x * s + y * c;
+                x = x_next;
+            }
+            phase += step * count;
+        }
+        gen->tone_phase[k] = phase;
+    }
+}
+
+/**
+ * @brief 线性或对数扫频，到达终点后回到起点重新开始。
+ */
+static void generate_chirp(siggen_t *gen, float *buffer, uint32_t len)
+{
+    uint32_t phase = gen->carrier.phase;
+    uint32_t position = gen->sweep_position;
+    uint32_t length = gen->sweep_length;
+    float amplitude = gen->amplitude;
+    float offset = gen->offset;
+    uint8_t logarithmic = (gen->waveform == SIGGEN_CHIRP_LOG);
+
+    // 每块开始时由位置重新计算增量，避免逐采样累乘/累加的舍入误差随扫频时长增长
+    float step = logarithmic ? gen->chirp_start_step * powf(gen->chirp_ratio, (float)position)
+                             : gen->chirp_start_step + gen->chirp_increment * (float)position;
+
+    for (uint32_t i = 0; i < len; i++)
+    {
+        buffer[i] = amplitude * dds_sin(phase) + offset;
+        phase += (uint32_t)step;
+        if (++position >= length)
+        {
+            position = 0;
+            step = gen->chirp_start_step;
+        }
+        else if (logarithmic)
+        {
+            step *= gen->chirp_ratio;
+        }
+        else
+        {
+            step += gen->chirp_increment;
+        }
+    }
+    gen->carrier.phase = phase;
+    gen->sweep_position = position;
+}
+
+/**
+ * @brief 调幅或调频。
+ */
+static void generate_modulated(siggen_t *gen, float *buffer, uint32_t len)
+{
+    uint32_t phase = gen->carrier.phase;
+    uint32_t step = gen->carrier.phase_step;
+    uint32_t mod_phase = gen->modulator.phase;
+    uint32_t mod_step = gen->modulator.phase_step;
+    float amplitude = gen->amplitude;
+    float offset = gen->offset;
+
+    if (gen->waveform == SIGGEN_AM)
+    {
+        float depth = gen->depth;
+        for (uint32_t i = 0; i < len; i++)
+        {
+            buffer[i] = amplitude * (1.0f + depth * dds_sin(mod_phase)) * dds_sin(phase) + offset;
+            phase += step;
+            mod_phase += mod_step;
+        }
+    }
+    else
+    {
+        float deviation = (float)gen->fm_deviation_step;
+        for (uint32_t i = 0; i < len; i++)
+        {
+            buffer[i] = amplitude * dds_sin(phase) + offset;
+            phase += step + (uint32_t)(int32_t)(deviation * dds_sin(mod_phase));
+            mod_phase += mod_step;
+        }
+    }
+    gen->carrier.phase = phase;
+    gen->modulator.phase = mod_phase;
+}
+
+/**
+ * @brief 白噪声 (均匀或高斯) 和粉红噪声。
+ */
+static void generate_noise(siggen_t *gen, float *buffer, uint32_t len)
+{
+    uint32_t state = gen->rng_state;
+    float amplitude = gen->amplitude;
+    float offset = gen->offset;
+
+    switch (gen->waveform)
+    {
+    case SIGGEN_NOISE_WHITE:
+        for (uint32_t i = 0; i < len; i++)
+        {
+            // 高 24 位映射到 [-1, 1)
+            float u = (float)(int32_t)siggen_xorshift32(&state) * (1.0f / 2147483648.0f);
+            buffer[i] = amplitude * u + offset;
+        }
+        break;
+    case SIGGEN_NOISE_PINK:
+    {
+        // Paul Kellet 精化滤波器: 7 个一阶段之和，9 Hz 以上在 ±0.05 dB 内逼近 -3 dB/倍频程
+        float *b = gen->pink_state;
+        for (uint32_t i = 0; i < len; i++)
+        {
+            float white = siggen_gaussian(&state);
+            b[0] = 0.99886f * b[0] + white * 0.0555179f;
+            b[1] = 0.99332f * b[1] + white * 0.0750759f;
+            b[2] = 0.96900f * b[2] + white * 0.1538520f;
+            b[3] = 0.86650f * b[3] + white * 0.3104856f;
+            b[4] = 0.55000f * b[4] + white * 0.5329522f;
+            b[5] = -0.7616f * b[5] - white * 0.0168980f;
+            float pink = b[0] + b[1] + b[2] + b[3] + b[4] + b[5] + b[6] + white * 0.5362f;
+            b[6] = white * 0.115926f;
+            buffer[i] = amplitude * SIGGEN_PINK_GAIN * pink + offset;
+        }
+        break;
+    }
+    case SIGGEN_NOISE_GAUSSIAN:
+    default:
+        for (uint32_t i = 0; i < len; i++)
+        {
+            buffer[i] = amplitude * siggen_gaussian(&state) + offset;
+        }
+        break;
+    }
+    gen->rng_state = state;
+}
+
+// --- 公共函数 ---
+
+/**
+ * @brief xorshift32 (Marsaglia 2003, 13/17/5)。
+ */
+uint32_t siggen_xorshift32(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+/**
+ * @brief Ziggurat 正态分布采样。
+ */
+float siggen_gaussian(uint32_t *state)
+{
+    int32_t hz = (int32_t)siggen_xorshift32(state);
+    uint32_t iz = (uint32_t)hz & (SIGGEN_ZIGGURAT_LAYERS - 1);
+    uint32_t magnitude = (hz < 0) ? 0u - (uint32_t)hz : (uint32_t)hz;
+    if (magnitude < siggen_ziggurat_k[iz])
+    {
+        return (float)hz * siggen_ziggurat_w[iz]; // 快速路径: 落在矩形内部
+    }
+    return gaussian_slow_path(state, hz, iz);
+}
+
+/**
+ * @brief 初始化发生器。
+ */
+void siggen_init(siggen_t *gen, uint32_t seed)
+{
+    memset(gen, 0, sizeof(*gen));
+    gen->waveform = SIGGEN_SINE;
+    gen->amplitude = 1.0f;
+    gen->sweep_length = 1;
+    gen->rng_state = (seed != 0) ? seed : SIGGEN_DEFAULT_SEED;
+}
+
+/**
+ * @brief 应用配置，保持相位。
+ */
+uint8_t siggen_configure(siggen_t *gen, const siggen_config_t *config, float sample_rate)
+{
+    float nyquist = 0.5f * sample_rate;
+    siggen_waveform_t waveform = config->waveform;
+
+    // --- 1. 参数检查 ---
+    switch (waveform)
+    {
+    case SIGGEN_SINE:
+    case SIGGEN_SQUARE:
+    case SIGGEN_TRIANGLE:
+    case SIGGEN_SAW:
+        if (config->freq <= 0.0f || config->freq >= nyquist)
+        {
+            return 0;
+        }
+        break;
+    case SIGGEN_MULTITONE:
+        if (config->num_tones == 0 || config->num_tones > SIGGEN_MAX_TONES)
+        {
+            return 0;
+        }
+        for (uint32_t k = 0; k < config->num_tones; k++)
+        {
+            if (config->tone_freqs[k] <= 0.0f || config->tone_freqs[k] >= nyquist)
+            {
+                return 0;
+            }
+        }
+        break;
+    case SIGGEN_CHIRP_LINEAR:
+    case SIGGEN_CHIRP_LOG:
+        if (config->freq <= 0.0f || config->freq >= nyquist || config->freq2 <= 0.0f ||
+            config->freq2 >= nyquist || config->sweep_time * sample_rate < 2.0f)
+        {
+            return 0;
+        }
+        break;
+    case SIGGEN_AM:
+        if (config->freq <= 0.0f || config->freq >= nyquist || config->freq2 <= 0.0f ||
+            config->freq2 >= nyquist || config->depth < 0.0f || config->depth > 1.0f)
+        {
+            return 0;
+        }
+        break;
+    case SIGGEN_FM:
+        if (config->freq2 <= 0.0f || config->freq2 >= nyquist || config->depth < 0.0f ||
+            config->freq - config->depth <= 0.0f || config->freq + config->depth >= nyquist)
+        {
+            return 0;
+        }
+        break;
+    case SIGGEN_NOISE_WHITE:
+    case SIGGEN_NOISE_PINK:
+    case SIGGEN_NOISE_GAUSSIAN:
+        break;
+    default:
+        return 0;
+    }
+
+    // --- 2. 换算为相位增量 (相位保持不变) ---
+    if (waveform != gen->waveform)
+    {
+        gen->sweep_position = 0;
+    }
+    gen->waveform = waveform;
+    gen->amplitude = config->amplitude;
+    gen->offset = config->offset;
+    gen->depth = config->depth;
+    gen->carrier.phase_step = dds_phase_step(config->freq, sample_rate);
+    gen->modulator.phase_step = dds_phase_step(config->freq2, sample_rate);
+    gen->fm_deviation_step = (int32_t)dds_phase_step(config->depth, sample_rate);
+
+    gen->num_tones = (waveform == SIGGEN_MULTITONE) ? config->num_tones : 0;
+    for (uint32_t k = 0; k < gen->num_tones; k++)
+    {
+        gen->tone_step[k] = dds_phase_step(config->tone_freqs[k], sample_rate);
+        gen->tone_amp[k] = config->tone_amps[k];
+        // 递推的旋转系数用 libm 精确计算 (查表误差会在递推中逐采样累积)
+        float angle = 2.0f * (float)M_PI * config->tone_freqs[k] / sample_rate;
+        gen->tone_cos[k] = cosf(angle);
+        gen->tone_sin[k] = sinf(angle);
+    }
+
+    if (waveform == SIGGEN_CHIRP_LINEAR || waveform == SIGGEN_CHIRP_LOG)
+    {
+        uint32_t length = (uint32_t)(config->sweep_time * sample_rate);
+        float start = (float)gen->carrier.phase_step;
+        float end = (float)dds_phase_step(config->freq2, sample_rate);
+        gen->sweep_length = length;
+        gen->chirp_start_step = start;
+        gen->chirp_increment = (end - start) / (float)length;
+        gen->chirp_ratio = expf(logf(end / start) / (float)length);
+        if (gen->sweep_position >= length)
+        {
+            gen->sweep_position = 0;
+        }
+    }
+    return 1;
+}
+
+/**
+ * @brief 按波形类型生成 len 个采样。
+ */
+void siggen_generate(siggen_t *gen, float *buffer, uint32_t len)
+{
+    switch (gen->waveform)
+    {
+    case SIGGEN_SQUARE:
+    case SIGGEN_TRIANGLE:
+    case SIGGEN_SAW:
+        generate_blep(gen, buffer, len);
+        break;
+    case SIGGEN_MULTITONE:
+        generate_multitone(gen, buffer, len);
+        break;
+    case SIGGEN_CHIRP_LINEAR:
+    case SIGGEN_CHIRP_LOG:
+        generate_chirp(gen, buffer, len);
+        break;
+    case SIGGEN_AM:
+    case SIGGEN_FM:
+        generate_modulated(gen, buffer, len);
+        break;
+    case SIGGEN_NOISE_WHITE:
+    case SIGGEN_NOISE_PINK:
+    case SIGGEN_NOISE_GAUSSIAN:
+        generate_noise(gen, buffer, len);
+        break;
+    case SIGGEN_SINE:
+    default:
+        gen->carrier.amplitude = gen->amplitude;
+        gen->carrier.offset = gen->offset;
+        dds_generate(&gen->carrier, buffer, len);
+        break;
+    }
+}
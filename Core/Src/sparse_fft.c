@@ -0,0 +1,380 @@
+#include "sparse_fft.h"
+#include <math.h> // sqrtf, cosf, sinf, atan2f, floorf, roundf, fabsf
+
+#define SPARSE_FFT_PEAK_RATIO 0.05f    // 候选桶相对本轮最大桶幅度的下限 (-26 dB，高于 Hann 窗旁瓣)
+#define SPARSE_FFT_FLOOR_RATIO 4.0f    // 候选桶相对平均桶幅度的下限
+#define SPARSE_FFT_SINGLETON_TOL 0.25f // 各延迟上桶幅度的最大相对偏差，超过视为多个分量碰撞
+#define SPARSE_FFT_MIN_STRIDE 16       // 最小抽取间隔 L
+
+#define TWO_PI 6.28318530717958647692f
+
+// 已恢复的分量 (复幅度 a 对应 a * e^{j 2 pi f n}，实信号为 2 Re(...)，直流为 Re(a))
+typedef struct
+{
+    float frequency;
+    float re;
+    float im;
+} sparse_component_t;
+
+// 候选桶的逐级解码状态
+typedef struct
+{
+    uint32_t bucket;
+    complex_t y0;       // 延迟 0 上的桶值
+    float freq_coarse;  // 由相位差逐级细化的频率估计 (周期/采样)
+    uint8_t singleton;  // 各延迟幅度一致 (桶内只有一个分量)
+} sparse_candidate_t;
+
+// --- 私有辅助函数 ---
+
+/**
+ * @brief 返回 x 的小数部分 (0 <= 结果 < 1)。
+ */
+static float wrap_unit(float x)
+{
+    return x - floorf(x);
+}
+
+/**
+ * @brief 第 j 个采样的 Hann 窗系数 (周期形式)。
+ */
+static float hann(uint32_t j, uint32_t buckets)
+{
+    return 0.5f - 0.5f * cosf(TWO_PI * (float)j / (float)buckets);
+}
+
+/**
+ * @brief 以间隔 stride 抽取两路延迟序列 (剥离已恢复分量并加窗)，分别装入实部和虚部。
+ */
+static void load_delay_pair(sparse_fft_sample_fn sample, void *context, complex_t *z,
+                            uint32_t buckets, uint32_t stride, uint32_t delay_a, uint32_t delay_b,
+                            const sparse_component_t *found, uint32_t num_found)
+{
+    // 每个已恢复分量在两路序列上的相量和逐点旋转量 (递推，避免大下标下的相位精度问题)
+    complex_t phasor[SPARSE_FFT_MAX_PEAKS + 1][2];
+    complex_t rotation[SPARSE_FFT_MAX_PEAKS + 1];
+    for (uint32_t c = 0; c < num_found; c++)
+    {
+        float gain = (found[c].frequency == 0.0f) ? 1.0f : 2.0f;
+        uint32_t delays[2] = {delay_a, delay_b};
+        for (uint32_t d = 0; d < 2; d++)
+        {
+            float angle = TWO_PI * wrap_unit(found[c].frequency * (float)delays[d]);
+            float cr = cosf(angle);
+            float ci = sinf(angle);
+            phasor[c][d].real = gain * (found[c].re * cr - found[c].im * ci);
+            phasor[c][d].imag = gain * (found[c].re * ci + found[c].im * cr);
+        }
+        float step = TWO_PI * wrap_unit(found[c].frequency * (float)stride);
+        rotation[c].real = cosf(step);
+        rotation[c].imag = sinf(step);
+    }
+
+    for (uint32_t j = 0; j < buckets; j++)
+    {
+        uint32_t n = j * stride;
+        float a = sample(n + delay_a, context);
+        float b = sample(n + delay_b, context);
+        for (uint32_t c = 0; c < num_found; c++)
+        {
+            a -= phasor[c][0].real;
+            b -= phasor[c][1].real;
+            for (uint32_t d = 0; d < 2; d++)
+            {
+                float pr = phasor[c][d].real;
+                float pi = phasor[c][d].imag;
+                phasor[c][d].real = pr * rotation[c].real - pi * rotation[c].imag;
+                phasor[c][d].imag = pr * rotation[c].imag + pi * rotation[c].real;
+            }
+        }
+        float w = hann(j, buckets);
+        z[j].real = w * a;
+        z[j].imag = w * b;
+    }
+}
+
+/**
+ * @brief 从打包 FFT 结果中分离出两路实序列在桶 b 的频谱。
+ */
+static void split_bucket(const complex_t *z, uint32_t buckets, uint32_t b, complex_t *out_a, complex_t *out_b)
+{
+    complex_t p = z[b];
+    complex_t q = z[(buckets - b) & (buckets - 1)];
+    out_a->real = 0.5f * (p.real + q.real);
+    out_a->imag = 0.5f * (p.imag - q.imag);
+    out_b->real = 0.5f * (p.imag + q.imag);
+    out_b->imag = 0.5f * (q.real - p.real);
+}
+
+static float complex_abs(complex_t x)
+{
+    return sqrtf(x.real * x.real + x.imag * x.imag);
+}
+
+/**
+ * @brief 用延迟 delay 上的桶值细化候选的频率估计，并检验幅度一致性。
+ */
+static void refine_candidate(sparse_candidate_t *cand, complex_t y, uint32_t delay)
+{
+    float m0 = complex_abs(cand->y0);
+    float m = complex_abs(y);
+    if (fabsf(m - m0) > SPARSE_FFT_SINGLETON_TOL * m0)
+    {
+        cand->singleton = 0;
+        return;
+    }
+
+    // y / y0 的相位 = 2 pi f delay (mod 2 pi)
+    float re = y.real * cand->y0.real + y.imag * cand->y0.imag;
+    float im = y.imag * cand->y0.real - y.real * cand->y0.imag;
+    float phase = atan2f(im, re) / TWO_PI; // -0.5 ~ 0.5 周期
+
+    if (delay == 1)
+    {
+        cand->freq_coarse = wrap_unit(phase);
+    }
+    else
+    {
+        // f = (phase + k) / delay，取与当前估计最接近的 k
+        float k = roundf(cand->freq_coarse * (float)delay - phase);
+        cand->freq_coarse = (phase + k) / (float)delay;
+    }
+}
+
+/**
+ * @brief Hann 窗的频率响应 W(delta) = sum_j w[j] e^{j 2 pi delta j / B}。
+ */
+static complex_t hann_response(float delta, uint32_t buckets)
+{
+    complex_t sum = {0.0f, 0.0f};
+    float step = TWO_PI * delta / (float)buckets;
+    complex_t rot = {cosf(step), sinf(step)};
+    complex_t e = {1.0f, 0.0f};
+    for (uint32_t j = 0; j < buckets; j++)
+    {
+        float w = hann(j, buckets);
+        sum.real += w * e.real;
+        sum.imag += w * e.imag;
+        float er = e.real;
+        e.real = er * rot.real - e.imag * rot.imag;
+        e.imag = er * rot.imag + e.imag * rot.real;
+    }
+    return sum;
+}
+
+/**
+ * @brief 由已解码的候选计算分量的精确频率和复幅度。
+ * @return 1: 得到有效分量; 0: 候选无效。
+ */
+static uint8_t decode_candidate(const sparse_candidate_t *cand, const complex_t *y0, uint32_t buckets,
+                                uint32_t stride, sparse_component_t *out)
+{
+    // --- 1. Hann 两点插值得到桶内小数偏移 delta ---
+    uint32_t b = cand->bucket;
+    float m0 = complex_abs(y0[b]);
+    float m_next = complex_abs(y0[(b + 1) & (buckets - 1)]);
+    float m_prev = complex_abs(y0[(b - 1) & (buckets - 1)]);
+    if (m0 <= 0.0f)
+    {
+        return 0;
+    }
+    float ratio = ((m_next >= m_prev) ? m_next : m_prev) / m0;
+    float delta = (2.0f * ratio - 1.0f) / (ratio + 1.0f);
+    if (m_next < m_prev)
+    {
+        delta = -delta;
+    }
+
+    // --- 2. 桶位置给出 L*f mod 1，相位解码给出粗频率，二者合成精确频率 ---
+    float position = wrap_unit(((float)b + delta) / (float)buckets);
+    float alias = roundf((float)stride * cand->freq_coarse - position);
+    float freq = wrap_unit((position + alias) / (float)stride);
+
+    // --- 3. 复幅度 a = Y0[b] / W(delta) ---
+    complex_t w = hann_response(delta, buckets);
+    float w_sq = w.real * w.real + w.imag * w.imag;
+    if (w_sq <= 0.0f)
+    {
+        return 0;
+    }
+    float re = (cand->y0.real * w.real + cand->y0.imag * w.imag) / w_sq;
+    float im = (cand->y0.imag * w.real - cand->y0.real * w.imag) / w_sq;
+
+    // 负频率镜像: e^{-j 2 pi f n} 的系数为 conj(a)
+    if (freq > 0.5f)
+    {
+        freq = 1.0f - freq;
+        im = -im;
+    }
+    out->frequency = freq;
+    out->re = re;
+    out->im = im;
+    return 1;
+}
+
+// --- 公共函数 ---
+
+/**
+ * @brief 稀疏 FFT 峰值恢复。
+ */
+uint32_t sparse_fft_find_peaks(sparse_fft_sample_fn sample, void *context, uint32_t n_eff,
+                               uint32_t buckets, complex_t *work, uint32_t max_peaks,
+                               sparse_fft_peak_t *peaks)
+{
+    if (buckets < 16 || buckets > 512 || (buckets & (buckets - 1)) != 0 ||
+        (n_eff & (n_eff - 1)) != 0 || n_eff < SPARSE_FFT_MIN_STRIDE * buckets)
+    {
+        return 0;
+    }
+    if (max_peaks > SPARSE_FFT_MAX_PEAKS)
+    {
+        max_peaks = SPARSE_FFT_MAX_PEAKS;
+    }
+
+    complex_t *z = work;           // 打包 FFT 缓冲区
+    complex_t *y0 = &work[buckets]; // 本轮延迟 0 的桶值
+    sparse_component_t found[SPARSE_FFT_MAX_PEAKS + 1]; // 已恢复分量 (可能包含直流)
+    uint32_t num_found = 0;
+    uint32_t num_tones = 0;
+    float min_separation = 2.0f / (float)n_eff; // 相距 2 个等效频点以内视为同一分量
+
+    for (uint32_t round = 0; round < SPARSE_FFT_MAX_ROUNDS && num_tones < max_peaks; round++)
+    {
+        // 每轮更换抽取间隔，改变频率到桶的哈希，分开此前碰撞的分量
+        uint32_t stride = n_eff / buckets - round;
+
+        // --- 1. 延迟 0 和 1 打包进一次 FFT ---
+        load_delay_pair(sample, context, z, buckets, stride, 0, 1, found, num_found);
+        fft_radix2(z, buckets);
+
+        float mean = 0.0f;
+        float peak = 0.0f;
+        for (uint32_t b = 0; b < buckets; b++)
+        {
+            complex_t unused;
+            split_bucket(z, buckets, b, &y0[b], &unused);
+            float m = complex_abs(y0[b]);
+            mean += m;
+            if (m > peak)
+            {
+                peak = m;
+            }
+        }
+        mean /= (float)buckets;
+
+        // --- 2. 候选桶: 足够强的局部极大值 ---
+        sparse_candidate_t cands[SPARSE_FFT_MAX_CANDIDATES];
+        uint32_t num_cands = 0;
+        float floor_level = SPARSE_FFT_PEAK_RATIO * peak;
+        if (floor_level < SPARSE_FFT_FLOOR_RATIO * mean)
+        {
+            floor_level = SPARSE_FFT_FLOOR_RATIO * mean;
+        }
+        for (uint32_t b = 0; b < buckets && num_cands < SPARSE_FFT_MAX_CANDIDATES; b++)
+        {
+            float m = complex_abs(y0[b]);
+            if (m > floor_level &&
+                m >= complex_abs(y0[(b - 1) & (buckets - 1)]) &&
+                m > complex_abs(y0[(b + 1) & (buckets - 1)]))
+            {
+                complex_t y1, unused;
+                split_bucket(z, buckets, b, &unused, &y1);
+                cands[num_cands].bucket = b;
+                cands[num_cands].y0 = y0[b];
+                cands[num_cands].freq_coarse = 0.0f;
+                cands[num_cands].singleton = 1;
+                refine_candidate(&cands[num_cands], y1, 1);
+                num_cands++;
+            }
+        }
+        if (num_cands == 0)
+        {
+            break;
+        }
+
+        // --- 3. 其余 2 的幂延迟两两打包，逐级细化频率直到能确定别名序号 ---
+        for (uint32_t delay = 2; delay <= stride / 2; delay *= 4)
+        {
+            uint32_t delay_b = (delay * 2 <= stride / 2) ? delay * 2 : delay; // 最后一个延迟可能落单
+            load_delay_pair(sample, context, z, buckets, stride, delay, delay_b, found, num_found);
+            fft_radix2(z, buckets);
+            for (uint32_t c = 0; c < num_cands; c++)
+            {
+                if (!cands[c].singleton)
+                {
+                    continue;
+                }
+                complex_t ya, yb;
+                split_bucket(z, buckets, cands[c].bucket, &ya, &yb);
+                refine_candidate(&cands[c], ya, delay);
+                if (delay_b != delay && cands[c].singleton)
+                {
+                    refine_candidate(&cands[c], yb, delay_b);
+                }
+            }
+        }
+
+        // --- 4. 解码通过单分量检验的候选，去重后加入剥离列表 ---
+        uint32_t added = 0;
+        for (uint32_t c = 0; c < num_cands && num_tones < max_peaks; c++)
+        {
+            sparse_component_t comp;
+            if (!cands[c].singleton || !decode_candidate(&cands[c], y0, buckets, stride, &comp))
+            {
+                continue;
+            }
+            if (comp.frequency < 1.0f / (float)n_eff)
+            {
+                comp.frequency = 0.0f; // 直流: 只剥离，不输出
+            }
+
+            uint8_t duplicate = 0;
+            for (uint32_t k = 0; k < num_found; k++)
+            {
+                if (fabsf(found[k].frequency - comp.frequency) < min_separation)
+                {
+                    duplicate = 1;
+                    break;
+                }
+            }
+            if (duplicate)
+            {
+                continue;
+            }
+            if (comp.frequency != 0.0f)
+            {
+                num_tones++;
+            }
+            found[num_found++] = comp; // 直流经去重最多出现一次，num_found <= max_peaks + 1
+            added++;
+        }
+        if (added == 0)
+        {
+            break;
+        }
+    }
+
+    // --- 5. 输出 (去掉直流，按幅度降序) ---
+    uint32_t count = 0;
+    for (uint32_t k = 0; k < num_found; k++)
+    {
+        if (found[k].frequency == 0.0f)
+        {
+            continue;
+        }
+        sparse_fft_peak_t p;
+        p.frequency = found[k].frequency;
+        p.amplitude = 2.0f * sqrtf(found[k].re * found[k].re + found[k].im * found[k].im);
+        p.phase = atan2f(found[k].im, found[k].re);
+
+        uint32_t pos = count;
+        while (pos > 0 && peaks[pos - 1].amplitude < p.amplitude)
+        {
+            peaks[pos] = peaks[pos - 1];
+            pos--;
+        }
+        peaks[pos] = p;
+        count++;
+    }
+    return count;
+}
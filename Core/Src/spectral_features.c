@@ -0,0 +1,138 @@
+#include "spectral_features.h"
+#include <math.h> // logf, expf, sqrtf
+
+// 功率下限，防止对 0 取对数和除零
+#define SPECTRAL_POWER_FLOOR 1e-20f
+
+/**
+ * @brief 初始化描述符引擎。
+ */
+void spectral_descriptors_init(spectral_state_t *state, uint32_t n, float sample_rate,
+                               float rolloff_fraction, const float *band_edges_hz)
+{
+    if (n > FFT_N)
+    {
+        n = FFT_N;
+    }
+    state->n = n;
+    state->sample_rate = sample_rate;
+    state->rolloff_fraction = rolloff_fraction;
+    state->has_previous = 0;
+
+    // 频带边界: 第一个频带从 1 开始 (忽略直流)，最后一个到 n/2 结束
+    float bin_spacing = sample_rate / (float)n;
+    state->band_edges[0] = 1;
+    for (uint32_t b = 1; b < SPECTRAL_NUM_BANDS; b++)
+    {
+        uint32_t edge = (uint32_t)(band_edges_hz[b - 1] / bin_spacing + 0.5f);
+        if (edge < state->band_edges[b - 1])
+            edge = state->band_edges[b - 1];
+        if (edge > n / 2)
+            edge = n / 2;
+        state->band_edges[b] = (uint16_t)edge;
+    }
+    state->band_edges[SPECTRAL_NUM_BANDS] = (uint16_t)(n / 2);
+}
+
+/**
+ * @brief 在一次遍历中计算全部描述符。
+ */
+void spectral_descriptors_compute(spectral_state_t *state, const float *magnitudes,
+                                  spectral_descriptors_t *out)
+{
+    uint32_t half_n = state->n / 2;
+    uint32_t block_size = half_n / SPECTRAL_ROLLOFF_BLOCKS;
+    if (block_size == 0)
+        block_size = 1;
+    float bin_spacing = state->sample_rate / (float)state->n;
+
+    float block_energy[SPECTRAL_ROLLOFF_BLOCKS + 1] = {0};
+    float band_energy[SPECTRAL_NUM_BANDS] = {0};
+    float m0 = 0.0f, m1 = 0.0f, m2 = 0.0f, m3 = 0.0f; // 功率谱的 0~3 阶原点矩 (频点单位)
+    float log_sum = 0.0f;
+    float mag_sum = 0.0f;
+    float mag_max = 0.0f;
+    float flux_sum = 0.0f;
+    uint32_t band = 0;
+
+    // --- 融合遍历: 矩、平坦度、峰值因子、通量、频带能量、滚降块能量 ---
+    for (uint32_t k = 1; k < half_n; k++)
+    {
+        float mag = magnitudes[k];
+        float power = mag * mag;
+        float fk = (float)k;
+
+        m0 += power;
+        m1 += power * fk;
+        m2 += power * fk * fk;
+        m3 += power * fk * fk * fk;
+        log_sum += logf(power + SPECTRAL_POWER_FLOOR);
+        mag_sum += mag;
+        if (mag > mag_max)
+            mag_max = mag;
+
+        float diff = mag - state->previous[k];
+        flux_sum += diff * diff;
+        state->previous[k] = mag;
+
+        while (band + 1 < SPECTRAL_NUM_BANDS && k >= state->band_edges[band + 1])
+            band++;
+        band_energy[band] += power;
+
+        uint32_t block = k / block_size;
+        if (block > SPECTRAL_ROLLOFF_BLOCKS)
+            block = SPECTRAL_ROLLOFF_BLOCKS;
+        block_energy[block] += power;
+    }
+
+    float count = (float)(half_n - 1);
+    float total = m0 + SPECTRAL_POWER_FLOOR;
+
+    // --- 质心、展宽、偏度 (由原点矩换算为中心矩) ---
+    float mean = m1 / total;
+    float variance = m2 / total - mean * mean;
+    if (variance < 0.0f)
+        variance = 0.0f;
+    float sigma = sqrtf(variance);
+    float third = m3 / total - 3.0f * mean * variance - mean * mean * mean;
+    out->centroid = mean * bin_spacing;
+    out->spread = sigma * bin_spacing;
+    out->skewness = (sigma > 0.0f) ? third / (sigma * sigma * sigma) : 0.0f;
+
+    // --- 平坦度与峰值因子 ---
+    float arithmetic_mean = m0 / count;
+    out->flatness = expf(log_sum / count) / (arithmetic_mean + SPECTRAL_POWER_FLOOR);
+    out->crest = mag_max / (mag_sum / count + SPECTRAL_POWER_FLOOR);
+
+    // --- 通量 (第一帧没有参考，输出 0) ---
+    out->flux = state->has_previous ? sqrtf(flux_sum) : 0.0f;
+    state->has_previous = 1;
+
+    out->energy = m0;
+    for (uint32_t b = 0; b < SPECTRAL_NUM_BANDS; b++)
+    {
+        out->band_ratio[b] = band_energy[b] / total;
+    }
+
+    // --- 滚降点: 先按块粗定位，再在命中的块内逐频点细化 ---
+    float target = state->rolloff_fraction * m0;
+    float cumulative = 0.0f;
+    uint32_t rolloff_bin = half_n - 1;
+    for (uint32_t block = 0; block <= SPECTRAL_ROLLOFF_BLOCKS; block++)
+    {
+        if (cumulative + block_energy[block] >= target)
+        {
+            uint32_t k = (block == 0) ? 1 : block * block_size;
+            for (; k < half_n; k++)
+            {
+                cumulative += magnitudes[k] * magnitudes[k];
+                if (cumulative >= target)
+                    break;
+            }
+            rolloff_bin = (k < half_n) ? k : half_n - 1;
+            break;
+        }
+        cumulative += block_energy[block];
+    }
+    out->rolloff = (float)rolloff_bin * bin_spacing;
+}
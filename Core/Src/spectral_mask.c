@@ -0,0 +1,154 @@
+#include "spectral_mask.h"
+#include <math.h>   // powf, sqrtf
+#include <string.h> // memset, memcpy
+
+// --- 私有辅助函数 ---
+
+/**
+ * @brief 编码还原为线性限值幅度。
+ */
+static float mask_limit(const spectral_mask_t *mask, uint8_t code)
+{
+    return mask->coarse[code >> 4] * mask->fine[code & 15u];
+}
+
+/**
+ * @brief 比较一个频点并更新结果。
+ */
+static void mask_compare(const spectral_mask_t *mask, uint32_t bin, float magnitude, mask_result_t *result)
+{
+    uint8_t code = mask->codes[bin];
+    if (code == MASK_CODE_NONE)
+    {
+        return;
+    }
+    float limit = mask_limit(mask, code);
+    if (magnitude > limit)
+    {
+        // 只有超限频点才做除法
+        result->violations++;
+        float ratio = magnitude / limit;
+        if (ratio > result->worst_ratio)
+        {
+            result->worst_ratio = ratio;
+            result->worst_bin = bin;
+        }
+    }
+}
+
+/**
+ * @brief 清空比较结果。
+ */
+static void mask_result_clear(mask_result_t *result)
+{
+    result->violations = 0;
+    result->worst_bin = 0;
+    result->worst_ratio = 0.0f;
+}
+
+// --- 公共函数 ---
+
+/**
+ * @brief 建立还原表并清空限值线。
+ */
+void spectral_mask_init(spectral_mask_t *mask)
+{
+    for (uint32_t i = 0; i < 16; i++)
+    {
+        mask->coarse[i] = powf(10.0f, (MASK_DB_FLOOR + (float)(16 * i) * MASK_DB_STEP) / 20.0f);
+        mask->fine[i] = powf(10.0f, (float)i * MASK_DB_STEP / 20.0f);
+    }
+    memset(mask->codes, MASK_CODE_NONE, sizeof(mask->codes));
+}
+
+/**
+ * @brief dB 值编码为限值编码。
+ */
+uint8_t spectral_mask_encode(float db)
+{
+    float code = (db - MASK_DB_FLOOR) / MASK_DB_STEP + 0.5f;
+    if (code < 0.0f)
+    {
+        return 0;
+    }
+    if (code > (float)MASK_CODE_MAX)
+    {
+        return MASK_CODE_MAX;
+    }
+    return (uint8_t)code;
+}
+
+/**
+ * @brief 按 dB 线性插值写入一段限值。
+ */
+void spectral_mask_set_segment(spectral_mask_t *mask, uint32_t first, uint32_t last, float db_first, float db_last)
+{
+    if (last >= MASK_BINS)
+    {
+        last = MASK_BINS - 1;
+    }
+    if (first > last)
+    {
+        return;
+    }
+    float slope = (last > first) ? (db_last - db_first) / (float)(last - first) : 0.0f;
+    for (uint32_t k = first; k <= last; k++)
+    {
+        mask->codes[k] = spectral_mask_encode(db_first + slope * (float)(k - first));
+    }
+}
+
+/**
+ * @brief 直接写入一段限值编码。
+ */
+void spectral_mask_set_codes(spectral_mask_t *mask, uint32_t first, const uint8_t *codes, uint32_t count)
+{
+    if (first >= MASK_BINS)
+    {
+        return;
+    }
+    if (count > MASK_BINS - first)
+    {
+        count = MASK_BINS - first;
+    }
+    memcpy(&mask->codes[first], codes, count);
+}
+
+/**
+ * @brief 频点的限值 (dB)。
+ */
+float spectral_mask_limit_db(const spectral_mask_t *mask, uint32_t bin, uint8_t *enabled)
+{
+    uint8_t code = mask->codes[bin];
+    *enabled = (code != MASK_CODE_NONE);
+    return *enabled ? MASK_DB_FLOOR + (float)code * MASK_DB_STEP : 0.0f;
+}
+
+/**
+ * @brief 幅度计算与限值比较融合在一次遍历中。
+ */
+void spectral_mask_check_spectrum(const spectral_mask_t *mask, const complex_t *spectrum, float *magnitudes,
+                                  mask_result_t *result)
+{
+    const float scale = 1.0f / (float)FFT_N;
+    mask_result_clear(result);
+    for (uint32_t k = 0; k < MASK_BINS; k++)
+    {
+        float real = spectrum[k].real;
+        float imag = spectrum[k].imag;
+        magnitudes[k] = sqrtf(real * real + imag * imag) * scale;
+        mask_compare(mask, k, magnitudes[k], result);
+    }
+}
+
+/**
+ * @brief 用幅度谱与限值线比较。
+ */
+void spectral_mask_check(const spectral_mask_t *mask, const float *magnitudes, mask_result_t *result)
+{
+    mask_result_clear(result);
+    for (uint32_t k = 0; k < MASK_BINS; k++)
+    {
+        mask_compare(mask, k, magnitudes[k], result);
+    }
+}
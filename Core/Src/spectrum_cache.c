@@ -0,0 +1,113 @@
+#include "spectrum_cache.h"
+#include <math.h>   // log10f, powf
+#include <string.h> // memset, memcmp
+
+// --- 私有辅助函数 ---
+
+/**
+ * @brief 线性幅度编码为 uint16 (dB，步长 SPECTRUM_CACHE_DB_STEP)。
+ */
+static uint16_t encode_magnitude(float magnitude)
+{
+    float db = 20.0f * log10f(magnitude + 1e-12f);
+    float code = (db - SPECTRUM_CACHE_DB_FLOOR) / SPECTRUM_CACHE_DB_STEP + 0.5f;
+    if (code <= 0.0f)
+    {
+        return 0;
+    }
+    if (code >= 65535.0f)
+    {
+        return 65535;
+    }
+    return (uint16_t)code;
+}
+
+/**
+ * @brief uint16 编码解码为线性幅度 (编码 0 表示低于下限，解码为 0)。
+ */
+static float decode_magnitude(uint16_t code)
+{
+    if (code == 0)
+    {
+        return 0.0f;
+    }
+    float db = SPECTRUM_CACHE_DB_FLOOR + (float)code * SPECTRUM_CACHE_DB_STEP;
+    return powf(10.0f, db * 0.05f);
+}
+
+// --- 公共函数 ---
+
+/**
+ * @brief 清空缓存。
+ */
+void spectrum_cache_clear(spectrum_cache_t *cache)
+{
+    memset(cache, 0, sizeof(*cache));
+}
+
+/**
+ * @brief 查找缓存。
+ */
+uint8_t spectrum_cache_lookup(spectrum_cache_t *cache, const spectrum_cache_key_t *key, float *magnitudes)
+{
+    for (uint32_t e = 0; e < SPECTRUM_CACHE_ENTRIES; e++)
+    {
+        spectrum_cache_entry_t *entry = &cache->entries[e];
+        if (entry->valid && memcmp(&entry->key, key, sizeof(*key)) == 0)
+        {
+            for (uint32_t k = 0; k < SPECTRUM_CACHE_BINS; k++)
+            {
+                magnitudes[k] = decode_magnitude(entry->magnitudes[k]);
+            }
+            entry->last_used = ++cache->clock;
+            cache->hits++;
+            return 1;
+        }
+    }
+    cache->misses++;
+    return 0;
+}
+
+/**
+ * @brief 保存结果 (优先使用空条目，否则替换最久未使用的条目)。
+ */
+void spectrum_cache_store(spectrum_cache_t *cache, const spectrum_cache_key_t *key, const float *magnitudes)
+{
+    spectrum_cache_entry_t *victim = &cache->entries[0];
+    for (uint32_t e = 0; e < SPECTRUM_CACHE_ENTRIES; e++)
+    {
+        spectrum_cache_entry_t *entry = &cache->entries[e];
+        if (!entry->valid)
+        {
+            victim = entry;
+            break;
+        }
+        if (entry->last_used < victim->last_used)
+        {
+            victim = entry;
+        }
+    }
+
+    victim->key = *key;
+    for (uint32_t k = 0; k < SPECTRUM_CACHE_BINS; k++)
+    {
+        victim->magnitudes[k] = encode_magnitude(magnitudes[k]);
+    }
+    victim->last_used = ++cache->clock;
+    victim->valid = 1;
+}
+
+/**
+ * @brief FNV-1a 散列。
+ */
+uint32_t spectrum_cache_hash(const void *data, uint32_t len)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    uint32_t hash = 2166136261u;
+    for (uint32_t i = 0; i < len; i++)
+    {
+        hash ^= bytes[i];
+        hash *= 16777619u;
+    }
+    return hash;
+}
@@ -0,0 +1,61 @@
+#include "sweep.h"
+#include "dds.h"  // dds_phase_step, dds_sin
+#include <math.h> // powf, sqrtf, atan2f
+
+#define DDS_QUARTER_TURN 0x40000000u // 90 度对应的相位增量 (cos(x) = sin(x + 90°))
+
+/**
+ * @brief 第 index 个扫频点的频率。
+ */
+float sweep_frequency(float start, float stop, uint32_t points, uint32_t index, uint8_t logarithmic)
+{
+    if (points < 2)
+    {
+        return start;
+    }
+    float t = (float)index / (float)(points - 1);
+    if (logarithmic)
+    {
+        return start * powf(stop / start, t);
+    }
+    return start + (stop - start) * t;
+}
+
+/**
+ * @brief 测量指定频率分量的幅度和相位。
+ */
+void sweep_measure_tone(const float *samples, uint32_t len, float freq, float sample_rate,
+                        float *amplitude, float *phase)
+{
+    uint32_t ref_phase = 0;
+    uint32_t ref_step = dds_phase_step(freq, sample_rate);
+    uint32_t win_phase = DDS_QUARTER_TURN; // Hann 窗 w[n] = 0.5 - 0.5 * cos(2*pi*n/len)
+    uint32_t win_step = dds_phase_step(1.0f, (float)len);
+    float acc_re = 0.0f;
+    float acc_im = 0.0f;
+    float win_sum = 0.0f;
+
+    // 先去掉直流: 低频点离直流只有几个频点，偏移经窗函数旁瓣泄漏会带来约 1 度的相位误差
+    float mean = 0.0f;
+    for (uint32_t n = 0; n < len; n++)
+    {
+        mean += samples[n];
+    }
+    mean /= (float)len;
+
+    // Y = sum(w[n] * x[n] * e^(-j*w*n))
+    for (uint32_t n = 0; n < len; n++)
+    {
+        float w = 0.5f - 0.5f * dds_sin(win_phase);
+        float wx = w * (samples[n] - mean);
+        acc_re += wx * dds_sin(ref_phase + DDS_QUARTER_TURN);
+        acc_im -= wx * dds_sin(ref_phase);
+        win_sum += w;
+        ref_phase += ref_step;
+        win_phase += win_step;
+    }
+
+    // A*cos(w*n + theta) 的相关结果约为 (A/2) * e^(j*theta) * sum(w)
+    *amplitude = 2.0f * sqrtf(acc_re * acc_re + acc_im * acc_im) / win_sum;
+    *phase = atan2f(acc_im, acc_re);
+}
@@ -0,0 +1,87 @@
+/* USER CODE BEGIN Header */
+/**
+  ******************************************************************************
+  * @file    tim.c
+  * @brief   This file provides code for the configuration
+  *          of the TIM instances.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2025 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+/* USER CODE END Header */
+/* Includes ------------------------------------------------------------------*/
+#include "tim.h"
+
+/* USER CODE BEGIN 0 */
+// TIM2 直接按寄存器配置 (CMSIS 定义)，工程未提供 HAL TIM 驱动
+/* USER CODE END 0 */
+
+/* TIM2 init function */
+void MX_TIM2_Init(void)
+{
+
+  /* USER CODE BEGIN TIM2_Init 0 */
+
+  /* USER CODE END TIM2_Init 0 */
+
+  /* USER CODE BEGIN TIM2_Init 1 */
+  // 采样时钟: APB1 定时器时钟 84 MHz / (1749 + 1) = 48 kHz (上电默认值，RATE 命令在运行时重新计算 PSC/ARR)，
+  // 更新事件作为 ADC1 的外部触发 (TRGO)
+  /* USER CODE END TIM2_Init 1 */
+
+  /* USER CODE BEGIN TIM2_Init 2 */
+  // 外设寄存器配置放在 USER CODE 段中，用 CubeMX 重新生成时保留
+  /* TIM2 clock enable */
+  __HAL_RCC_TIM2_CLK_ENABLE();
+
+  /** Up counter, internal clock, auto-reload preload, TRGO = update event */
+  TIM2->CR1 = TIM_CR1_ARPE;
+  TIM2->CR2 = TIM_CR2_MMS_1;
+  TIM2->SMCR = 0;
+  TIM2_Config_Rate(0, 1749);
+  /* USER CODE END TIM2_Init 2 */
+
+}
+
+/* USER CODE BEGIN 1 */
+
+/**
+  * @brief  设置 TIM2 分频: 更新频率 = 定时器时钟 / ((prescaler + 1) * (period + 1))
+  * @param  prescaler: 预分频值 (PSC，<= 0xFFFF)
+  * @param  period: 自动重装载值 (ARR，>= 1)
+  * @note   在定时器停止时调用；软件更新事件把 PSC 装入影子寄存器
+  */
+void TIM2_Config_Rate(uint32_t prescaler, uint32_t period)
+{
+  TIM2->PSC = prescaler;
+  TIM2->ARR = period;
+  TIM2->EGR = TIM_EGR_UG;
+  TIM2->SR = 0;
+}
+
+/**
+  * @brief  从 0 开始计数 (启动采样触发)
+  */
+void TIM2_Start(void)
+{
+  TIM2->CNT = 0;
+  TIM2->CR1 |= TIM_CR1_CEN;
+}
+
+/**
+  * @brief  停止计数 (停止采样触发)
+  */
+void TIM2_Stop(void)
+{
+  TIM2->CR1 &= ~TIM_CR1_CEN;
+}
+
+/* USER CODE END 1 */
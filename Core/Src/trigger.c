@@ -0,0 +1,111 @@
+#include "trigger.h"
+
+/**
+ * @brief 布防。
+ */
+void trigger_arm(trigger_t *trig, trigger_type_t type, float level, uint32_t pre_samples)
+{
+    trig->type = type;
+    trig->level = level;
+    trig->pre_samples = pre_samples;
+    trigger_restart(trig);
+}
+
+/**
+ * @brief 重新开始积累预触发历史。
+ */
+void trigger_restart(trigger_t *trig)
+{
+    trig->history = 0;
+    trig->last_sample = 0.0f;
+    trig->last_slope = 0.0f;
+}
+
+/**
+ * @brief 在新到达的一块采样上检查触发条件。
+ */
+int32_t trigger_scan(trigger_t *trig, const float *block, uint32_t len)
+{
+    const float level = trig->level;
+    float prev = trig->last_sample;
+    float prev_slope = trig->last_slope;
+    int32_t found = -1;
+
+    // 斜率需要两个采样，电平跳变需要一个前序采样，历史不足时从块内相应位置开始
+    uint32_t start = (trig->type >= TRIGGER_SLOPE_RISING) ? 2 : 1;
+    start = (trig->history >= start) ? 0 : start - trig->history;
+    // 触发点之前至少要有 pre_samples 个有效历史采样
+    if (trig->history + start < trig->pre_samples)
+    {
+        start = trig->pre_samples - trig->history;
+    }
+    if (start > 0 && start <= len)
+    {
+        prev = block[start - 1];
+        prev_slope = (start >= 2) ? block[start - 1] - block[start - 2] : block[start - 1] - trig->last_sample;
+    }
+
+    for (uint32_t i = start; i < len; i++)
+    {
+        float x = block[i];
+        float slope = x - prev;
+        uint8_t fire = 0;
+        switch (trig->type)
+        {
+        case TRIGGER_EDGE_RISING:
+            fire = (prev < level && x >= level);
+            break;
+        case TRIGGER_EDGE_FALLING:
+            fire = (prev > level && x <= level);
+            break;
+        case TRIGGER_SLOPE_RISING:
+            fire = (prev_slope < level && slope >= level);
+            break;
+        case TRIGGER_SLOPE_FALLING:
+        default:
+            fire = (prev_slope > -level && slope <= -level);
+            break;
+        }
+        if (fire)
+        {
+            found = (int32_t)i;
+            break;
+        }
+        prev = x;
+        prev_slope = slope;
+    }
+
+    if (len > 0)
+    {
+        trig->last_slope = (len >= 2) ? block[len - 1] - block[len - 2] : block[0] - trig->last_sample;
+        trig->last_sample = block[len - 1];
+    }
+    trig->history += len;
+    return found;
+}
+
+/**
+ * @brief 取出以触发点为基准的捕获窗口。
+ */
+void trigger_extract(const float *ring, uint32_t block_len, uint32_t trigger_block, uint32_t trigger_index,
+                     uint32_t pre_samples, float *output)
+{
+    const uint32_t ring_len = 2 * block_len;
+    // 窗口起点在环形缓冲区中的位置 (触发块的起点加上块内偏移，再回退 pre_samples)
+    uint32_t pos = (trigger_block & 1u) * block_len + trigger_index + ring_len - pre_samples;
+    pos %= ring_len;
+    for (uint32_t i = 0; i < block_len; i++)
+    {
+        output[i] = ring[pos];
+        pos = (pos + 1 == ring_len) ? 0 : pos + 1;
+    }
+}
+
+/**
+ * @brief 捕获窗口是否延伸到下一块。
+ */
+uint8_t trigger_needs_next_block(uint32_t trigger_index, uint32_t pre_samples)
+{
+    // 窗口为 [trigger_index - pre_samples, trigger_index - pre_samples + block_len)
+    return trigger_index > pre_samples;
+}
@@ -0,0 +1,195 @@
+#include "wavelet.h"
+#include <math.h> // fabsf
+
+// Daubechies-4 提升系数
+#define DB4_SQRT3 1.7320508075688772f
+#define DB4_SCALE_EVEN 0.5176380902050415f // (sqrt(3) - 1) / sqrt(2)
+#define DB4_SCALE_ODD 1.9318516525781366f  // (sqrt(3) + 1) / sqrt(2)
+
+// CDF 9/7 提升系数 (JPEG2000 不可逆变换)
+#define CDF97_ALPHA -1.586134342059924f
+#define CDF97_BETA -0.052980118572961f
+#define CDF97_GAMMA 0.882911075530934f
+#define CDF97_DELTA 0.443506852043971f
+#define CDF97_K 1.149604398860241f // 近似/细节缩放，使直流增益为 sqrt(2) (与正交小波一致)
+
+#define HAAR_INV_SQRT2 0.7071067811865476f
+
+// 以 stride 为步长访问当前层的偶数 (近似) 和奇数 (细节) 样本
+#define EVEN(i) x[(2 * (i)) * stride]
+#define ODD(i) x[(2 * (i) + 1) * stride]
+
+// --- 私有辅助函数 ---
+
+/**
+ * @brief Haar 单层提升: d = o - e, s = e + d / 2，再归一化。
+ */
+static void lift_haar(float *x, uint32_t half, uint32_t stride)
+{
+    for (uint32_t i = 0; i < half; i++)
+    {
+        float d = ODD(i) - EVEN(i);
+        float s = EVEN(i) + 0.5f * d;
+        EVEN(i) = s * (2.0f * HAAR_INV_SQRT2);
+        ODD(i) = d * HAAR_INV_SQRT2;
+    }
+}
+
+/**
+ * @brief Daubechies-4 单层提升 (周期延拓)。
+ */
+static void lift_db4(float *x, uint32_t half, uint32_t stride)
+{
+    // 更新: s1[i] = e[i] + sqrt(3) o[i]
+    for (uint32_t i = 0; i < half; i++)
+    {
+        EVEN(i) += DB4_SQRT3 * ODD(i);
+    }
+    // 预测: d1[i] = o[i] - sqrt(3)/4 s1[i] - (sqrt(3)-2)/4 s1[i-1]
+    for (uint32_t i = 0; i < half; i++)
+    {
+        uint32_t prev = (i == 0) ? half - 1 : i - 1;
+        ODD(i) -= 0.25f * DB4_SQRT3 * EVEN(i) + 0.25f * (DB4_SQRT3 - 2.0f) * EVEN(prev);
+    }
+    // 更新: s2[i] = s1[i] - d1[i+1]
+    for (uint32_t i = 0; i < half; i++)
+    {
+        uint32_t next = (i == half - 1) ? 0 : i + 1;
+        EVEN(i) -= ODD(next);
+    }
+    for (uint32_t i = 0; i < half; i++)
+    {
+        EVEN(i) *= DB4_SCALE_EVEN;
+        ODD(i) *= DB4_SCALE_ODD;
+    }
+}
+
+/**
+ * @brief CDF 9/7 单层提升 (整点对称延拓: x[-1] = x[1], x[m] = x[m-2])。
+ */
+static void lift_cdf97(float *x, uint32_t half, uint32_t stride)
+{
+    static const float steps[4] = {CDF97_ALPHA, CDF97_BETA, CDF97_GAMMA, CDF97_DELTA};
+
+    for (uint32_t step = 0; step < 4; step += 2)
+    {
+        // 预测: o[i] += c (e[i] + e[i+1])
+        for (uint32_t i = 0; i < half; i++)
+        {
+            float right = (i == half - 1) ? EVEN(i) : EVEN(i + 1);
+            ODD(i) += steps[step] * (EVEN(i) + right);
+        }
+        // 更新: e[i] += c (o[i-1] + o[i])
+        for (uint32_t i = 0; i < half; i++)
+        {
+            float left = (i == 0) ? ODD(0) : ODD(i - 1);
+            EVEN(i) += steps[step + 1] * (left + ODD(i));
+        }
+    }
+    for (uint32_t i = 0; i < half; i++)
+    {
+        EVEN(i) *= CDF97_K;
+        ODD(i) *= 1.0f / CDF97_K;
+    }
+}
+
+// --- 公共函数 ---
+
+/**
+ * @brief 多层正向离散小波变换 (提升格式，原地)。
+ */
+uint32_t wavelet_forward(float *x, uint32_t n, wavelet_type_t type, uint32_t levels)
+{
+    if (n < 2 || (n & (n - 1)) != 0 || type > WAVELET_CDF97)
+    {
+        return 0;
+    }
+
+    // 最后一层至少保留的近似系数个数 (长滤波器在更短序列上没有意义)
+    uint32_t min_len = (type == WAVELET_HAAR) ? 2 : 4;
+    if (levels > WAVELET_MAX_LEVELS)
+    {
+        levels = WAVELET_MAX_LEVELS;
+    }
+
+    uint32_t done = 0;
+    uint32_t stride = 1;
+    uint32_t len = n; // 当前层参与变换的样本数
+    while (done < levels && len >= 2 * min_len)
+    {
+        uint32_t half = len / 2;
+        switch (type)
+        {
+        case WAVELET_DB4:
+            lift_db4(x, half, stride);
+            break;
+        case WAVELET_CDF97:
+            lift_cdf97(x, half, stride);
+            break;
+        case WAVELET_HAAR:
+        default:
+            lift_haar(x, half, stride);
+            break;
+        }
+        done++;
+        stride *= 2;
+        len = half;
+    }
+    return done;
+}
+
+/**
+ * @brief 统计各层能量、峰值和阈值越过次数。
+ */
+void wavelet_analyze(const float *x, uint32_t n, uint32_t levels, float threshold,
+                     wavelet_level_stats_t *stats)
+{
+    for (uint32_t j = 0; j <= levels; j++)
+    {
+        stats[j].energy = 0.0f;
+        stats[j].peak = 0.0f;
+        stats[j].peak_position = 0;
+        stats[j].crossings = 0;
+    }
+
+    // 各层上一个系数是否在阈值以上 (用于检测上升沿)
+    uint8_t above[WAVELET_MAX_LEVELS] = {0};
+    uint32_t approx_mask = (1u << levels) - 1;
+
+    for (uint32_t i = 0; i < n; i++)
+    {
+        // 交错存放: 下标 i 的最低置位决定所属层，低 levels 位全 0 的为近似系数
+        uint32_t level;
+        if ((i & approx_mask) == 0)
+        {
+            level = levels;
+        }
+        else
+        {
+            level = 0;
+            while (((i >> level) & 1u) == 0)
+            {
+                level++;
+            }
+        }
+
+        float c = x[i];
+        float magnitude = fabsf(c);
+        wavelet_level_stats_t *s = &stats[level];
+        s->energy += c * c;
+        if (magnitude > s->peak)
+        {
+            s->peak = magnitude;
+            s->peak_position = i;
+        }
+        if (level < levels)
+        {
+            uint8_t is_above = (magnitude > threshold);
+            if (is_above && !above[level])
+            {
+                s->crossings++;
+            }
+            above[level] = is_above;
+        }
+    }
+}
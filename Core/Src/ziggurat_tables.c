@@ -0,0 +1,62 @@
+/**
+ * @description: 正态分布 Ziggurat 表，由 gen_ziggurat_tables.py 自动生成，请勿手动修改。
+ * @note: 128 层, r = 3.442619855899, 每层面积 = 0.00991256303526217。
+ */
+#include "siggen.h"
+
+const uint32_t siggen_ziggurat_k[SIGGEN_ZIGGURAT_LAYERS] = {
+    1991057938u, 0u, 1611602771u, 1826899878u, 1918584482u, 1969227037u, 2001281515u, 2023368125u,
+    2039498179u, 2051788381u, 2061460127u, 2069267110u, 2075699398u, 2081089314u, 2085670119u, 2089610331u,
+    2093034710u, 2096037586u, 2098691595u, 2101053571u, 2103168620u, 2105072996u, 2106796166u, 2108362327u,
+    2109791536u, 2111100552u, 2112303493u, 2113412330u, 2114437283u, 2115387130u, 2116269447u, 2117090813u,
+    2117856962u, 2118572919u, 2119243101u, 2119871411u, 2120461303u, 2121015852u, 2121537798u, 2122029592u,
+    2122493434u, 2122931299u, 2123344971u, 2123736059u, 2124106020u, 2124456175u, 2124787725u, 2125101763u,
+    2125399283u, 2125681194u, 2125948325u, 2126201433u, 2126441213u, 2126668298u, 2126883268u, 2127086657u,
+    2127278949u, 2127460589u, 2127631985u, 2127793506u, 2127945490u, 2128088244u, 2128222044u, 2128347141u,
+    2128463758u, 2128572095u, 2128672327u, 2128764606u, 2128849065u, 2128925811u, 2128994934u, 2129056501u,
+    2129110560u, 2129157136u, 2129196237u, 2129227847u, 2129251929u, 2129268426u, 2129277255u, 2129278312u,
+    2129271467u, 2129256561u, 2129233410u, 2129201800u, 2129161480u, 2129112170u, 2129053545u, 2128985244u,
+    2128906855u, 2128817916u, 2128717911u, 2128606255u, 2128482298u, 2128345305u, 2128194452u, 2128028813u,
+    2127847342u, 2127648860u, 2127432031u, 2127195339u, 2126937058u, 2126655214u, 2126347546u, 2126011445u,
+    2125643893u, 2125241376u, 2124799783u, 2124314271u, 2123779094u, 2123187386u, 2122530867u, 2121799464u,
+    2120980787u, 2120059418u, 2119015917u, 2117825402u, 2116455471u, 2114863093u, 2112989789u, 2110753906u,
+    2108037662u, 2104664315u, 2100355223u, 2094642347u, 2086670106u, 2074676188u, 2054300022u, 2010539237u,
+};
+
+const float siggen_ziggurat_w[SIGGEN_ZIGGURAT_LAYERS] = {
+    1.729040522e-09f, 1.268092845e-10f, 1.689751777e-10f, 1.986268844e-10f, 2.223243179e-10f, 2.424493613e-10f, 2.601613190e-10f, 2.761198871e-10f,
+    2.907396282e-10f, 3.042997041e-10f, 3.169979521e-10f, 3.289802053e-10f, 3.403573812e-10f, 3.512160221e-10f, 3.616250995e-10f, 3.716405763e-10f,
+    3.813085643e-10f, 3.906675681e-10f, 3.997501187e-10f, 4.085839862e-10f, 4.171930964e-10f, 4.255982353e-10f, 4.338175974e-10f, 4.418672181e-10f,
+    4.497613196e-10f, 4.575125889e-10f, 4.651324048e-10f, 4.726310238e-10f, 4.800177347e-10f, 4.873009868e-10f, 4.944884981e-10f, 5.015873466e-10f,
+    5.086040482e-10f, 5.155446229e-10f, 5.224146520e-10f, 5.292193275e-10f, 5.359634953e-10f, 5.426516925e-10f, 5.492881800e-10f, 5.558769721e-10f,
+    5.624218613e-10f, 5.689264417e-10f, 5.753941290e-10f, 5.818281786e-10f, 5.882317021e-10f, 5.946076818e-10f, 6.009589843e-10f, 6.072883728e-10f,
+    6.135985177e-10f, 6.198920075e-10f, 6.261713578e-10f, 6.324390202e-10f, 6.386973906e-10f, 6.449488167e-10f, 6.511956053e-10f, 6.574400293e-10f,
+    6.636843339e-10f, 6.699307434e-10f, 6.761814667e-10f, 6.824387039e-10f, 6.887046513e-10f, 6.949815079e-10f, 7.012714804e-10f, 7.075767893e-10f,
+    7.138996747e-10f, 7.202424015e-10f, 7.266072661e-10f, 7.329966016e-10f, 7.394127850e-10f, 7.458582428e-10f, 7.523354585e-10f, 7.588469793e-10f,
+    7.653954238e-10f, 7.719834898e-10f, 7.786139632e-10f, 7.852897266e-10f, 7.920137693e-10f, 7.987891979e-10f, 8.056192475e-10f, 8.125072942e-10f,
+    8.194568683e-10f, 8.264716694e-10f, 8.335555823e-10f, 8.407126946e-10f, 8.479473165e-10f, 8.552640026e-10f, 8.626675754e-10f, 8.701631525e-10f,
+    8.777561764e-10f, 8.854524480e-10f, 8.932581641e-10f, 9.011799601e-10f, 9.092249580e-10f, 9.174008206e-10f, 9.257158144e-10f, 9.341788804e-10f,
+    9.427997160e-10f, 9.515888694e-10f, 9.605578494e-10f, 9.697192525e-10f, 9.790869128e-10f, 9.886760771e-10f, 9.985036135e-10f, 1.008588259e-09f,
+    1.018950917e-09f, 1.029615015e-09f, 1.040606944e-09f, 1.051956589e-09f, 1.063697999e-09f, 1.075870210e-09f, 1.088518296e-09f, 1.101694708e-09f,
+    1.115461010e-09f, 1.129890161e-09f, 1.145069570e-09f, 1.161105243e-09f, 1.178127561e-09f, 1.196299505e-09f, 1.215828698e-09f, 1.236985629e-09f,
+    1.260132330e-09f, 1.285769684e-09f, 1.314620185e-09f, 1.347783956e-09f, 1.387063532e-09f, 1.435740319e-09f, 1.500865903e-09f, 1.603094794e-09f,
+};
+
+const float siggen_ziggurat_f[SIGGEN_ZIGGURAT_LAYERS] = {
+    1.000000000e+00f, 9.635996931e-01f, 9.362826817e-01f, 9.130436480e-01f, 8.922816508e-01f, 8.732430489e-01f, 8.555006079e-01f, 8.387836053e-01f,
+    8.229072114e-01f, 8.077382947e-01f, 7.931770118e-01f, 7.791460859e-01f, 7.655841739e-01f, 7.524415592e-01f, 7.396772437e-01f, 7.272569183e-01f,
+    7.151515074e-01f, 7.033360990e-01f, 6.917891434e-01f, 6.804918410e-01f, 6.694276673e-01f, 6.585820001e-01f, 6.479418211e-01f, 6.374954773e-01f,
+    6.272324852e-01f, 6.171433708e-01f, 6.072195366e-01f, 5.974531509e-01f, 5.878370544e-01f, 5.783646811e-01f, 5.690299911e-01f, 5.598274127e-01f,
+    5.507517931e-01f, 5.417983550e-01f, 5.329626594e-01f, 5.242405727e-01f, 5.156282382e-01f, 5.071220511e-01f, 4.987186355e-01f, 4.904148253e-01f,
+    4.822076463e-01f, 4.740943007e-01f, 4.660721527e-01f, 4.581387163e-01f, 4.502916437e-01f, 4.425287153e-01f, 4.348478302e-01f, 4.272469983e-01f,
+    4.197243320e-01f, 4.122780401e-01f, 4.049064208e-01f, 3.976078565e-01f, 3.903808082e-01f, 3.832238111e-01f, 3.761354695e-01f, 3.691144537e-01f,
+    3.621594954e-01f, 3.552693848e-01f, 3.484429675e-01f, 3.416791412e-01f, 3.349768533e-01f, 3.283350984e-01f, 3.217529159e-01f, 3.152293881e-01f,
+    3.087636380e-01f, 3.023548278e-01f, 2.960021568e-01f, 2.897048604e-01f, 2.834622082e-01f, 2.772735029e-01f, 2.711380791e-01f, 2.650553023e-01f,
+    2.590245674e-01f, 2.530452985e-01f, 2.471169475e-01f, 2.412389935e-01f, 2.354109423e-01f, 2.296323252e-01f, 2.239026994e-01f, 2.182216466e-01f,
+    2.125887731e-01f, 2.070037094e-01f, 2.014661101e-01f, 1.959756531e-01f, 1.905320403e-01f, 1.851349970e-01f, 1.797842721e-01f, 1.744796383e-01f,
+    1.692208922e-01f, 1.640078547e-01f, 1.588403711e-01f, 1.537183122e-01f, 1.486415742e-01f, 1.436100801e-01f, 1.386237800e-01f, 1.336826526e-01f,
+    1.287867062e-01f, 1.239359802e-01f, 1.191305467e-01f, 1.143705124e-01f, 1.096560210e-01f, 1.049872554e-01f, 1.003644410e-01f, 9.578784912e-02f,
+    9.125780083e-02f, 8.677467189e-02f, 8.233889824e-02f, 7.795098251e-02f, 7.361150188e-02f, 6.932111739e-02f, 6.508058521e-02f, 6.089077035e-02f,
+    5.675266348e-02f, 5.266740190e-02f, 4.863629586e-02f, 4.466086220e-02f, 4.074286807e-02f, 3.688438879e-02f, 3.308788615e-02f, 2.935631744e-02f,
+    2.569329194e-02f, 2.210330462e-02f, 1.859210274e-02f, 1.516729801e-02f, 1.183947866e-02f, 8.624484413e-03f, 5.548995221e-03f, 2.669629084e-03f,
+};
@@ -0,0 +1,71 @@
+"""
+@description: 生成多相滤波器组信道化器的原型低通 FIR Core/Src/channelizer_prototype.c。
+@note: 纯 Python 实现，不依赖 numpy。原型滤波器为 Kaiser 窗 sinc，长度 M * N，
+       截止频率为半个信道间隔 (fs / (2N))，相邻信道在交界处 -6 dB 相接。
+       系数按直流增益 1 归一化，幅度为 A 的实正弦位于信道中心时输出幅度为 A / 2。
+用法: python gen_channelizer_prototype.py [N] [M] [beta]  (默认 128 8 9.0，需与 channelizer.h 一致)
+"""
+import cmath
+import math
+import os
+import sys
+
+
+def bessel_i0(x):
+    """第一类零阶修正贝塞尔函数 (级数展开)。"""
+    total = 1.0
+    term = 1.0
+    k = 1
+    while term > 1e-12 * total:
+        term *= (x / (2.0 * k)) ** 2
+        total += term
+        k += 1
+    return total
+
+
+def prototype(n_channels, taps_per_branch, beta):
+    length = n_channels * taps_per_branch
+    center = (length - 1) / 2.0
+    cutoff = 0.5 / n_channels  # 周期/采样
+    h = []
+    for i in range(length):
+        t = i - center
+        sinc = 2 * cutoff if t == 0 else math.sin(2 * math.pi * cutoff * t) / (math.pi * t)
+        ratio = 2.0 * i / (length - 1) - 1.0
+        window = bessel_i0(beta * math.sqrt(max(0.0, 1.0 - ratio * ratio))) / bessel_i0(beta)
+        h.append(sinc * window)
+    gain = sum(h)
+    return [x / gain for x in h]
+
+
+def response_db(h, freq):
+    acc = sum(x * cmath.exp(-2j * math.pi * freq * i) for i, x in enumerate(h))
+    return 20 * math.log10(max(abs(acc), 1e-12))
+
+
+def main():
+    n_channels = int(sys.argv[1]) if len(sys.argv) > 1 else 128
+    taps_per_branch = int(sys.argv[2]) if len(sys.argv) > 2 else 8
+    beta = float(sys.argv[3]) if len(sys.argv) > 3 else 9.0
+
+    h = prototype(n_channels, taps_per_branch, beta)
+    for offset in (0.5, 1.0, 1.5, 2.0):
+        print(f"{offset:.1f} 个信道间隔处响应: {response_db(h, offset / n_channels):7.1f} dB")
+
+    out_path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "Core", "Src", "channelizer_prototype.c")
+    with open(out_path, "w", encoding="utf-8") as f:
+        f.write("/**\n")
+        f.write(" * @description: 多相信道化器原型低通 FIR，由 gen_channelizer_prototype.py 自动生成，请勿手动修改。\n")
+        f.write(f" * @note: N = {n_channels} 个信道, M = {taps_per_branch} 抽头/支路, Kaiser beta = {beta:g}，"
+                f"直流增益 1。\n")
+        f.write(" */\n")
+        f.write('#include "channelizer.h"\n\n')
+        f.write("const float channelizer_prototype[CHANNELIZER_TAPS] = {\n")
+        for i in range(0, len(h), 8):
+            f.write("    " + ", ".join(f"{x:.8e}f" for x in h[i:i + 8]) + ",\n")
+        f.write("};\n")
+    print(f"生成: {out_path}")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,97 @@
+"""
+@description: 生成常数 Q 变换使用的稀疏频域核 Core/Src/cqt_kernel.c (Brown-Puckette 方法)。
+@note: 纯 Python 实现，不依赖 numpy。第 k 个 CQ 频点的时域核为长度 N_k = ceil(Q fs / f_k) 的
+       Hamming 窗复指数 (按窗函数之和归一化)，居中放入 N 点帧后做 FFT 得到频域核。
+       频域核只保留正频率部分中 |K| 超过该行最大值 threshold 倍的连续区间 (默认 0.01，
+       略高于 Hamming 窗 -43 dB 旁瓣，核大小约为 0.0054 时的 1/4)，以 int16 (Q15) 实部/虚部对存放，每行一个缩放系数。
+用法: python gen_cqt_kernel.py [N] [fs] [fmin] [每倍频程频点数] [倍频程数] [threshold]
+      (默认 1024 48000 880 12 4 0.01，需与 cqt.h 一致)
+"""
+import cmath
+import math
+import os
+import sys
+
+
+def fft(x):
+    """递归基-2 FFT。"""
+    n = len(x)
+    if n == 1:
+        return list(x)
+    even = fft(x[0::2])
+    odd = fft(x[1::2])
+    out = [0j] * n
+    for k in range(n // 2):
+        t = cmath.exp(-2j * math.pi * k / n) * odd[k]
+        out[k] = even[k] + t
+        out[k + n // 2] = even[k] - t
+    return out
+
+
+def spectral_kernel(n, fs, freq, q):
+    n_k = int(math.ceil(q * fs / freq))
+    if n_k > n:
+        raise ValueError(f"{freq:.1f} Hz 需要 {n_k} 点时域核，超过帧长 {n}，请提高 fmin")
+    window = [0.54 - 0.46 * math.cos(2 * math.pi * i / (n_k - 1)) for i in range(n_k)]
+    norm = sum(window)
+    start = (n - n_k) // 2  # 各频点的时域核都居中，保证时间对齐
+    temporal = [0j] * n
+    for i in range(n_k):
+        temporal[start + i] = window[i] / norm * cmath.exp(2j * math.pi * q * i / n_k)
+    return n_k, fft(temporal)
+
+
+def main():
+    n = int(sys.argv[1]) if len(sys.argv) > 1 else 1024
+    fs = float(sys.argv[2]) if len(sys.argv) > 2 else 48000.0
+    fmin = float(sys.argv[3]) if len(sys.argv) > 3 else 880.0
+    bins_per_octave = int(sys.argv[4]) if len(sys.argv) > 4 else 12
+    octaves = int(sys.argv[5]) if len(sys.argv) > 5 else 4
+    threshold = float(sys.argv[6]) if len(sys.argv) > 6 else 0.01
+
+    q = 1.0 / (2.0 ** (1.0 / bins_per_octave) - 1.0)
+    rows = []
+    values = []
+    freqs = []
+    for k in range(bins_per_octave * octaves):
+        freq = fmin * 2.0 ** (k / bins_per_octave)
+        n_k, kernel = spectral_kernel(n, fs, freq, q)
+        positive = kernel[: n // 2]
+        peak = max(abs(c) for c in positive)
+        keep = [j for j, c in enumerate(positive) if abs(c) > threshold * peak]
+        first, last = keep[0], keep[-1]
+        segment = positive[first:last + 1]
+        largest = max(max(abs(c.real), abs(c.imag)) for c in segment)
+        scale = largest / 32767.0
+        rows.append((first, len(segment), len(values), scale))
+        # 核取共轭后存放，运行时直接做复数乘加
+        for c in segment:
+            values.append((int(round(c.real / scale)), int(round(-c.imag / scale))))
+        freqs.append(freq)
+        print(f"bin {k}: {freq:8.1f} Hz  N_k = {n_k:4d}  FFT bins {first}..{last}")
+
+    out_path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "Core", "Src", "cqt_kernel.c")
+    with open(out_path, "w", encoding="utf-8") as f:
+        f.write("/**\n")
+        f.write(" * @description: 常数 Q 变换稀疏频域核，由 gen_cqt_kernel.py 自动生成，请勿手动修改。\n")
+        f.write(f" * @note: N = {n}, fs = {fs:g} Hz, fmin = {fmin:g} Hz, {bins_per_octave} 频点/倍频程, "
+                f"{octaves} 个倍频程, threshold = {threshold:g}，共 {len(values)} 个非零系数。\n")
+        f.write(" */\n")
+        f.write('#include "cqt.h"\n\n')
+        f.write("const float cqt_center_freqs[CQT_NUM_BINS] = {\n")
+        for i in range(0, len(freqs), 8):
+            f.write("    " + ", ".join(f"{x:.4f}f" for x in freqs[i:i + 8]) + ",\n")
+        f.write("};\n\n")
+        f.write("const cqt_kernel_row_t cqt_kernel_rows[CQT_NUM_BINS] = {\n")
+        for first, length, offset, scale in rows:
+            f.write(f"    {{{first}, {length}, {offset}, {scale:.8e}f}},\n")
+        f.write("};\n\n")
+        f.write(f"const int16_t cqt_kernel_values[{len(values)}][2] = {{\n")
+        for i in range(0, len(values), 8):
+            f.write("    " + ", ".join(f"{{{re}, {im}}}" for re, im in values[i:i + 8]) + ",\n")
+        f.write("};\n")
+    print(f"生成: {out_path} ({len(values)} 个系数, {len(values) * 4 + len(rows) * 12} 字节)")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,42 @@
+"""
+@description: 生成 DDS 振荡器使用的四分之一周期正弦表 Core/Src/dds_table.c。
+@note: 纯 Python 实现，不依赖 numpy。表中第 i 项为 sin(pi/2 * i / Q)，共 Q + 1 项 (含 90 度端点)，
+       运行时按象限对称展开到整周期并做线性插值。Q = 512 时插值误差约 1.2e-6 (约 -118 dB)。
+用法: python gen_dds_table.py [Q]  (默认 512，需与 dds.h 中的 DDS_QUARTER_BITS 一致)
+"""
+import math
+import os
+import sys
+
+
+def main():
+    quarter = int(sys.argv[1]) if len(sys.argv) > 1 else 512
+    if quarter < 2 or quarter & (quarter - 1):
+        raise ValueError("Q 必须是 2 的幂")
+    table = [math.sin(0.5 * math.pi * i / quarter) for i in range(quarter + 1)]
+
+    # 线性插值的最大误差 (在每段中点附近取样估计)
+    worst = 0.0
+    for i in range(quarter):
+        for j in range(1, 16):
+            frac = j / 16.0
+            x = 0.5 * math.pi * (i + frac) / quarter
+            approx = table[i] + (table[i + 1] - table[i]) * frac
+            worst = max(worst, abs(approx - math.sin(x)))
+
+    out_path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "Core", "Src", "dds_table.c")
+    with open(out_path, "w", encoding="utf-8") as f:
+        f.write("/**\n")
+        f.write(" * @description: DDS 四分之一周期正弦表，由 gen_dds_table.py 自动生成，请勿手动修改。\n")
+        f.write(f" * @note: Q = {quarter}，共 {quarter + 1} 项，线性插值最大误差 {worst:.2e}。\n")
+        f.write(" */\n")
+        f.write('#include "dds.h"\n\n')
+        f.write("const float dds_quarter_sine[DDS_QUARTER_SIZE + 1] = {\n")
+        for i in range(0, len(table), 8):
+            f.write("    " + ", ".join(f"{x:.9f}f" for x in table[i:i + 8]) + ",\n")
+        f.write("};\n")
+    print(f"生成: {out_path} ({len(table)} 项, {len(table) * 4} 字节, 插值误差 {worst:.2e})")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,134 @@
+"""
+@description: 生成多窗谱估计使用的 DPSS (Slepian) 窗函数表 Core/Src/dpss_tables.c。
+@note: 纯 Python 实现，不依赖 numpy。窗函数是三对角矩阵的特征向量:
+       对角线 ((N-1-2i)/2)^2 * cos(2*pi*W)，次对角线 i*(N-i)/2，W = NW/N。
+       先用 Sturm 序列二分求最大的 K 个特征值，再用反迭代求特征向量。
+       DPSS 第 k 个窗函数对称 (k 为偶数) 或反对称 (k 为奇数)，表中只保存前 N/2 点。
+用法: python gen_dpss_tables.py [N] [NW] [K]  (默认 1024 2.5 4，需与 multitaper.h 一致)
+"""
+import math
+import os
+import sys
+
+
+def tridiagonal(n, w):
+    diag = [((n - 1 - 2 * i) / 2.0) ** 2 * math.cos(2 * math.pi * w) for i in range(n)]
+    off = [i * (n - i) / 2.0 for i in range(1, n)]
+    return diag, off
+
+
+def sturm_count(diag, off, x):
+    """返回三对角矩阵中小于 x 的特征值个数。"""
+    count = 0
+    q = diag[0] - x
+    if q < 0:
+        count += 1
+    for i in range(1, len(diag)):
+        if q == 0:
+            q = 1e-300
+        q = diag[i] - x - off[i - 1] ** 2 / q
+        if q < 0:
+            count += 1
+    return count
+
+
+def eigenvalue(diag, off, index):
+    """二分法求升序第 index 个特征值。"""
+    bound = max(abs(d) for d in diag) + 2 * max(off)
+    lo, hi = -bound, bound
+    for _ in range(200):
+        mid = (lo + hi) / 2
+        if sturm_count(diag, off, mid) > index:
+            hi = mid
+        else:
+            lo = mid
+    return (lo + hi) / 2
+
+
+def solve_shifted(diag, off, mu, rhs):
+    """Thomas 算法求解 (T - mu I) y = rhs。"""
+    n = len(diag)
+    c = [0.0] * n
+    d = [0.0] * n
+    b0 = diag[0] - mu
+    c[0] = off[0] / b0
+    d[0] = rhs[0] / b0
+    for i in range(1, n):
+        denom = (diag[i] - mu) - off[i - 1] * c[i - 1]
+        if denom == 0:
+            denom = 1e-300
+        c[i] = off[i] / denom if i < n - 1 else 0.0
+        d[i] = (rhs[i] - off[i - 1] * d[i - 1]) / denom
+    y = [0.0] * n
+    y[-1] = d[-1]
+    for i in range(n - 2, -1, -1):
+        y[i] = d[i] - c[i] * y[i + 1]
+    return y
+
+
+def eigenvector(diag, off, lam):
+    n = len(diag)
+    mu = lam + 1e-9 * max(1.0, abs(lam))
+    v = [1.0 / math.sqrt(n)] * n
+    for _ in range(4):
+        v = solve_shifted(diag, off, mu, v)
+        norm = math.sqrt(sum(x * x for x in v))
+        v = [x / norm for x in v]
+    return v
+
+
+def concentration(v, w):
+    """能量集中度 lambda = v^T A v，A[m][n] = sin(2 pi W (m-n)) / (pi (m-n))。"""
+    n = len(v)
+    # 自相关后与 sinc 序列做内积，O(N^2)
+    total = 2 * w * sum(x * x for x in v)
+    for lag in range(1, n):
+        r = sum(v[i] * v[i + lag] for i in range(n - lag))
+        total += 2 * r * math.sin(2 * math.pi * w * lag) / (math.pi * lag)
+    return total
+
+
+def main():
+    n = int(sys.argv[1]) if len(sys.argv) > 1 else 1024
+    nw = float(sys.argv[2]) if len(sys.argv) > 2 else 2.5
+    k_tapers = int(sys.argv[3]) if len(sys.argv) > 3 else 4
+    w = nw / n
+
+    diag, off = tridiagonal(n, w)
+    tapers = []
+    ratios = []
+    for k in range(k_tapers):
+        lam = eigenvalue(diag, off, n - 1 - k)
+        v = eigenvector(diag, off, lam)
+        # 符号约定: 对称窗总和为正，反对称窗前半部分总和为正
+        if k % 2 == 0:
+            if sum(v) < 0:
+                v = [-x for x in v]
+        elif sum(v[: n // 2]) < 0:
+            v = [-x for x in v]
+        tapers.append(v)
+        ratios.append(concentration(v, w))
+        print(f"taper {k}: lambda = {ratios[-1]:.8f}")
+
+    out_path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "Core", "Src", "dpss_tables.c")
+    with open(out_path, "w", encoding="utf-8") as f:
+        f.write("/**\n")
+        f.write(" * @description: DPSS (Slepian) 窗函数表，由 gen_dpss_tables.py 自动生成，请勿手动修改。\n")
+        f.write(f" * @note: N = {n}, NW = {nw}, K = {k_tapers}，每个窗只保存前 N/2 点 (单位能量归一化)。\n")
+        f.write(" */\n")
+        f.write('#include "multitaper.h"\n\n')
+        f.write("const float dpss_eigenvalues[MULTITAPER_K] = {\n")
+        f.write("    " + ", ".join(f"{x:.8f}f" for x in ratios) + "};\n\n")
+        f.write("const float dpss_half_tapers[MULTITAPER_K][MULTITAPER_N / 2] = {\n")
+        for v in tapers:
+            f.write("    {\n")
+            half = v[: n // 2]
+            for i in range(0, len(half), 8):
+                f.write("        " + ", ".join(f"{x:.8e}f" for x in half[i:i + 8]) + ",\n")
+            f.write("    },\n")
+        f.write("};\n")
+    print(f"生成: {out_path}")
+
+
+if __name__ == "__main__":
+    main()
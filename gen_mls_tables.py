@@ -0,0 +1,92 @@
+"""
+@description: 生成 MLS 冲激响应测量使用的置换表 Core/Src/mls_tables.c。
+@note: 纯 Python 实现，不依赖 numpy。MLS 由 m 位 Fibonacci LFSR 生成 (a[n+m] = a[n] ^ a[n+3])，
+       窗口状态 v_n = (a[n], ..., a[n+m-1]) 按位组成整数。由 LFSR 的线性性，a[i+j] = u_i . v_j (GF(2) 内积)，
+       因此 MLS 循环相关矩阵 (-1)^a[(n-k) mod N] 等于 2^m 阶 Hadamard 矩阵的行列置换:
+           r[k] = sum_n y[n] * H[u_{-k}][v_n]
+       输入置换表 mls_input_perm[n] = v_n (采样 n 散布到 Hadamard 下标)，
+       输出置换表 mls_output_perm[k] = u_{(N-k) mod N} (Hadamard 输出下标收集为时延 k)。
+       脚本会以暴力循环相关校验置换结果。
+用法: python gen_mls_tables.py  (阶数和反馈抽头需与 ir_measure.h 中的 MLS_ORDER / MLS_TAP_MASK 一致)
+"""
+import os
+import random
+
+ORDER = 10
+TAP_MASK = (1 << 0) | (1 << 3)  # a[n+m] = a[n] ^ a[n+3]  (x^10 + x^3 + 1，本原多项式)
+SEED = 1                        # 初始窗口 (a[0] = 1，其余为 0)
+
+
+def parity(x):
+    return bin(x).count("1") & 1
+
+
+def main():
+    length = (1 << ORDER) - 1
+
+    # MLS 和窗口状态 (与 ir_measure.c 中的 ir_mls_generate 逐位一致)
+    state = SEED
+    bits = []
+    windows = []
+    for _ in range(length):
+        windows.append(state)
+        bits.append(state & 1)
+        feedback = parity(state & TAP_MASK)
+        state = (state >> 1) | (feedback << (ORDER - 1))
+    if state != SEED or len(set(windows)) != length:
+        raise ValueError("反馈抽头不是本原多项式，序列周期不足 2^m - 1")
+
+    # u_i: a[i + j] 关于窗口 v_j 的系数向量
+    coeffs = []
+    for i in range(length):
+        if i < ORDER:
+            coeffs.append(1 << i)
+        else:
+            u = 0
+            for t in range(ORDER):
+                if TAP_MASK >> t & 1:
+                    u ^= coeffs[i - ORDER + t]
+            coeffs.append(u)
+
+    input_perm = windows
+    output_perm = [coeffs[(length - k) % length] for k in range(length)]
+
+    # 校验: 置换 + FWHT 与暴力循环相关一致
+    rng = random.Random(1)
+    y = [rng.uniform(-1.0, 1.0) for _ in range(length)]
+    work = [0.0] * (1 << ORDER)
+    for n in range(length):
+        work[input_perm[n]] += y[n]
+    h = 1
+    while h < len(work):
+        for i in range(0, len(work), 2 * h):
+            for j in range(i, i + h):
+                a, b = work[j], work[j + h]
+                work[j], work[j + h] = a + b, a - b
+        h *= 2
+    worst = 0.0
+    for k in range(length):
+        brute = sum(y[n] * (1 - 2 * bits[(n - k) % length]) for n in range(length))
+        worst = max(worst, abs(brute - work[output_perm[k]]))
+    if worst > 1e-9:
+        raise ValueError(f"置换校验失败 (误差 {worst})")
+
+    out_path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "Core", "Src", "mls_tables.c")
+    with open(out_path, "w", encoding="utf-8") as f:
+        f.write("/**\n")
+        f.write(" * @description: MLS 快速 Hadamard 反卷积的置换表，由 gen_mls_tables.py 自动生成，请勿手动修改。\n")
+        f.write(f" * @note: m = {ORDER}，N = {length}，反馈抽头掩码 0x{TAP_MASK:03X}，初始状态 {SEED}。\n")
+        f.write(" */\n")
+        f.write('#include "ir_measure.h"\n\n')
+        for name, table in (("mls_input_perm", input_perm), ("mls_output_perm", output_perm)):
+            f.write(f"const uint16_t {name}[MLS_LENGTH] = {{\n")
+            for i in range(0, length, 16):
+                f.write("    " + ", ".join(str(x) for x in table[i:i + 16]) + ",\n")
+            f.write("};\n")
+            if name == "mls_input_perm":
+                f.write("\n")
+    print(f"生成: {out_path} (2 x {length} 项, {2 * length * 2} 字节, 校验误差 {worst:.1e})")
+
+
+if __name__ == "__main__":
+    main()
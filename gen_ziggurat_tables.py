@@ -0,0 +1,63 @@
+"""
+@description: 生成正态分布 Ziggurat 采样使用的表 Core/Src/ziggurat_tables.c (Marsaglia-Tsang 2000, 128 层)。
+@note: 纯 Python 实现，不依赖 numpy。kn 为快速接受门限 (与 32 位有符号随机数的绝对值比较)，
+       wn 把随机数换算为 x 坐标，fn 为各层边界处的密度 exp(-x^2/2)。
+用法: python gen_ziggurat_tables.py  (层数固定为 128，需与 siggen.h 中的 SIGGEN_ZIGGURAT_LAYERS 一致)
+"""
+import math
+import os
+
+LAYERS = 128
+R = 3.442619855899          # 最底层右边界
+AREA = 9.91256303526217e-3  # 每层面积
+M1 = 2147483648.0           # 2^31
+
+
+def tables():
+    kn = [0] * LAYERS
+    wn = [0.0] * LAYERS
+    fn = [0.0] * LAYERS
+    dn = R
+    tn = dn
+    q = AREA / math.exp(-0.5 * dn * dn)
+    kn[0] = int((dn / q) * M1)
+    kn[1] = 0
+    wn[0] = q / M1
+    wn[LAYERS - 1] = dn / M1
+    fn[0] = 1.0
+    fn[LAYERS - 1] = math.exp(-0.5 * dn * dn)
+    for i in range(LAYERS - 2, 0, -1):
+        dn = math.sqrt(-2.0 * math.log(AREA / dn + math.exp(-0.5 * dn * dn)))
+        kn[i + 1] = int((dn / tn) * M1)
+        tn = dn
+        fn[i] = math.exp(-0.5 * dn * dn)
+        wn[i] = dn / M1
+    return kn, wn, fn
+
+
+def main():
+    kn, wn, fn = tables()
+    out_path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "Core", "Src", "ziggurat_tables.c")
+    with open(out_path, "w", encoding="utf-8") as f:
+        f.write("/**\n")
+        f.write(" * @description: 正态分布 Ziggurat 表，由 gen_ziggurat_tables.py 自动生成，请勿手动修改。\n")
+        f.write(f" * @note: {LAYERS} 层, r = {R}, 每层面积 = {AREA}。\n")
+        f.write(" */\n")
+        f.write('#include "siggen.h"\n\n')
+        f.write("const uint32_t siggen_ziggurat_k[SIGGEN_ZIGGURAT_LAYERS] = {\n")
+        for i in range(0, LAYERS, 8):
+            f.write("    " + ", ".join(f"{x}u" for x in kn[i:i + 8]) + ",\n")
+        f.write("};\n\n")
+        f.write("const float siggen_ziggurat_w[SIGGEN_ZIGGURAT_LAYERS] = {\n")
+        for i in range(0, LAYERS, 8):
+            f.write("    " + ", ".join(f"{x:.9e}f" for x in wn[i:i + 8]) + ",\n")
+        f.write("};\n\n")
+        f.write("const float siggen_ziggurat_f[SIGGEN_ZIGGURAT_LAYERS] = {\n")
+        for i in range(0, LAYERS, 8):
+            f.write("    " + ", ".join(f"{x:.9e}f" for x in fn[i:i + 8]) + ",\n")
+        f.write("};\n")
+    print(f"生成: {out_path} ({LAYERS * 12} 字节)")
+
+
+if __name__ == "__main__":
+    main()